@@ -29,5 +29,6 @@
 #include "arm_compute/core/CPP/kernels/CPPDetectionWindowNonMaximaSuppressionKernel.h"
 #include "arm_compute/core/CPP/kernels/CPPPermuteKernel.h"
 #include "arm_compute/core/CPP/kernels/CPPSortEuclideanDistanceKernel.h"
+#include "arm_compute/core/CPP/kernels/CPPSortKeypointsKernel.h"
 
 #endif /* __ARM_COMPUTE_CPPKERNELS_H__ */
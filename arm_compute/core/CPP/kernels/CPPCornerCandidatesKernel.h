@@ -36,6 +36,9 @@ class ITensor;
 using IImage = ITensor;
 
 /** CPP kernel to perform corner candidates
+ *
+ * @note Each thread buffers the candidates it finds and appends them to the output array in batches.
+ *       The order of the candidates in the output array is therefore not deterministic.
  */
 class CPPCornerCandidatesKernel : public INEKernel
 {
@@ -35,6 +35,8 @@ namespace arm_compute
  *
  * @note This kernel is meant to be used alongside HOG or other object detection algorithms to perform a non-maxima suppression on a
  *       IDetectionWindowArray
+ *
+ * The windows are bucketed on a grid of cells as wide as the minimum distance, so each window is only compared with the windows of its 3x3 neighbouring cells.
  */
 class CPPDetectionWindowNonMaximaSuppressionKernel : public ICPPKernel
 {
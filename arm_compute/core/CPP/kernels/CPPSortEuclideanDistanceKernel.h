@@ -29,10 +29,16 @@
 
 #include <cstdint>
 #include <mutex>
+#include <vector>
 
 namespace arm_compute
 {
-/** CPP kernel to perform sorting and euclidean distance */
+/** CPP kernel to perform sorting and euclidean distance
+ *
+ * The candidates are visited strongest first and a candidate is kept only if no stronger kept candidate lies within the
+ * minimum distance. The kept candidates are bucketed into a uniform grid whose cells are at least as large as the minimum
+ * distance, so each candidate is only compared against the kept candidates of its 3x3 neighbouring cells.
+ */
 class CPPSortEuclideanDistanceKernel : public ICPPKernel
 {
 public:
@@ -56,18 +62,24 @@ public:
      * @param[out]    output                Output keypoints.
      * @param[in]     num_corner_candidates Pointer to the number of corner candidates in the input array
      * @param[in]     min_distance          Radial Euclidean distance to use
+     * @param[in]     num_sorted_runs       (Optional) If not 0, the input is made of this many runs already sorted by @ref CPPSortKeypointsKernel,
+     *                                      which are merged instead of sorting the whole array. Defaults to 0.
      */
-    void configure(InternalKeypoint *in_out, IKeyPointArray *output, const int32_t *num_corner_candidates, float min_distance);
+    void configure(InternalKeypoint *in_out, IKeyPointArray *output, const int32_t *num_corner_candidates, float min_distance, unsigned int num_sorted_runs = 0);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
     bool is_parallelisable() const override;
 
 private:
-    const int32_t    *_num_corner_candidates; /**< Number of corner candidates */
-    float             _min_distance;          /**< Radial Euclidean distance */
-    InternalKeypoint *_in_out;                /**< Source array of InternalKeypoint */
-    IKeyPointArray   *_output;                /**< Destination array of IKeyPointArray */
+    const int32_t       *_num_corner_candidates; /**< Number of corner candidates */
+    float                _min_distance;          /**< Radial Euclidean distance */
+    InternalKeypoint    *_in_out;                /**< Source array of InternalKeypoint */
+    IKeyPointArray      *_output;                /**< Destination array of IKeyPointArray */
+    unsigned int         _num_sorted_runs;       /**< Number of sorted runs in the input, 0 if the input is not sorted */
+    std::vector<int32_t> _cell_head;             /**< Index in _kept of the last kept keypoint of each grid cell, -1 if empty */
+    std::vector<int32_t> _kept_next;             /**< Index in _kept of the previous kept keypoint of the same cell, -1 if none */
+    std::vector<int32_t> _kept;                  /**< Indices in _in_out of the kept keypoints */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CPPSORTEUCLIDEANDISTANCEKERNEL_H__ */
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPPSORTKEYPOINTSKERNEL_H__
+#define __ARM_COMPUTE_CPPSORTKEYPOINTSKERNEL_H__
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <cstdint>
+#include <utility>
+
+namespace arm_compute
+{
+/** CPP kernel to sort internal keypoints by decreasing strength in parallel.
+ *
+ * The array of candidates is split into @p num_runs contiguous runs which are sorted independently,
+ * one run per window iteration. The runs can then be merged by @ref CPPSortEuclideanDistanceKernel.
+ */
+class CPPSortKeypointsKernel : public ICPPKernel
+{
+public:
+    const char *name() const override
+    {
+        return "CPPSortKeypointsKernel";
+    }
+    /** Default constructor */
+    CPPSortKeypointsKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CPPSortKeypointsKernel(const CPPSortKeypointsKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CPPSortKeypointsKernel &operator=(const CPPSortKeypointsKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CPPSortKeypointsKernel(CPPSortKeypointsKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CPPSortKeypointsKernel &operator=(CPPSortKeypointsKernel &&) = default;
+    /** Initialise the kernel's source and destination.
+     *
+     * @param[in,out] in_out                Internal keypoints to sort in place.
+     * @param[in]     num_corner_candidates Pointer to the number of corner candidates in the input array. Read at run time.
+     * @param[in]     num_runs              Number of runs the array is split into. Usually the number of threads.
+     */
+    void configure(InternalKeypoint *in_out, const int32_t *num_corner_candidates, unsigned int num_runs);
+    /** Strongest-first ordering of the keypoints
+     *
+     * Keypoints of equal strength are ordered by y then x coordinate, so that the order
+     * doesn't depend on the order in which the threads appended the candidates.
+     *
+     * @param[in] lhs First keypoint
+     * @param[in] rhs Second keypoint
+     *
+     * @return true if @p lhs is stronger than @p rhs, or as strong and before it in raster order
+     */
+    static bool keypoint_compare(const InternalKeypoint &lhs, const InternalKeypoint &rhs)
+    {
+        if(std::get<2>(lhs) != std::get<2>(rhs))
+        {
+            return std::get<2>(lhs) > std::get<2>(rhs);
+        }
+        if(std::get<1>(lhs) != std::get<1>(rhs))
+        {
+            return std::get<1>(lhs) < std::get<1>(rhs);
+        }
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    }
+    /** Compute the boundaries of a run
+     *
+     * @param[in] num_elements Number of elements in the array
+     * @param[in] num_runs     Number of runs the array is split into
+     * @param[in] run          Index of the run
+     *
+     * @return the first and one past the last index of the run
+     */
+    static std::pair<int32_t, int32_t> run_bounds(int32_t num_elements, unsigned int num_runs, unsigned int run)
+    {
+        const int64_t start = static_cast<int64_t>(num_elements) * run / num_runs;
+        const int64_t end   = static_cast<int64_t>(num_elements) * (run + 1) / num_runs;
+        return std::make_pair(static_cast<int32_t>(start), static_cast<int32_t>(end));
+    }
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const int32_t    *_num_corner_candidates; /**< Number of corner candidates */
+    InternalKeypoint *_in_out;                /**< Array of InternalKeypoint to sort */
+    unsigned int      _num_runs;              /**< Number of runs */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_CPPSORTKEYPOINTSKERNEL_H__ */
@@ -102,6 +102,62 @@ public:
 using NEGradientFP16Kernel = NEGradientKernel;
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 
+/** Computes the 3x3 Sobel gradients of an U8 image and, in the same pass, their magnitude and quantised phase.
+ *
+ * Produces the same results as @ref NESobel3x3Kernel followed by @ref NEGradientKernel without writing Gx and Gy to memory.
+ */
+class NESobel3x3GradientKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NESobel3x3GradientKernel";
+    }
+    /** Default constructor */
+    NESobel3x3GradientKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESobel3x3GradientKernel(const NESobel3x3GradientKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESobel3x3GradientKernel &operator=(const NESobel3x3GradientKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NESobel3x3GradientKernel(NESobel3x3GradientKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NESobel3x3GradientKernel &operator=(NESobel3x3GradientKernel &&) = default;
+    /** Default destructor */
+    ~NESobel3x3GradientKernel() = default;
+
+    /** Initialise the kernel's source, destinations and border mode.
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] magnitude        Destination tensor - Magnitude. Data type supported: U16.
+     * @param[out] phase            Destination tensor - Quantized phase. Data type supported: U8.
+     * @param[in]  norm_type        Normalization type. If 1, L1-Norm otherwise L2-Norm
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *magnitude, ITensor *phase, int32_t norm_type, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    BorderSize border_size() const override;
+
+private:
+    /** Common signature for all the specialised fused gradient functions
+     *
+     * @param[in]  top_ptr       Pointer to the top-left neighbour of the first pixel to process.
+     * @param[in]  mid_ptr       Pointer to the left neighbour of the first pixel to process.
+     * @param[in]  bot_ptr       Pointer to the bottom-left neighbour of the first pixel to process.
+     * @param[out] magnitude_ptr Pointer to the magnitude tensor
+     * @param[out] phase_ptr     Pointer to the quantized phase tensor
+     */
+    using Sobel3x3GradientFunction = void(const uint8_t *__restrict top_ptr, const uint8_t *__restrict mid_ptr, const uint8_t *__restrict bot_ptr, void *__restrict magnitude_ptr,
+                                          void *__restrict phase_ptr);
+
+    Sobel3x3GradientFunction *_func;      /**< Fused gradient function to use for the normalization type passed to configure() */
+    const ITensor            *_input;     /**< Source tensor */
+    ITensor                  *_magnitude; /**< Destination tensor - Magnitude */
+    ITensor                  *_phase;     /**< Destination tensor - Quantized phase */
+};
+
 /** NEON kernel to perform Non-Maxima suppression for Canny Edge.
  *
  * @note This kernel is meant to be used alongside CannyEdge and performs a non-maxima suppression using magnitude and phase of input
@@ -53,7 +53,7 @@ public:
     NEDepthwiseConvolutionLayer3x3Kernel &operator=(NEDepthwiseConvolutionLayer3x3Kernel &&) = default;
     /** Initialize the function's source, destination, conv and border_size.
      *
-     * @param[in]  input       Source tensor. DataType supported: QASYMM8, F32.
+     * @param[in]  input       Source tensor. DataType supported: QASYMM8, F16, F32.
      * @param[in]  weights     Weights tensor. This is a 3D tensor with dimensions [3, 3, IFM]. Data type supported: Same as @p input.
      * @param[out] output      Destination tensor. Data type supported: Same as @p input.
      * @param[in]  conv_info   Padding and stride information to use for the convolution.
@@ -82,7 +82,7 @@ private:
     void configure_optimized();
     void run_generic(const Window &window, const ThreadInfo &info);
     void run_optimized(const Window &window, const ThreadInfo &info);
-    std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver_object(TensorShape shape, PadStrideInfo conv_info,
+    std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver_object(TensorShape shape, PadStrideInfo conv_info, DataType dt,
                                                                               const uint8_t *w_ptr, uint8_t *in_ptr, uint8_t *out_ptr);
 
 private:
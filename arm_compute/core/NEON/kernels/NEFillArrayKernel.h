@@ -27,6 +27,7 @@
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
+#include "support/Mutex.h"
 
 #include <cstdint>
 
@@ -35,7 +36,11 @@ namespace arm_compute
 class ITensor;
 using IImage = ITensor;
 
-/** This kernel adds all texels greater than or equal to the threshold value to the keypoint array. */
+/** This kernel adds all texels greater than or equal to the threshold value to the keypoint array.
+ *
+ * @note Each thread buffers the keypoints it finds and appends them to the array in batches.
+ *       The order of the keypoints in the array is therefore not deterministic.
+ */
 class NEFillArrayKernel : public INEKernel
 {
 public:
@@ -66,12 +71,12 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
-    bool is_parallelisable() const override;
 
 private:
-    const IImage   *_input;
-    IKeyPointArray *_output;
-    uint8_t         _threshold;
+    const IImage      *_input;
+    IKeyPointArray    *_output;
+    uint8_t            _threshold;
+    arm_compute::Mutex _mtx;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEFILLARRAYKERNEL_H__*/
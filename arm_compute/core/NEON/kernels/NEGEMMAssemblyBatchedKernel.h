@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMASSEMBLYBATCHEDKERNEL_H__
+#define __ARM_COMPUTE_NEGEMMASSEMBLYBATCHEDKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to compute a batch of same-shape matrix multiplications C[i] = alpha * A[i] x B[i] + beta * C[i] with the assembly interleaved GEMM.
+ *
+ * The batch is part of the execution window (Window::DimZ), so the problems can be split across threads by batch as well as by rows.
+ * The batch can be given either as 3D tensors whose third dimension is the batch (strided batch) or as arrays of 2D tensors.
+ * In both cases a single matrix B can be shared by all the problems of the batch: it is then read already interleaved
+ * from the output of @ref NEGEMMAssemblyBatchedPackBKernel instead of being interleaved again for every problem on every thread.
+ */
+class NEGEMMAssemblyBatchedKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGEMMAssemblyBatchedKernel";
+    }
+    /** Default constructor */
+    NEGEMMAssemblyBatchedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMAssemblyBatchedKernel(const NEGEMMAssemblyBatchedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMAssemblyBatchedKernel &operator=(const NEGEMMAssemblyBatchedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMAssemblyBatchedKernel(NEGEMMAssemblyBatchedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMAssemblyBatchedKernel &operator=(NEGEMMAssemblyBatchedKernel &&) = default;
+    /** Default destructor */
+    ~NEGEMMAssemblyBatchedKernel() = default;
+    /** Initialise the kernel with strided batches.
+     *
+     * @param[in]     a         Matrices A with shape [K, M, batches]. Data types supported: F32
+     * @param[in]     b         Matrices B with shape [N, K, batches], or [N, K] to share the same matrix B across the batch. Data types supported: Same as @p a
+     * @param[in,out] c         Matrices C with shape [N, M, batches]. If @p beta is not zero the values are multiplied by @p beta before the result is accumulated. Data types supported: Same as @p a
+     * @param[out]    workspace Space for the interleaved panels. Its size must be at least @ref get_workspace_size
+     * @param[in]     alpha     Weight of the matrix product
+     * @param[in]     beta      Weight of the accumulation.
+     * @param[in]     packed_b  (Optional) Shared matrix @p b packed by @ref NEGEMMAssemblyBatchedPackBKernel, or nullptr to interleave @p b for every problem.
+     *                          Must be nullptr if @p b has a batch dimension.
+     */
+    void configure(const ITensor *a, const ITensor *b, ITensor *c, ITensor *workspace, float alpha, float beta, const ITensor *packed_b = nullptr);
+    /** Initialise the kernel with arrays of matrices.
+     *
+     * @param[in]     a         Matrices A, all with shape [K, M]. Data types supported: F32
+     * @param[in]     b         Matrices B, all with shape [N, K]. Either one per matrix of @p a or a single one shared by the batch. Data types supported: Same as @p a
+     * @param[in,out] c         Matrices C, all with shape [N, M], one per matrix of @p a. Data types supported: Same as @p a
+     * @param[out]    workspace Space for the interleaved panels. Its size must be at least @ref get_workspace_size
+     * @param[in]     alpha     Weight of the matrix product
+     * @param[in]     beta      Weight of the accumulation.
+     * @param[in]     packed_b  (Optional) Single matrix of @p b packed by @ref NEGEMMAssemblyBatchedPackBKernel, or nullptr to interleave the matrices B for every problem.
+     *                          Must be nullptr if @p b holds more than one matrix.
+     */
+    void configure(const std::vector<const ITensor *> &a, const std::vector<const ITensor *> &b, const std::vector<ITensor *> &c, ITensor *workspace, float alpha, float beta,
+                   const ITensor *packed_b = nullptr);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMAssemblyBatchedKernel with strided batches
+     *
+     * @param[in] a Matrices A with shape [K, M, batches]. Data types supported: F32
+     * @param[in] b Matrices B with shape [N, K, batches] or [N, K]. Data types supported: Same as @p a
+     * @param[in] c Matrices C with shape [N, M, batches]. Data types supported: Same as @p a
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMAssemblyBatchedKernel with arrays of matrices
+     *
+     * @param[in] a Matrices A, all with shape [K, M]. Data types supported: F32
+     * @param[in] b Matrices B, all with shape [N, K]. Either one per matrix of @p a or a single one shared by the batch. Data types supported: Same as @p a
+     * @param[in] c Matrices C, all with shape [N, M], one per matrix of @p a. Data types supported: Same as @p a
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &a, const std::vector<const ITensorInfo *> &b, const std::vector<const ITensorInfo *> &c);
+    /** Size in bytes of the workspace required by the kernel
+     *
+     * @param[in] ci          CPU information
+     * @param[in] M           Number of rows of the matrices A and C
+     * @param[in] N           Number of columns of the matrices B and C
+     * @param[in] K           Number of columns of the matrices A
+     * @param[in] num_threads Number of threads the kernel will be scheduled on
+     *
+     * @return the size of the workspace in bytes
+     */
+    static size_t get_workspace_size(const CPUInfo &ci, unsigned int M, unsigned int N, unsigned int K, unsigned int num_threads);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common part of the configure methods: pads the matrices and creates the window over [rows, batches] */
+    void configure_common(unsigned int num_batches);
+
+    std::vector<const ITensor *> _a;
+    std::vector<const ITensor *> _b;
+    std::vector<ITensor *>       _c;
+    ITensor                     *_workspace;
+    const ITensor               *_packed_b;
+    float                        _alpha;
+    float                        _beta;
+    bool                         _is_strided;
+};
+
+/** NEON kernel to interleave once a matrix B shared by all the problems of a @ref NEGEMMAssemblyBatchedKernel
+ *
+ * The panels only depend on the shape of B and on the cache sizes, so they can be reused by every problem of the batch and by every thread.
+ */
+class NEGEMMAssemblyBatchedPackBKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGEMMAssemblyBatchedPackBKernel";
+    }
+    /** Default constructor */
+    NEGEMMAssemblyBatchedPackBKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMAssemblyBatchedPackBKernel(const NEGEMMAssemblyBatchedPackBKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMAssemblyBatchedPackBKernel &operator=(const NEGEMMAssemblyBatchedPackBKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMAssemblyBatchedPackBKernel(NEGEMMAssemblyBatchedPackBKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMAssemblyBatchedPackBKernel &operator=(NEGEMMAssemblyBatchedPackBKernel &&) = default;
+    /** Default destructor */
+    ~NEGEMMAssemblyBatchedPackBKernel() = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  b        Matrix B with shape [N, K]. Data types supported: F32
+     * @param[out] packed_b Interleaved panels of @p b. Its size must be at least @ref get_packed_b_size. Data types supported: U8
+     */
+    void configure(const ITensor *b, ITensor *packed_b);
+    /** Size in bytes of the interleaved panels of a matrix B
+     *
+     * @param[in] ci CPU information
+     * @param[in] N  Number of columns of the matrix B
+     * @param[in] K  Number of rows of the matrix B
+     *
+     * @return the size of the packed matrix in bytes
+     */
+    static size_t get_packed_b_size(const CPUInfo &ci, unsigned int N, unsigned int K);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_b;
+    ITensor       *_packed_b;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEGEMMASSEMBLYBATCHEDKERNEL_H__*/
@@ -24,8 +24,12 @@
 #ifndef __ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__
 #define __ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__
 
+#include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/INESimpleKernel.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -101,5 +105,74 @@ public:
 private:
     int _t2_load_offset;
 };
+
+/** NEON kernel to compute a pyramid level from the previous one: 5x5 Gaussian filter and nearest neighbour downsampling in a single pass
+ *
+ * For each output row the horizontal pass is computed on the 5 input rows it needs, only at the sampled columns,
+ * into a per-thread line buffer. Input row r is kept in slot r % 5 so consecutive output rows reuse the rows they share
+ * and every input row is filtered horizontally about once. The vertical pass then reads the line buffer only.
+ *
+ * @note The border of the input has to be filled (if needed) with a @ref NEFillBorderKernel of size @ref border_size()
+ */
+class NEGaussianPyramidDownsampleKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGaussianPyramidDownsampleKernel";
+    }
+    /** Default constructor */
+    NEGaussianPyramidDownsampleKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGaussianPyramidDownsampleKernel(const NEGaussianPyramidDownsampleKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGaussianPyramidDownsampleKernel &operator=(const NEGaussianPyramidDownsampleKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGaussianPyramidDownsampleKernel(NEGaussianPyramidDownsampleKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGaussianPyramidDownsampleKernel &operator=(NEGaussianPyramidDownsampleKernel &&) = default;
+    /** Default destructor */
+    ~NEGaussianPyramidDownsampleKernel() = default;
+
+    /** Initialise the kernel's source, destination and scale.
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] output           Destination tensor. Data type supported: U8.
+     * @param[in]  scale            Scale of the pyramid. With @ref SCALE_PYRAMID_HALF the samples are selected as in @ref NEGaussianPyramidHorKernel
+     *                              and @ref NEGaussianPyramidVertKernel, otherwise as in @ref NEScaleKernel with nearest neighbour interpolation.
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, float scale, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    BorderSize border_size() const override;
+
+private:
+    /** Compute the horizontal pass of an input row at the sampled columns
+     *
+     * @param[in]  row     Input row
+     * @param[in]  plane   Input plane
+     * @param[in]  x_start First output column
+     * @param[in]  x_end   One past the last output column
+     * @param[out] line    Destination line
+     */
+    void horizontal_pass(int row, int plane, int x_start, int x_end, uint16_t *line) const;
+    /** Input row sampled for an output row
+     *
+     * @param[in] y Output row
+     *
+     * @return the centre row of the Gaussian filter in the input
+     */
+    int input_row(int y) const;
+
+    const ITensor       *_input;
+    ITensor             *_output;
+    bool                 _is_half;   /**< True if the samples are selected as for SCALE_PYRAMID_HALF */
+    int                  _x_offset;  /**< Input column of output column 0 for SCALE_PYRAMID_HALF */
+    int                  _y_offset;  /**< Input row of output row 0 for SCALE_PYRAMID_HALF */
+    float                _hr;        /**< Ratio between the input and output heights */
+    std::vector<int32_t> _x_samples; /**< Input column sampled for every output column (other scales) */
+};
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__ */
@@ -29,14 +29,24 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "support/Mutex.h"
 
+#include <array>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
 
-/** NEON kernel to perform HOG detector kernel using linear SVM */
+/** NEON kernel to perform HOG detector kernel using linear SVM
+ *
+ * Up to @ref max_num_models models sharing the same descriptor geometry can be evaluated in a single pass: the HOG descriptor of
+ * each detection window is then read once and multiplied by all the models.
+ */
 class NEHOGDetectorKernel : public INEKernel
 {
 public:
+    /** Maximum number of HOG models evaluated by a single kernel */
+    static constexpr size_t max_num_models = 4;
+
     const char *name() const override
     {
         return "NEHOGDetectorKernel";
@@ -65,25 +75,39 @@ public:
      * @param[in]  idx_class               (Optional) Index of the class used for evaluating which class the detection window belongs to
      */
     void configure(const ITensor *input, const IHOG *hog, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride, float threshold = 0.0f, uint16_t idx_class = 0);
+    /** Initialise the kernel's input, HOG data-objects, detection window, the stride of the detection window, the threshold and indices of the objects to detect
+     *
+     * @param[in]  input                   Input tensor which stores the HOG descriptor obtained with @ref NEHOGOrientationBinningKernel. Data type supported: F32. Number of channels supported: equal to the number of histogram bins per block
+     * @param[in]  hogs                    HOG data objects to evaluate. They must all have the same detection window size, block size, block stride and number of bins.
+     *                                     The number of HOG data objects must be at most @ref max_num_models
+     * @param[out] detection_windows       Array of @ref DetectionWindow. This array stores all the detected objects
+     * @param[in]  detection_window_stride Distance in pixels between 2 consecutive detection windows in x and y directions.
+     *                                     It must be multiple of the block stride of the HOG data objects
+     * @param[in]  threshold               Threshold for the distance between features and SVM classifying plane
+     * @param[in]  idx_classes             Index of the class of each HOG data object. Must have the same size as @p hogs
+     */
+    void configure(const ITensor *input, const std::vector<const IHOG *> &hogs, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride, float threshold,
+                   const std::vector<uint16_t> &idx_classes);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    const ITensor         *_input;
-    IDetectionWindowArray *_detection_windows;
-    const float           *_hog_descriptor;
-    float                  _bias;
-    float                  _threshold;
-    uint16_t               _idx_class;
-    size_t                 _num_bins_per_descriptor_x;
-    size_t                 _num_blocks_per_descriptor_y;
-    size_t                 _block_stride_width;
-    size_t                 _block_stride_height;
-    size_t                 _detection_window_width;
-    size_t                 _detection_window_height;
-    size_t                 _max_num_detection_windows;
-    arm_compute::Mutex     _mutex;
+    const ITensor                             *_input;
+    IDetectionWindowArray                     *_detection_windows;
+    std::array<const float *, max_num_models>  _hog_descriptors;
+    std::array<float, max_num_models>          _biases;
+    std::array<uint16_t, max_num_models>       _idx_classes;
+    size_t                                     _num_models;
+    float                                      _threshold;
+    size_t                                     _num_bins_per_descriptor_x;
+    size_t                                     _num_blocks_per_descriptor_y;
+    size_t                                     _block_stride_width;
+    size_t                                     _block_stride_height;
+    size_t                                     _detection_window_width;
+    size_t                                     _detection_window_height;
+    size_t                                     _max_num_detection_windows;
+    arm_compute::Mutex                         _mutex;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEHOGDETECTORKERNEL_H__ */
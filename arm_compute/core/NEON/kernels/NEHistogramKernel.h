@@ -25,7 +25,6 @@
 #define __ARM_COMPUTE_NEHISTOGRAMKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "support/Mutex.h"
 
 #include <cstddef>
 #include <cstdint>
@@ -36,7 +35,14 @@ class IDistribution1D;
 class ITensor;
 using IImage = ITensor;
 
-/** Interface for the histogram kernel */
+/** Interface for the histogram kernel
+ *
+ * Each thread bins its part of the image into its own sub-histogram of the local_hist array.
+ * The sub-histograms are padded to a multiple of a cache line so that threads never write to the same line,
+ * and have to be summed into the output distribution by @ref NEHistogramReductionKernel.
+ *
+ * @note The sub-histograms are accumulated into: the local_hist array has to be cleared before each run.
+ */
 class NEHistogramKernel : public INEKernel
 {
 public:
@@ -60,9 +66,9 @@ public:
     /** Set the input image and the distribution output.
      *
      * @param[in]     input      Source image. Data type supported: U8.
-     * @param[out]    output     Destination distribution.
+     * @param[in]     output     Destination distribution. Only used to get the number of bins, the offset and the range.
      * @param[in,out] local_hist Array that the threads use to save their local histograms.
-     *                           It's size should be equal to (number_of_threads * num_bins),
+     *                           It's size should be equal to (number_of_threads * @ref local_hist_stride(num_bins)),
      *                           and the Window::thread_id() is used to determine the part of the array
      *                           used by each thread.
      * @param[out]    window_lut LUT with pre-calculated possible window values.
@@ -70,33 +76,36 @@ public:
      *                           during the configure stage, while it re-used in every run, therefore can be
      *                           safely shared among threads.
      */
-    void configure(const IImage *input, IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut);
+    void configure(const IImage *input, const IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut);
     /** Set the input image and the distribution output.
      *
      * @note Used for histogram of fixed size equal to 256
      *
-     * @param[in]  input  Source image. Data type supported: U8.
-     * @param[out] output Destination distribution which must be of 256 bins..
+     * @param[in]     input      Source image. Data type supported: U8.
+     * @param[in]     output     Destination distribution which must be of 256 bins.
+     * @param[in,out] local_hist Array that the threads use to save their local histograms.
+     *                           It's size should be equal to (number_of_threads * @ref local_hist_stride(256)).
+     */
+    void configure(const IImage *input, const IDistribution1D *output, uint32_t *local_hist);
+    /** Distance in elements between two consecutive sub-histograms of the local_hist array
+     *
+     * @param[in] num_bins Number of bins of the histogram
+     *
+     * @return @p num_bins rounded up to a whole number of cache lines
      */
-    void configure(const IImage *input, IDistribution1D *output);
+    static size_t local_hist_stride(size_t num_bins);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    /** Function to merge multiple partial histograms.
+    /** Count the occurrences of every pixel value in the given window
      *
-     * @param[out] global_hist Pointer to the final histogram.
-     * @param[in]  local_hist  Pointer to the partial histograms.
-     * @param[in]  bins        Number of bins.
+     * @param[in]  win      Region on which to execute the kernel
+     * @param[out] counters Array of _num_ways * _max_range_size counters. Consecutive pixels are counted in different ways
+     *                      so that the increments of identical values do not depend on each other.
      */
-    void merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins);
-    /** Function to merge multiple minimum values of partial histograms.
-     *
-     * @param[out] global_min Pointer to the global min value.
-     * @param[in]  local_min  Local min value.
-     */
-    void merge_min(uint8_t *global_min, const uint8_t &local_min);
+    void count_U8(Window win, uint32_t *counters) const;
     /** Function to perform histogram on the given window
      *
      * @param[in] win  Region on which to execute the kernel
@@ -125,11 +134,51 @@ private:
 
     HistogramFunctionPtr          _func; ///< Histogram function to use for the particular image types passed to configure()
     const IImage                 *_input;
-    IDistribution1D              *_output;
+    const IDistribution1D        *_output;
     uint32_t                     *_local_hist;
     uint32_t                     *_window_lut;
-    arm_compute::Mutex            _hist_mtx;
     static constexpr unsigned int _max_range_size{ 256 }; ///< 256 possible pixel values as we handle only U8 images
+    static constexpr unsigned int _num_ways{ 4 };         ///< Number of interleaved counters per pixel value
+};
+
+/** Interface for the kernel summing the sub-histograms computed by @ref NEHistogramKernel
+ *
+ * The bins are split between the threads, each of them summing all the sub-histograms for its bins.
+ */
+class NEHistogramReductionKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEHistogramReductionKernel";
+    }
+    /** Default constructor */
+    NEHistogramReductionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEHistogramReductionKernel(const NEHistogramReductionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEHistogramReductionKernel &operator=(const NEHistogramReductionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEHistogramReductionKernel(NEHistogramReductionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEHistogramReductionKernel &operator=(NEHistogramReductionKernel &&) = default;
+    /** Default destructor */
+    ~NEHistogramReductionKernel() = default;
+    /** Set the sub-histograms and the distribution output.
+     *
+     * @param[in]  local_hist     Sub-histograms computed by @ref NEHistogramKernel.
+     * @param[in]  num_local_hist Number of sub-histograms in @p local_hist. Usually the number of threads.
+     * @param[out] output         Destination distribution. Its buffer is overwritten with the sum of the sub-histograms.
+     */
+    void configure(const uint32_t *local_hist, unsigned int num_local_hist, IDistribution1D *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const uint32_t  *_local_hist;
+    unsigned int     _num_local_hist;
+    IDistribution1D *_output;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEHISTOGRAMKERNEL_H__ */
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEIMAGEPREPROCESSKERNEL_H__
+#define __ARM_COMPUTE_NEIMAGEPREPROCESSKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class IMultiImage;
+class ITensor;
+using IImage = ITensor;
+
+/** NEON kernel to prepare an image for a network input in a single pass
+ *
+ * For every output pixel the kernel samples the source image bilinearly, converts it to RGB if needed and normalises each channel:
+ *
+ * @f[ out(x, y, c) = \frac{rgb(x', y', c) - mean(c)}{std(c)} @f]
+ *
+ * The result is written to a planar tensor of shape [width, height, 3], so colour conversion, resizing and normalisation
+ * never store an intermediate image. For YUV sources the luma and chroma planes are interpolated separately before
+ * the conversion (BT709), which is equivalent to interpolating the converted image as both operations are linear.
+ *
+ * Source pixels outside of the image are clamped to the closest edge pixel.
+ */
+class NEImagePreprocessKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEImagePreprocessKernel";
+    }
+    /** Default constructor */
+    NEImagePreprocessKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImagePreprocessKernel(const NEImagePreprocessKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImagePreprocessKernel &operator=(const NEImagePreprocessKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEImagePreprocessKernel(NEImagePreprocessKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEImagePreprocessKernel &operator=(NEImagePreprocessKernel &&) = default;
+    /** Default destructor */
+    ~NEImagePreprocessKernel() = default;
+
+    /** Initialise the kernel with an interleaved source image
+     *
+     * @param[in]  input   Source image. Formats supported: RGB888/RGBA8888.
+     * @param[out] output  Destination tensor of shape [width, height, 3]. Data types supported: F32/QASYMM8.
+     * @param[in]  mean    Mean of each channel, in RGB order.
+     * @param[in]  std_dev Standard deviation of each channel, in RGB order.
+     * @param[in]  bgr     (Optional) Store the blue channel in the first plane of @p output.
+     */
+    void configure(const IImage *input, ITensor *output, const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr = false);
+    /** Initialise the kernel with a multi-planar source image
+     *
+     * @param[in]  input   Source image. Formats supported: NV12/NV21.
+     * @param[out] output  Destination tensor of shape [width, height, 3]. Data types supported: F32/QASYMM8.
+     * @param[in]  mean    Mean of each channel, in RGB order.
+     * @param[in]  std_dev Standard deviation of each channel, in RGB order.
+     * @param[in]  bgr     (Optional) Store the blue channel in the first plane of @p output.
+     */
+    void configure(const IMultiImage *input, ITensor *output, const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr = false);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEImagePreprocessKernel
+     *
+     * @param[in] input   Source image info. Formats supported: RGB888/RGBA8888.
+     * @param[in] output  Destination tensor info of shape [width, height, 3]. Data types supported: F32/QASYMM8.
+     * @param[in] std_dev Standard deviation of each channel, in RGB order.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const std::array<float, 3> &std_dev);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Bilinear sampling coefficients along one dimension */
+    struct SampleTable
+    {
+        std::vector<int32_t> index0; /**< First tap of every output pixel, clamped to the image */
+        std::vector<int32_t> index1; /**< Second tap of every output pixel, clamped to the image */
+        std::vector<float>   weight; /**< Weight of the second tap */
+    };
+    /** Compute the bilinear sampling coefficients along one dimension
+     *
+     * @param[in]  src_size     Size of the source along the dimension
+     * @param[in]  dst_size     Size of the destination along the dimension
+     * @param[in]  element_size Distance in bytes between two consecutive source pixels. Use 1 to get indices rather than byte offsets.
+     * @param[out] table        Sampling coefficients. Padded to a multiple of 4 output pixels.
+     */
+    static void compute_table(int src_size, int dst_size, int element_size, SampleTable &table);
+    /** Common part of the configure functions
+     *
+     * @param[out] output  Destination tensor
+     * @param[in]  width   Width of the source image
+     * @param[in]  height  Height of the source image
+     * @param[in]  mean    Mean of each channel, in RGB order
+     * @param[in]  std_dev Standard deviation of each channel, in RGB order
+     * @param[in]  bgr     Store the blue channel in the first plane of @p output
+     */
+    void configure_common(ITensor *output, int width, int height, const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr);
+    /** Preprocess an interleaved RGB image
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void preprocess_rgb(const Window &window);
+    /** Preprocess a NV12/NV21 image
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void preprocess_nv(const Window &window);
+
+    using PreprocessFunction = void (NEImagePreprocessKernel::*)(const Window &window);
+
+    PreprocessFunction   _func;
+    const IImage        *_input;
+    const IMultiImage   *_multi_input;
+    ITensor             *_output;
+    std::array<float, 3> _scale;     /**< Multiplier of each output plane */
+    std::array<float, 3> _bias;      /**< Offset of each output plane */
+    std::array<int, 3>   _channel;   /**< Source channel (R = 0, G = 1, B = 2) of each output plane */
+    SampleTable          _table_x;   /**< Horizontal coefficients of the RGB or luma plane */
+    SampleTable          _table_y;   /**< Vertical coefficients of the RGB or luma plane */
+    SampleTable          _table_uvx; /**< Horizontal coefficients of the chroma plane */
+    SampleTable          _table_uvy; /**< Vertical coefficients of the chroma plane */
+    unsigned int         _u_offset;  /**< Offset of U within an interleaved chroma pixel */
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEIMAGEPREPROCESSKERNEL_H__ */
@@ -47,7 +47,11 @@ struct NELKInternalKeypoint
 
 using INELKInternalKeypointArray = IArray<NELKInternalKeypoint>;
 
-/** Interface for the Lucas-Kanade tracker kernel */
+/** Interface for the Lucas-Kanade tracker kernel
+ *
+ * The keypoints of a window are tracked in batches of 4: the motion of the whole batch is solved at once and a lane whose
+ * keypoint terminates is immediately handed over to the next keypoint of the window.
+ */
 class NELKTrackerKernel : public INEKernel
 {
 public:
@@ -106,24 +110,27 @@ private:
      */
     void init_keypoints(int start, int end);
     /** Compute the structure tensor A^T * A based on the scharr gradients I_x and I_y
+     *
+     * The window of the old tensor around the keypoint is interpolated at the same time: it does not change while the keypoint is tracked.
      *
      * @param[in]  keypoint    Keypoint for which gradients are computed
      * @param[out] bilinear_ix Intermediate interpolated data for X gradient
      * @param[out] bilinear_iy Intermediate interpolated data for Y gradient
+     * @param[out] bilinear_i  Intermediate interpolated data for the old tensor
      *
      * @return Values A11, A12, A22
      */
-    std::tuple<int, int, int> compute_spatial_gradient_matrix(const NELKInternalKeypoint &keypoint, int32_t *bilinear_ix, int32_t *bilinear_iy);
+    std::tuple<int, int, int> compute_spatial_gradient_matrix(const NELKInternalKeypoint &keypoint, int32_t *bilinear_ix, int32_t *bilinear_iy, int32_t *bilinear_i);
     /** Compute the vector A^T * b, i.e. -sum(I_d * I_t) for d in {x,y}
      *
-     * @param[in] old_keypoint Old keypoint for which gradient is computed
      * @param[in] new_keypoint New keypoint for which gradient is computed
      * @param[in] bilinear_ix  Intermediate interpolated data for X gradient
      * @param[in] bilinear_iy  Intermediate interpolated data for Y gradient
+     * @param[in] bilinear_i   Intermediate interpolated data for the old tensor
      *
      * @return Values b1, b2
      */
-    std::pair<int, int> compute_image_mismatch_vector(const NELKInternalKeypoint &old_keypoint, const NELKInternalKeypoint &new_keypoint, const int32_t *bilinear_ix, const int32_t *bilinear_iy);
+    std::pair<int, int> compute_image_mismatch_vector(const NELKInternalKeypoint &new_keypoint, const int32_t *bilinear_ix, const int32_t *bilinear_iy, const int32_t *bilinear_i);
 
     const ITensor              *_input_old;
     const ITensor              *_input_new;
@@ -98,6 +98,52 @@ private:
     ITensor                  *_phase;     /**< Output - Phase */
 };
 
+/** Template interface for the kernel to compute the centered point derivatives ([-1 0 1] and [-1 0 1]^T) of an U8 image
+ *  together with their magnitude and phase.
+ *
+ * The gradients are only kept in registers, which avoids writing and reading back the two S16 gradient images
+ * required by @ref NEDerivativeKernel followed by @ref NEMagnitudePhaseKernel. The results are identical.
+ */
+template <MagnitudeType mag_type, PhaseType phase_type>
+class NEDerivativeMagnitudePhaseKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDerivativeMagnitudePhaseKernel";
+    }
+    /** Default constructor */
+    NEDerivativeMagnitudePhaseKernel();
+    /** Destructor */
+    ~NEDerivativeMagnitudePhaseKernel() = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDerivativeMagnitudePhaseKernel(const NEDerivativeMagnitudePhaseKernel &) = delete;
+    /** Default move constructor */
+    NEDerivativeMagnitudePhaseKernel(NEDerivativeMagnitudePhaseKernel &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDerivativeMagnitudePhaseKernel &operator=(const NEDerivativeMagnitudePhaseKernel &) = delete;
+    /** Default move assignment operator */
+    NEDerivativeMagnitudePhaseKernel &operator=(NEDerivativeMagnitudePhaseKernel &&) = default;
+
+    /** Initialise the kernel's input, outputs and border mode.
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] magnitude        The output tensor - Magnitude. Data type supported: S16.
+     * @param[out] phase            The output tensor - Phase. Data type supported: U8.
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *magnitude, ITensor *phase, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    BorderSize border_size() const override;
+
+private:
+    const ITensor *_input;     /**< Source tensor */
+    ITensor       *_magnitude; /**< Output - Magnitude */
+    ITensor       *_phase;     /**< Output - Phase */
+};
+
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 /** Template interface for the kernel to compute magnitude and phase */
 template <MagnitudeType mag_type, PhaseType phase_type>
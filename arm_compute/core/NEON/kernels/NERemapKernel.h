@@ -54,13 +54,17 @@ public:
 
     /** Initialize the kernel's input, output and border mode.
      *
-     * @param[in]  input  Source tensor. Data type supported: U8.
-     * @param[in]  map_x  Map for X coordinates. Data type supported: F32.
-     * @param[in]  map_y  Map for Y coordinates. Data type supported: F32.
-     * @param[out] output Destination tensor. Data types supported: U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. remapping is only performed within the XY-plane.
-     * @param[in]  policy The interpolation type.
+     * A map can be compressed: either stored in QS16 fixed point or sub-sampled. A sub-sampled map holds the coordinates of every
+     * @p map_subsampling th pixel in each direction, the coordinates in between are bilinearly interpolated.
+     *
+     * @param[in]  input           Source tensor. Data type supported: U8.
+     * @param[in]  map_x           Map for X coordinates. Data type supported: F32/QS16.
+     * @param[in]  map_y           Map for Y coordinates. Data type supported: Same as @p map_x.
+     * @param[out] output          Destination tensor. Data types supported: U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. remapping is only performed within the XY-plane.
+     * @param[in]  policy          The interpolation type.
+     * @param[in]  map_subsampling (Optional) Sub-sampling factor of the maps. Each map dimension must be DIV_CEIL(output dimension - 1, @p map_subsampling) + 1.
      */
-    void configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy);
+    void configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy, unsigned int map_subsampling = 1);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -71,13 +75,22 @@ private:
     void remap_nearest(const Window &window);
     /** function to perform bilinear interpolation on the given window */
     void remap_bilinear(const Window &window);
+    /** function to perform the interpolation on the given window from a compressed map
+     *
+     * @tparam interpolation Interpolation type
+     * @tparam T             Data type of the map nodes
+     */
+    template <InterpolationPolicy interpolation, typename T>
+    void remap_compressed(const Window &window);
     /** Remap function to use for the particular interpolation type passed to configure() */
     void (NERemapKernel::*_func)(const Window &window);
 
-    const ITensor *_input;  /**< Input image */
-    ITensor       *_output; /**< Output image */
-    const ITensor *_map_x;  /**< Input remap x coordinates */
-    const ITensor *_map_y;  /**< Input remap y coordinates */
+    const ITensor *_input;           /**< Input image */
+    ITensor       *_output;          /**< Output image */
+    const ITensor *_map_x;           /**< Input remap x coordinates */
+    const ITensor *_map_y;           /**< Input remap y coordinates */
+    unsigned int   _map_subsampling; /**< Sub-sampling factor of the maps */
+    float          _map_scale;       /**< Scale converting the map nodes to coordinates */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEREMAPKERNEL_H__ */
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NERESIZEKERNEL_H__
+#define __ARM_COMPUTE_NERESIZEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to resize an image in a single pass using separable coefficient tables
+ *
+ * For every output column and every output row the kernel pre-computes the source pixels and the fixed point weights
+ * of the interpolation, so the tables take O(width + height) memory. Each output row is computed from the horizontal
+ * pass of the source rows it needs, which are kept in a per-thread line buffer and reused by the following output rows.
+ *
+ * Source pixels outside of the image are clamped to the closest edge pixel, which is equivalent to @ref BorderMode::REPLICATE.
+ */
+class NEResizeKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEResizeKernel";
+    }
+    /** Default constructor */
+    NEResizeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEResizeKernel(const NEResizeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEResizeKernel &operator=(const NEResizeKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEResizeKernel(NEResizeKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEResizeKernel &operator=(NEResizeKernel &&) = default;
+    /** Default destructor */
+    ~NEResizeKernel() = default;
+
+    /** Initialise the kernel's input, output and interpolation policy
+     *
+     * @param[in]  input           Source tensor. Formats supported: U8/RGB888/RGBA8888.
+     * @param[out] output          Destination tensor. Format supported: same as @p input.
+     *                             All but the lowest two dimensions must be the same size as in the input tensor.
+     * @param[in]  policy          Interpolation type to use.
+     * @param[in]  sampling_policy (Optional) Sampling policy used by the interpolation. Defaults to @ref SamplingPolicy::CENTER. Ignored for @ref InterpolationPolicy::AREA.
+     */
+    void configure(const ITensor *input, ITensor *output, InterpolationPolicy policy, SamplingPolicy sampling_policy = SamplingPolicy::CENTER);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEResizeKernel
+     *
+     * @param[in] input           Source tensor info. Formats supported: U8/RGB888/RGBA8888.
+     * @param[in] output          Destination tensor info. Format supported: same as @p input.
+     * @param[in] policy          Interpolation type to use.
+     * @param[in] sampling_policy (Optional) Sampling policy used by the interpolation. Defaults to @ref SamplingPolicy::CENTER.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, InterpolationPolicy policy, SamplingPolicy sampling_policy = SamplingPolicy::CENTER);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Interpolation coefficients along one dimension */
+    struct ResizeTable
+    {
+        unsigned int         num_taps; /**< Number of source pixels contributing to an output pixel */
+        std::vector<int32_t> start;    /**< First source pixel of every output pixel. Not clamped to the image */
+        std::vector<int16_t> weights;  /**< Fixed point weights of the taps of every output pixel */
+    };
+    /** Compute the interpolation coefficients along one dimension
+     *
+     * @param[in]  src_size        Size of the source along the dimension
+     * @param[in]  dst_size        Size of the destination along the dimension
+     * @param[in]  policy          Interpolation type to use
+     * @param[in]  sampling_policy Sampling policy used by the interpolation
+     * @param[out] table           Interpolation coefficients
+     */
+    static void compute_table(int src_size, int dst_size, InterpolationPolicy policy, SamplingPolicy sampling_policy, ResizeTable &table);
+    /** Compute the horizontal pass of a source row
+     *
+     * @param[in]  in      Pointer to the start of the source row
+     * @param[in]  x_start First output column
+     * @param[in]  x_end   One past the last output column
+     * @param[out] line    Destination line
+     */
+    void horizontal_pass(const uint8_t *in, int x_start, int x_end, int32_t *line) const;
+
+    const ITensor       *_input;
+    ITensor             *_output;
+    unsigned int         _num_channels; /**< Number of interleaved channels */
+    ResizeTable          _table_x;      /**< Horizontal coefficients */
+    ResizeTable          _table_y;      /**< Vertical coefficients */
+    std::vector<int32_t> _x_offsets;    /**< Byte offsets of the taps of every output column, clamped to the image */
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NERESIZEKERNEL_H__ */
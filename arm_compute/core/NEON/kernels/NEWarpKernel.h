@@ -33,7 +33,12 @@ namespace arm_compute
 {
 class ITensor;
 
-/** Common interface for warp affine and warp perspective */
+/** Common interface for warp affine and warp perspective
+ *
+ * The output is processed in 2D tiles so that the source pixels read by a tile stay in the L1 cache whatever the
+ * transformation. Tiles whose source coordinates all fall in the valid region of the input are computed with
+ * fixed point coordinates and vectorised bilinear blending, the other ones with the per-pixel border handling.
+ */
 class INEWarpKernel : public INEKernel
 {
 public:
@@ -79,6 +84,26 @@ protected:
      * @param[in] window Region on which to execute the kernel
      */
     virtual void warp_replicate(const Window &window) = 0;
+    /** Check whether the source coordinates of all the pixels of a tile fall in the valid region of the input
+     *
+     * @param[in] tile Region of the output to check
+     *
+     * @return True if no pixel of @p tile needs the border handling
+     */
+    virtual bool is_interior(const Window &tile) const = 0;
+    /** function to perform warp affine or warp perspective on a tile whose source coordinates all fall in the valid region of the input
+     *
+     * @param[in] tile Region on which to execute the kernel
+     */
+    virtual void warp_interior(const Window &tile) = 0;
+    /** Check whether a source coordinate can be read without border handling
+     *
+     * @param[in] x X source coordinate
+     * @param[in] y Y source coordinate
+     *
+     * @return True if (@p x, @p y) falls in the valid region of the input, with a margin for the fixed point rounding
+     */
+    bool is_inside(float x, float y) const;
     /** Common signature for all the specialised warp functions
      *
      * @param[in] window Region on which to execute the kernel.
@@ -106,6 +131,8 @@ private:
     void warp_undefined(const Window &window) override;
     void warp_constant(const Window &window) override;
     void warp_replicate(const Window &window) override;
+    bool is_interior(const Window &tile) const override;
+    void warp_interior(const Window &tile) override;
 };
 
 /** Template interface for the kernel to compute warp perspective
@@ -123,6 +150,8 @@ private:
     void warp_undefined(const Window &window) override;
     void warp_constant(const Window &window) override;
     void warp_replicate(const Window &window) override;
+    bool is_interior(const Window &tile) const override;
+    void warp_interior(const Window &tile) override;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEWARPKERNEL_H__ */
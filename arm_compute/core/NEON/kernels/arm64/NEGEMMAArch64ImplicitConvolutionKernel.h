@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMAARCH64IMPLICITCONVOLUTIONKERNEL_H__
+#define __ARM_COMPUTE_NEGEMMAARCH64IMPLICITCONVOLUTIONKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** AArch64 NEON kernel to compute a convolution as an implicit GEMM.
+ *
+ * The kernel computes the same result as running @ref NEIm2ColKernel followed by @ref NEGEMMAArch64Kernel,
+ * but the interleaved panels of the matrix A are gathered directly from the input volume block by block,
+ * so the im2col matrix is never stored in memory.
+ *
+ * Grouped convolutions are computed in the same run: group g convolves input channels [g * IFM / groups, (g + 1) * IFM / groups)
+ * with the columns [g * OFM / groups, (g + 1) * OFM / groups) of the reshaped weights.
+ */
+class NEGEMMAArch64ImplicitConvolutionKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGEMMAArch64ImplicitConvolutionKernel";
+    }
+    /** Default constructor */
+    NEGEMMAArch64ImplicitConvolutionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMAArch64ImplicitConvolutionKernel(const NEGEMMAArch64ImplicitConvolutionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMAArch64ImplicitConvolutionKernel &operator=(const NEGEMMAArch64ImplicitConvolutionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMAArch64ImplicitConvolutionKernel(NEGEMMAArch64ImplicitConvolutionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMAArch64ImplicitConvolutionKernel &operator=(NEGEMMAArch64ImplicitConvolutionKernel &&) = default;
+    /** Default destructor */
+    ~NEGEMMAArch64ImplicitConvolutionKernel() = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input       Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                         while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F32
+     * @param[in]  weights     Weights reshaped by @ref NEWeightsReshapeKernel (without 1xW transposition), with shape [OFM, kernel_width * kernel_height * IFM / num_groups (+1 if @p has_bias)].
+     *                         Data types supported: Same as @p input
+     * @param[out] output      GEMM output tensor with shape [OFM, conv_w * conv_h, 1, batches]. Data types supported: Same as @p input
+     * @param[out] workspace   Space for the interleaved panels.
+     * @param[in]  kernel_dims The kernel dimensions (width and height).
+     * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  has_bias    In case biases are appended to @p weights, the matrix A is extended with a column of ones.
+     * @param[in]  num_groups  (Optional) Number of groups the input and output feature maps are split into. Defaults to 1.
+     */
+    void configure(const ITensor *input, const ITensor *weights, ITensor *output, ITensor *workspace, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias,
+                   unsigned int num_groups = 1);
+    /** Size in bytes of the workspace required by the kernel
+     *
+     * @param[in] ci          CPU information
+     * @param[in] M           Number of output points per plane (conv_w * conv_h)
+     * @param[in] N           Number of output feature maps of a single group
+     * @param[in] K           Number of rows of the reshaped weights
+     * @param[in] num_threads Number of threads the kernel will be scheduled on
+     *
+     * @return the size of the workspace in bytes
+     */
+    static size_t get_workspace_size(const CPUInfo &ci, unsigned int M, unsigned int N, unsigned int K, unsigned int num_threads);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    const ITensor *_weights;
+    ITensor       *_output;
+    ITensor       *_workspace;
+    Size2D         _kernel_dims;
+    PadStrideInfo  _conv_info;
+    unsigned int   _conv_w;
+    bool           _has_bias;
+    unsigned int   _num_groups;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEGEMMAARCH64IMPLICITCONVOLUTIONKERNEL_H__*/
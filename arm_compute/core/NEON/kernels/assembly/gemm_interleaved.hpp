@@ -29,6 +29,7 @@
 #include "gemm_common.hpp"
 #include "profiler.hpp"
 #include "transform.hpp"
+#include "transform_im2col.hpp"
 #include "mergeresults.hpp"
 
 // Some macros used to decide how much working space to allocate.
@@ -118,8 +119,113 @@ public:
 
     }
 
+    // Size of the buffer needed by pretranspose_B_array().  The layout of
+    // the panels only depends on N, K and the cache sizes, not on M.
+    size_t get_B_pretransposed_array_size() const {
+        return get_b_working_size() * get_num_k_blocks() * get_num_x_blocks() + 0x10;
+    }
+
+    // Interleave the whole matrix B once, so that several GEMMs sharing it
+    // (or several threads working on different rows) can skip the
+    // per-block B transforms with execute_pretransposed_B().
+    void pretranspose_B_array(void *buffer, const To *B, const int ldb) const {
+        Toi * const b_panels = align_panels(buffer);
+
+        for (unsigned int k0=0; k0<K; k0 += k_block) {
+            unsigned int kmax = k0 + k_block;
+            if (kmax > K) kmax = K;
+
+            for (unsigned int x0=0; x0<N; x0 += x_block) {
+                unsigned int xmax = x0 + x_block;
+                if (xmax > N) xmax = N;
+
+                transform_B(b_panels + get_b_panel_offset(k0, x0), B, ldb, x0, xmax, k0, kmax);
+            }
+        }
+    }
+
     // Actually execute the GEMM.
     void execute(const To *A, const int lda, const To *B, const int ldb, Tr *C, const int ldc, const Tr alpha, const Tr beta, void *working_space) const override {
+        execute_internal([&](Toi *a_panel, unsigned int k0, unsigned int kmax) {
+            transform_A(a_panel, A, lda, k0, kmax);
+        }, [&](Toi *b_panel, unsigned int x0, unsigned int xmax, unsigned int k0, unsigned int kmax) -> const Toi * {
+            transform_B(b_panel, B, ldb, x0, xmax, k0, kmax);
+            return b_panel;
+        }, C, ldc, alpha, beta, working_space);
+    }
+
+    // Execute the GEMM with a matrix B previously interleaved by
+    // pretranspose_B_array() from an object with the same N, K and CPU
+    // information.
+    void execute_pretransposed_B(const To *A, const int lda, const void *B_pretransposed, Tr *C, const int ldc, const Tr alpha, const Tr beta, void *working_space) const {
+        const Toi * const b_panels = align_panels(const_cast<void *>(B_pretransposed));
+
+        execute_internal([&](Toi *a_panel, unsigned int k0, unsigned int kmax) {
+            transform_A(a_panel, A, lda, k0, kmax);
+        }, [&](Toi *, unsigned int x0, unsigned int, unsigned int k0, unsigned int) -> const Toi * {
+            return b_panels + get_b_panel_offset(k0, x0);
+        }, C, ldc, alpha, beta, working_space);
+    }
+
+    // Execute the GEMM of a convolution, reading the A matrix as an implicit
+    // im2col of the input volume described by "im2col".  The A panels are
+    // gathered straight from the input so the full im2col matrix is never
+    // materialised.  trA is ignored.
+    void execute_im2col(const Im2ColParams<To> &im2col, const To *B, const int ldb, Tr *C, const int ldc, const Tr alpha, const Tr beta, void *working_space) const {
+        static_assert(strategy::A_transpose == 0, "Implicit im2col requires an untransposed A operand");
+
+        execute_internal([&](Toi *a_panel, unsigned int k0, unsigned int kmax) {
+            TransformIm2Col<strategy::A_interleave, strategy::A_block>(a_panel, im2col, 0, M, k0, kmax);
+        }, [&](Toi *b_panel, unsigned int x0, unsigned int xmax, unsigned int k0, unsigned int kmax) -> const Toi * {
+            transform_B(b_panel, B, ldb, x0, xmax, k0, kmax);
+            return b_panel;
+        }, C, ldc, alpha, beta, working_space);
+    }
+
+private:
+    unsigned int get_num_k_blocks() const {
+        return (K + k_block - 1) / k_block;
+    }
+
+    unsigned int get_num_x_blocks() const {
+        return (N + x_block - 1) / x_block;
+    }
+
+    // Offset (in operands) of the pretransposed panel of block (k0, x0).
+    size_t get_b_panel_offset(unsigned int k0, unsigned int x0) const {
+        return ((k0 / k_block) * get_num_x_blocks() + (x0 / x_block)) * (get_b_working_size() / sizeof(Toi));
+    }
+
+    // The panels are aligned to 16 bytes, as in the working space.
+    static Toi *align_panels(void *buffer) {
+        int8_t *buffer_bytes = reinterpret_cast<int8_t *>(buffer);
+        intptr_t buffer_int = reinterpret_cast<intptr_t>(buffer_bytes);
+
+        return reinterpret_cast<Toi *>(buffer_bytes + ((buffer_int & 0xF) ? (0x10 - (buffer_int & 0xF)) : 0));
+    }
+
+    void transform_A(Toi *a_panel, const To *A, const int lda, unsigned int k0, unsigned int kmax) const {
+        if (trA ^ strategy::A_transpose) {
+            Transform<strategy::A_interleave, strategy::A_block, true>(a_panel, A, lda, 0, M, k0, kmax);
+        } else {
+            Transform<strategy::A_interleave, strategy::A_block, false>(a_panel, A, lda, 0, M, k0, kmax);
+        }
+    }
+
+    void transform_B(Toi *b_panel, const To *B, const int ldb, unsigned int x0, unsigned int xmax, unsigned int k0, unsigned int kmax) const {
+        if (trB ^ strategy::B_transpose) {
+            Transform<strategy::B_interleave, strategy::B_block, true>(b_panel, B, ldb, x0, xmax, k0, kmax);
+        } else {
+            Transform<strategy::B_interleave, strategy::B_block, false>(b_panel, B, ldb, x0, xmax, k0, kmax);
+        }
+    }
+
+    // Blocked GEMM driver.  "prep_a" fills the A panel for rows [0, M) and
+    // columns [k0, kmax).  "prep_b" returns the B panel for columns
+    // [x0, xmax) and rows [k0, kmax), either interleaved into the panel of
+    // the working space it is given or taken from a pretransposed array.
+    template <typename PrepA, typename PrepB>
+    void execute_internal(PrepA &&prep_a, PrepB &&prep_b, Tr *C, const int ldc, const Tr alpha, const Tr beta, void *working_space) const {
         assert(working_space);
         profiler prof;
         int8_t *working_space_bytes = reinterpret_cast<int8_t *>(working_space);
@@ -142,13 +248,7 @@ public:
             int kern_k = ((kmax - k0) + (strat.k_unroll - 1)) / strat.k_unroll;
             kern_k *= strat.k_unroll;
 
-            prof(PROFILE_PREPA, (M * (kmax-k0) * sizeof(Toi)), [&](void) {
-                if (trA ^ strategy::A_transpose) {
-                    Transform<strategy::A_interleave, strategy::A_block, true>(a_panel, A, lda, 0, M, k0, kmax);
-                } else {
-                    Transform<strategy::A_interleave, strategy::A_block, false>(a_panel, A, lda, 0, M, k0, kmax);
-                }
-            });
+            prof(PROFILE_PREPA, (M * (kmax-k0) * sizeof(Toi)), [&](void) { prep_a(a_panel, k0, kmax); });
 
             for (unsigned int x0=0; x0<N; x0 += x_block) {
                 unsigned int xmax = x0 + x_block;
@@ -156,19 +256,14 @@ public:
 
                 int bblocks = (xmax - x0 + strat.out_width - 1) / strat.out_width;
 
-                prof(PROFILE_PREPB, (xmax-x0) * (kmax-k0) * sizeof(Toi), [&](void) {
-                    if (trB ^ strategy::B_transpose) {
-                        Transform<strategy::B_interleave, strategy::B_block, true>(b_panel, B, ldb, x0, xmax, k0, kmax);
-                    } else {
-                        Transform<strategy::B_interleave, strategy::B_block, false>(b_panel, B, ldb, x0, xmax, k0, kmax);
-                    }
-                });
+                const Toi *b_block = nullptr;
+                prof(PROFILE_PREPB, (xmax-x0) * (kmax-k0) * sizeof(Toi), [&](void) { b_block = prep_b(b_panel, x0, xmax, k0, kmax); });
 
                 for (unsigned int y=0; y<M; y+=strat.out_height) {
                     unsigned int ymax = y + strat.out_height;
                     if (ymax > M) ymax = M;
 
-                    prof(PROFILE_KERNEL, (strat.out_height * bblocks * strat.out_width * kern_k), [&](void) { strat.kernel(a_panel + (y * kern_k), b_panel, c_panel, 1, bblocks, kern_k); });
+                    prof(PROFILE_KERNEL, (strat.out_height * bblocks * strat.out_width * kern_k), [&](void) { strat.kernel(a_panel + (y * kern_k), b_block, c_panel, 1, bblocks, kern_k); });
                     prof(PROFILE_MERGE, (strat.out_height * bblocks * strat.out_width * sizeof(Tr)), [&](void) { MergeResults<strategy::out_width, strategy::out_height>(C, c_panel, ldc, y, ymax, x0, xmax, alpha, (k0==0 ? beta : static_cast<Tr>(1))); });
                 }
             }
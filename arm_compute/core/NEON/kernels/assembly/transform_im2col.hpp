@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/*
+ * Description of an implicit im2col matrix.
+ *
+ * Row "m" of the matrix holds the input values which contribute to output
+ * point "m" of the convolution, in the same order as NEIm2ColKernel lays
+ * them out: input channel, then kernel row, then kernel column, followed by
+ * a single 1 if the weights have the bias appended.  Out of bounds input
+ * positions read as 0.
+ *
+ * All strides are expressed in elements.
+ */
+template <typename T>
+struct Im2ColParams {
+    const T *input;         // First element of the input volume.
+    int stride_x;
+    int stride_y;
+    int stride_z;
+    int input_w;
+    int input_h;
+    int input_c;
+    int kernel_w;
+    int kernel_h;
+    int conv_stride_x;
+    int conv_stride_y;
+    int pad_left;
+    int pad_top;
+    int conv_w;             // Width of the convolved output plane.
+    int row_offset;         // Added to every row index (for partial windows).
+    bool has_bias;
+};
+
+/*
+ * Interleaving transform which reads from an implicit im2col matrix.
+ *
+ * Produces exactly the same layout as the untransposed generic Transform()
+ * applied to the im2col matrix, but gathers each value straight from the
+ * input volume so the im2col matrix never has to exist in memory.  Only the
+ * [y0, ymax) x [k0, kmax) block required by the current GEMM panel is
+ * touched.
+ */
+template <unsigned int IntBy, unsigned int BlockBy, typename TOut, typename TIn>
+void TransformIm2Col(TOut *out, const Im2ColParams<TIn> &p, const int y0, const int ymax, const int k0, const int kmax) {
+    const int patch_size = p.kernel_w * p.kernel_h * p.input_c;
+
+    // Top left input coordinate of each row in the current block of rows.
+    int row_x[IntBy];
+    int row_y[IntBy];
+    int row_offset[IntBy];
+
+    // Kernel coordinate and input offset of each column in the current block of columns.
+    int col_x[BlockBy];
+    int col_y[BlockBy];
+    int col_offset[BlockBy];
+    bool col_is_bias[BlockBy];
+
+    for (int y_base = y0; y_base < ymax; y_base += IntBy) {
+        const int fill_rows = (ymax - y_base) < static_cast<int>(IntBy) ? (ymax - y_base) : static_cast<int>(IntBy);
+
+        for (int row = 0; row < fill_rows; row++) {
+            const int m = p.row_offset + y_base + row;
+            row_x[row] = (m % p.conv_w) * p.conv_stride_x - p.pad_left;
+            row_y[row] = (m / p.conv_w) * p.conv_stride_y - p.pad_top;
+            row_offset[row] = row_y[row] * p.stride_y + row_x[row] * p.stride_x;
+        }
+
+        // Split the first K index into (channel, kernel row, kernel column)
+        // once, then step the three counters along with K.
+        int kx = k0 % p.kernel_w;
+        int ky = (k0 / p.kernel_w) % p.kernel_h;
+        int kz = k0 / (p.kernel_w * p.kernel_h);
+
+        for (int x_base = k0; x_base < kmax; x_base += BlockBy) {
+            const int fill_cols = (kmax - x_base) < static_cast<int>(BlockBy) ? (kmax - x_base) : static_cast<int>(BlockBy);
+
+            for (int col = 0; col < fill_cols; col++) {
+                col_x[col] = kx;
+                col_y[col] = ky;
+                col_offset[col] = kz * p.stride_z + ky * p.stride_y + kx * p.stride_x;
+                col_is_bias[col] = (x_base + col) >= patch_size;
+
+                if (++kx == p.kernel_w) {
+                    kx = 0;
+                    if (++ky == p.kernel_h) {
+                        ky = 0;
+                        kz++;
+                    }
+                }
+            }
+
+            for (int row = 0; row < fill_rows; row++) {
+                for (int col = 0; col < fill_cols; col++) {
+                    const int ix = row_x[row] + col_x[col];
+                    const int iy = row_y[row] + col_y[col];
+
+                    if (col_is_bias[col]) {
+                        *out++ = static_cast<TOut>(1);
+                    } else if (ix < 0 || ix >= p.input_w || iy < 0 || iy >= p.input_h) {
+                        *out++ = static_cast<TOut>(0);
+                    } else {
+                        *out++ = static_cast<TOut>(p.input[row_offset[row] + col_offset[col]]);
+                    }
+                }
+                // "col" tail - row is in range but column is out of range.
+                for (int col = fill_cols; col < static_cast<int>(BlockBy); col++) {
+                    *out++ = static_cast<TOut>(0);
+                }
+            }
+            // "row" tail - row is out of range so fill with zeros always.
+            for (int row = fill_rows; row < static_cast<int>(IntBy); row++) {
+                for (int col = 0; col < static_cast<int>(BlockBy); col++) {
+                    *out++ = static_cast<TOut>(0);
+                }
+            }
+        }
+    }
+}
@@ -211,6 +211,31 @@ public:
      * @param[in] height   Height of the 2D tensor where the HOG descriptor will be computed on
      */
     size_t init_auto_padding(const HOGInfo &hog_info, unsigned int width, unsigned int height);
+    /** Initialize the metadata structure for the given tensor shape and single-plane format, with rows @p row_stride_in_bytes apart
+     *
+     * The whole elements between the end of a row and the beginning of the next one are exposed as right padding,
+     * so that the tensor can describe externally allocated images (e.g. camera frames) imported with @ref TensorAllocator::import_memory.
+     *
+     * @note Import the memory before configuring the functions using the tensor: importing makes the padding fixed,
+     *       otherwise the functions could extend it and change the row stride.
+     *
+     * @param[in] tensor_shape        It specifies the size for each dimension of the tensor in number of elements
+     * @param[in] format              Single plane format of the image.
+     * @param[in] row_stride_in_bytes Distance in bytes between the beginning of two consecutive rows. Must be at least the size of a row.
+     */
+    void init_with_row_stride(const TensorShape &tensor_shape, Format format, size_t row_stride_in_bytes);
+    /** Initialize the metadata structure for the given tensor shape, number of channels, data type and fixed point position,
+     *  with rows @p row_stride_in_bytes apart
+     *
+     * @note See @ref init_with_row_stride(const TensorShape &, Format, size_t)
+     *
+     * @param[in] tensor_shape         It specifies the size for each dimension of the tensor in number of elements
+     * @param[in] num_channels         It indicates the number of channels for each tensor element
+     * @param[in] data_type            Data type to use for each tensor element
+     * @param[in] row_stride_in_bytes  Distance in bytes between the beginning of two consecutive rows. Must be at least the size of a row.
+     * @param[in] fixed_point_position (Optional) Fixed point position that expresses the number of bits for the fractional part of the number when the tensor's data type is QS8 or QS16.
+     */
+    void init_with_row_stride(const TensorShape &tensor_shape, size_t num_channels, DataType data_type, size_t row_stride_in_bytes, int fixed_point_position = 0);
 
     // Inherited methods overridden:
     std::unique_ptr<ITensorInfo> clone() const override;
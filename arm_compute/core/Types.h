@@ -311,6 +311,7 @@ enum class InterpolationPolicy
     NEAREST_NEIGHBOR, /**< Output values are defined to match the source pixel whose center is nearest to the sample position */
     BILINEAR,         /**< Output values are defined by bilinear interpolation between the pixels */
     AREA,             /**< Output values are determined by averaging the source pixels whose areas fall under the area of the destination pixel, projected onto the source image */
+    BICUBIC,          /**< Output values are defined by bicubic interpolation between the pixels (Only supported by @ref NEResize) */
 };
 
 /** Bilinear Interpolation method used by LKTracker */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_LOGGING_ASYNC_PRINTER_H__
+#define __ARM_COMPUTE_LOGGING_ASYNC_PRINTER_H__
+
+#include "arm_compute/core/utils/logging/IPrinter.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#ifndef NO_MULTI_THREADING
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif /* NO_MULTI_THREADING */
+
+namespace arm_compute
+{
+namespace logging
+{
+/** Asynchronous printer
+ *
+ * Messages are copied into a bounded lock-free ring buffer and printed by a background
+ * thread to the wrapped printer, so logging never blocks the calling thread on I/O.
+ *
+ * - The memory used is fixed at construction: capacity * record_size bytes.
+ * - Messages longer than the record size are truncated, see @ref truncated().
+ * - Messages logged while the buffer is full are dropped, see @ref dropped(). The number of
+ *   dropped messages is also reported through the wrapped printer.
+ * - All the messages queued are printed before the destructor returns, and @ref flush() can be
+ *   used to wait for the messages queued so far, e.g. before the process is terminated abnormally.
+ *
+ * Example:
+ * @code{.cpp}
+ * LoggerRegistry::get().create_reserved_loggers(LogLevel::INFO, { std::make_shared<AsyncPrinter>(std::make_shared<StdPrinter>()) });
+ * @endcode
+ *
+ * @note If the library is built without multi-threading support the messages are printed synchronously.
+ */
+class AsyncPrinter final : public Printer
+{
+public:
+    /** Constructor
+     *
+     * @param[in] printer     Printer to print the messages to from the background thread.
+     * @param[in] capacity    (Optional) Maximum number of messages waiting to be printed. Rounded up to a power of 2.
+     * @param[in] record_size (Optional) Maximum size in bytes of a message.
+     */
+    AsyncPrinter(std::shared_ptr<Printer> printer, size_t capacity = 1024, size_t record_size = 512);
+    /** Destructor: prints all the pending messages and stops the background thread */
+    ~AsyncPrinter();
+    /** Queue a message to be printed, never blocks.
+     *
+     * @param[in] msg Message to print
+     */
+    void print(const std::string &msg) override;
+    /** Wait until all the messages queued before the call have been printed */
+    void flush();
+    /** Number of messages dropped because the buffer was full
+     *
+     * @return Number of messages dropped since the printer was created.
+     */
+    uint64_t dropped() const;
+    /** Number of messages truncated because they were longer than the record size
+     *
+     * @return Number of messages truncated since the printer was created.
+     */
+    uint64_t truncated() const;
+
+private:
+    // Inherited methods overridden:
+    void print_internal(const std::string &msg) override;
+
+#ifndef NO_MULTI_THREADING
+    /** Pop the oldest message from the buffer, only called by the background thread
+     *
+     * @param[out] msg Popped message
+     *
+     * @return False if the buffer was empty
+     */
+    bool pop(std::string &msg);
+    /** Function ran by the background thread */
+    void worker_thread();
+#endif /* NO_MULTI_THREADING */
+
+private:
+    std::shared_ptr<Printer> _printer;
+    std::atomic<uint64_t>    _dropped;
+    std::atomic<uint64_t>    _truncated;
+#ifndef NO_MULTI_THREADING
+    size_t                                 _capacity;
+    size_t                                 _record_size;
+    std::unique_ptr<std::atomic<size_t>[]> _sequences;
+    std::unique_ptr<size_t[]>              _lengths;
+    std::unique_ptr<char[]>                _records;
+    std::atomic<size_t>                    _enqueue_pos;
+    std::atomic<size_t>                    _dequeue_pos;
+    std::atomic<size_t>                    _printed_pos;
+    std::atomic<bool>                      _idle;
+    bool                                   _stop;
+    std::mutex                             _mtx;
+    std::condition_variable                _work_cv;
+    std::condition_variable                _flush_cv;
+    std::thread                            _thread;
+#endif /* NO_MULTI_THREADING */
+};
+} // namespace logging
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_LOGGING_ASYNC_PRINTER_H__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017 ARM Limited.
+ * Copyright (c) 2017-2018 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,10 +50,12 @@ public:
     /** Defaults Destructor */
     virtual ~Printer() = default;
     /** Print message
+     *
+     * @note The default implementation serializes the calls and prints the message synchronously.
      *
      * @param[in] msg Message to print
      */
-    inline void print(const std::string &msg)
+    virtual void print(const std::string &msg)
     {
         std::lock_guard<arm_compute::Mutex> lock(_mtx);
         print_internal(msg);
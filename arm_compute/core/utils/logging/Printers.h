@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017 ARM Limited.
+ * Copyright (c) 2017-2018 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_LOGGING_PRINTERS_H__
 #define __ARM_COMPUTE_LOGGING_PRINTERS_H__
 
+#include "arm_compute/core/utils/logging/AsyncPrinter.h"
 #include "arm_compute/core/utils/logging/FilePrinter.h"
 #include "arm_compute/core/utils/logging/IPrinter.h"
 #include "arm_compute/core/utils/logging/StdPrinter.h"
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_GRAPH_GRAPH_H__
 
 #include "arm_compute/core/CL/CLTypes.h"
+#include "arm_compute/graph/GraphProfiler.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/ITensorObject.h"
 #include "arm_compute/graph/SubTensor.h"
@@ -91,6 +92,20 @@ public:
      */
     GraphHints &hints();
 
+    /** Enables or disables the profiling of @ref run
+     *
+     * When enabled, the wall time of every stage of the pipeline and of every NEON kernel it schedules is recorded
+     * together with the time spent by each thread in the kernels.
+     *
+     * @param[in] enabled True to profile the following runs.
+     */
+    void set_profiling_enabled(bool enabled);
+    /** Returns the profiler holding the measurements of the profiled runs
+     *
+     * @return The profiler of the graph
+     */
+    GraphProfiler &profiler();
+
 private:
     class Private;
     std::unique_ptr<Private> _pimpl; /**< Internal implementation class */
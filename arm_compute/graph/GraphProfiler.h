@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_GRAPHPROFILER_H__
+#define __ARM_COMPUTE_GRAPH_GRAPHPROFILER_H__
+
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+class IFunction;
+
+namespace graph
+{
+/** Profiler recording the execution of the stages of a graph and of the NEON kernels they schedule
+ *
+ * While a profiled run is in progress the active scheduler is replaced by an interceptor which times
+ * every call to IScheduler::schedule() and every workload executed by the worker threads,
+ * the kernels are therefore attributed to the stage which scheduled them.
+ *
+ * @note A custom scheduler (Scheduler::Type::CUSTOM) can't be intercepted: only the stages are timed in that case.
+ */
+class GraphProfiler final
+{
+public:
+    /** Clock used for all the measurements */
+    using Clock = std::chrono::steady_clock;
+
+    /** Time spent by one thread running the workloads of a kernel */
+    struct ThreadMeasurement
+    {
+        double start_us{ -1.0 };   /**< Start of the first workload in microseconds since the profiler was reset (Negative if the thread didn't run any workload) */
+        double duration_us{ 0.0 }; /**< Accumulated duration of the workloads in microseconds */
+    };
+    /** Measurements of one kernel scheduled by a stage */
+    struct KernelMeasurement
+    {
+        std::string                    name{};             /**< Kernel name */
+        double                         start_us{ 0.0 };    /**< Call to schedule() in microseconds since the profiler was reset */
+        double                         duration_us{ 0.0 }; /**< Wall time spent in schedule() in microseconds */
+        std::vector<ThreadMeasurement> threads{};          /**< Workloads executed by each thread, indexed by thread id */
+    };
+    /** Measurements of one execution of a stage */
+    struct StageMeasurement
+    {
+        unsigned int                   stage{ 0 };         /**< Index of the stage in the pipeline */
+        double                         start_us{ 0.0 };    /**< Start of the stage in microseconds since the profiler was reset */
+        double                         duration_us{ 0.0 }; /**< Wall time of the stage in microseconds */
+        std::vector<KernelMeasurement> kernels{};          /**< Kernels scheduled by the stage */
+    };
+    /** Static description of a stage */
+    struct StageInfo
+    {
+        std::string name{};     /**< Name of the node (Or of the map / unmap operation) which created the stage */
+        size_t      bytes{ 0 }; /**< Size in bytes of the input and output tensors of the stage */
+    };
+
+    /** Default constructor */
+    GraphProfiler();
+    /** Prevent instances of this class from being copied */
+    GraphProfiler(const GraphProfiler &) = delete;
+    /** Prevent instances of this class from being copied */
+    GraphProfiler &operator=(const GraphProfiler &) = delete;
+    /** Destructor */
+    ~GraphProfiler();
+
+    /** Registers a new stage
+     *
+     * @param[in] name  Name of the stage
+     * @param[in] bytes Size in bytes of the input and output tensors of the stage
+     *
+     * @return Index of the stage
+     */
+    unsigned int add_stage(std::string name, size_t bytes);
+    /** Installs the scheduler interceptor. Must be called before the first call to @ref run_stage of a run */
+    void start();
+    /** Restores the scheduler which was active when @ref start was called */
+    void stop();
+    /** Runs and times a stage
+     *
+     * @param[in] stage    Index of the stage
+     * @param[in] function Function of the stage
+     * @param[in] sync     (Optional) Function to call before stopping the timer (e.g. to wait for an OpenCL queue to be empty)
+     */
+    void run_stage(unsigned int stage, IFunction &function, void (*sync)() = nullptr);
+    /** Discards all the measurements and resets the time origin */
+    void clear();
+
+    /** Returns the registered stages
+     *
+     * @return The stages in pipeline order
+     */
+    const std::vector<StageInfo> &stages() const;
+    /** Returns all the recorded measurements
+     *
+     * @return The measurements in execution order
+     */
+    const std::vector<StageMeasurement> &measurements() const;
+
+    /** Prints a per-layer summary aggregating all the recorded runs
+     *
+     * The summary contains for each stage the number of runs, average wall time, share of the total time,
+     * number of kernels, average thread utilisation, average scheduler wait time and effective bandwidth.
+     *
+     * @param[out] os Output stream
+     */
+    void print_summary(std::ostream &os) const;
+    /** Writes the measurements as Chrome trace events (JSON)
+     *
+     * The file can be loaded in chrome://tracing or https://ui.perfetto.dev.
+     * Stages and kernels are reported on the thread 0 of the process, the workloads of each worker thread on the following ones.
+     *
+     * @param[out] os Output stream
+     */
+    void export_chrome_trace(std::ostream &os) const;
+    /** Writes the measurements as Chrome trace events (JSON) to a file
+     *
+     * @param[in] filename Name of the file to create
+     */
+    void save_chrome_trace(const std::string &filename) const;
+
+    /** Records a kernel: called by the scheduler interceptor
+     *
+     * @param[in] kernel Kernel measurement
+     */
+    void add_kernel(KernelMeasurement &&kernel);
+    /** Converts a time point into microseconds since the profiler was reset
+     *
+     * @param[in] time Time point to convert
+     *
+     * @return The number of microseconds elapsed between the reset of the profiler and @p time
+     */
+    double to_us(Clock::time_point time) const;
+
+private:
+    std::vector<StageInfo>        _stages;
+    std::vector<StageMeasurement> _measurements;
+    StageMeasurement             *_current;
+    Clock::time_point             _origin;
+    std::shared_ptr<IScheduler>   _interceptor;
+    IScheduler                   *_real_scheduler;
+    Scheduler::Type               _real_scheduler_type;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_GRAPHPROFILER_H__ */
@@ -48,6 +48,11 @@ public:
      * @param[in] output Output tensor of the node
      */
     virtual std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) = 0;
+    /** Name of the node
+     *
+     * @return Node name
+     */
+    virtual const char *name() const = 0;
     /** Override the existing target hint
      *
      * @note If the input is DONT_CARE then the method has to pick a technology,
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_GRAPH_ITENSORACCESSOR_H__
 #define __ARM_COMPUTE_GRAPH_ITENSORACCESSOR_H__
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/graph/Types.h"
 
 namespace arm_compute
@@ -43,6 +44,19 @@ public:
      * @return True if access is successful else false
      */
     virtual bool access_tensor(ITensor &tensor) = 0;
+    /** Interface to be implemented by accessors able to provide the backing memory of a tensor without copying it
+     *
+     * @note Called instead of allocating the tensor. If it returns false, the tensor is allocated and filled through @ref access_tensor.
+     *
+     * @param[in] tensor Tensor to be backed. Not allocated yet.
+     *
+     * @return True if the tensor has been given its backing memory else false
+     */
+    virtual bool import_tensor(ITensor &tensor)
+    {
+        ARM_COMPUTE_UNUSED(tensor);
+        return false;
+    }
 };
 } // namespace graph
 } // namespace arm_compute
@@ -100,7 +100,7 @@ public:
      * @return TensorInfo of the tensor
      */
     const TensorInfo &info() const;
-    /** Allocates and fills the tensor if needed */
+    /** Allocates and fills the tensor if needed, or lets its accessor import the backing memory */
     void allocate_and_fill_if_needed();
 
     // Inherited methods overriden:
@@ -76,6 +76,10 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "BranchLayer";
+    }
 
 private:
     BranchMergeMethod                      _branch_merge_method;
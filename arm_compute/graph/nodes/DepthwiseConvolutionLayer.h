@@ -61,6 +61,10 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "DepthwiseConvolutionLayer";
+    }
 
 private:
     unsigned int           _conv_width;
@@ -39,6 +39,10 @@ class FlattenLayer final : public INode
 public:
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "FlattenLayer";
+    }
 };
 } // namespace graph
 } // namespace arm_compute
@@ -38,6 +38,10 @@ class FloorLayer final : public INode
 public:
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "FloorLayer";
+    }
 };
 
 } // namespace graph
@@ -52,6 +52,10 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "FullyConnectedLayer";
+    }
 
     // Inherited methods overriden:
 private:
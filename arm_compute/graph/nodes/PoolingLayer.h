@@ -45,6 +45,10 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "PoolingLayer";
+    }
 
 private:
     const PoolingLayerInfo _pool_info; /**< Pooling layer information */
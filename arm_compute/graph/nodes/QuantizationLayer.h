@@ -39,6 +39,10 @@ class QuantizationLayer final : public INode
 public:
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "QuantizationLayer";
+    }
 };
 } // namespace graph
 } // namespace arm_compute
@@ -67,6 +67,10 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "ResidualLayer";
+    }
 
 private:
     std::vector<std::unique_ptr<SubGraph>> _sub_graphs;
@@ -38,6 +38,10 @@ class SoftmaxLayer final : public INode
 public:
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensorObject *input, ITensorObject *output) override;
+    const char *name() const override
+    {
+        return "SoftmaxLayer";
+    }
 };
 } // namespace graph
 } // namespace arm_compute
@@ -25,6 +25,9 @@
 #define __ARM_COMPUTE_ISCHEDULER_H__
 
 #include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/runtime/SchedulerCounters.h"
+
+#include <atomic>
 
 namespace arm_compute
 {
@@ -79,8 +82,41 @@ public:
      */
     unsigned int num_threads_hint() const;
 
+    /** Enable or disable the runtime counters.
+     *
+     * When enabled the scheduler records the number of kernels scheduled and of windows
+     * executed, the time each thread spends running kernels and the time it takes the
+     * worker threads to wake up. The counters are lock-free and cheap enough to leave
+     * enabled in production. They are disabled by default.
+     *
+     * @param[in] enable True to start recording, false to stop. The counters keep their values.
+     */
+    virtual void set_counters_enabled(bool enable);
+    /** Are the runtime counters enabled?
+     *
+     * @return True if the runtime counters are enabled.
+     */
+    virtual bool counters_enabled() const;
+    /** Read the runtime counters.
+     *
+     * @note Must not be called concurrently with @ref set_num_threads.
+     *
+     * @return A snapshot of the counters since they were last reset.
+     */
+    virtual SchedulerCounters counters() const;
+    /** Reset the runtime counters to zero. */
+    virtual void reset_counters();
+
 protected:
-    CPUInfo _info{};
+    /** Counters storage to record into, nullptr if the counters are disabled.
+     *
+     * @return The counters storage or nullptr.
+     */
+    SchedulerCounterStorage *active_counters();
+
+    CPUInfo                 _info{};
+    SchedulerCounterStorage _counters{};
+    std::atomic<bool>       _counters_enabled{ false };
 
 private:
     unsigned int _num_threads_hint = {};
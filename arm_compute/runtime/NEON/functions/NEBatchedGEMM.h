@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBATCHEDGEMM_H__
+#define __ARM_COMPUTE_NEBATCHEDGEMM_H__
+
+#include "arm_compute/core/NEON/kernels/NEGEMMAssemblyBatchedKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to execute a batch of same-shape GEMMs on NEON. This function calls the following NEON kernels:
+ *
+ *  -# @ref NEGEMMAssemblyBatchedPackBKernel (if a single matrix B is shared by the batch)
+ *  -# @ref NEGEMMAssemblyBatchedKernel
+ *
+ * The whole batch is packed and scheduled at once: when there are at least as many problems as threads the batch is split across the
+ * threads, otherwise the rows of every problem are.
+ */
+class NEBatchedGEMM : public IFunction
+{
+public:
+    /** Constructor */
+    NEBatchedGEMM(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Initialise the function with strided batches.
+     *
+     * @note Computes d[i] = alpha * a[i] x b[i] + beta * d[i] for every batch i.
+     *
+     * @param[in]     a     Matrices A with shape [K, M, batches]. Data type supported: F32
+     * @param[in]     b     Matrices B with shape [N, K, batches], or [N, K] to share the same matrix across the batch. Data type supported: same as @p a
+     * @param[in,out] d     Output matrices with shape [N, M, batches]. If @p beta is not zero they are also the matrices C. Data type supported: same as @p a
+     * @param[in]     alpha     (Optional) Weight of the matrix product. Defaults to 1.
+     * @param[in]     beta      (Optional) Weight of the matrices C. Defaults to 0.
+     * @param[in]     gemm_info (Optional) Specifies if a shared matrix B only has to be packed once, on the first run.
+     */
+    void configure(const ITensor *a, const ITensor *b, ITensor *d, float alpha = 1.f, float beta = 0.f, const GEMMInfo &gemm_info = GEMMInfo());
+    /** Initialise the function with arrays of matrices.
+     *
+     * @param[in]     a     Matrices A, all with shape [K, M]. Data type supported: F32
+     * @param[in]     b     Matrices B, all with shape [N, K]. Either one per matrix of @p a or a single one shared by the batch. Data type supported: same as @p a
+     * @param[in,out] d     Output matrices, all with shape [N, M], one per matrix of @p a. Data type supported: same as @p a
+     * @param[in]     alpha     (Optional) Weight of the matrix product. Defaults to 1.
+     * @param[in]     beta      (Optional) Weight of the matrices C. Defaults to 0.
+     * @param[in]     gemm_info (Optional) Specifies if a shared matrix B only has to be packed once, on the first run.
+     */
+    void configure(const std::vector<const ITensor *> &a, const std::vector<const ITensor *> &b, const std::vector<ITensor *> &d, float alpha = 1.f, float beta = 0.f,
+                   const GEMMInfo &gemm_info = GEMMInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBatchedGEMM with strided batches
+     *
+     * @param[in] a Matrices A with shape [K, M, batches]. Data type supported: F32
+     * @param[in] b Matrices B with shape [N, K, batches] or [N, K]. Data type supported: same as @p a
+     * @param[in] d Output matrices with shape [N, M, batches]. Data type supported: same as @p a
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBatchedGEMM with arrays of matrices
+     *
+     * @param[in] a Matrices A, all with shape [K, M]. Data type supported: F32
+     * @param[in] b Matrices B, all with shape [N, K]. Either one per matrix of @p a or a single one shared by the batch. Data type supported: same as @p a
+     * @param[in] d Output matrices, all with shape [N, M], one per matrix of @p a. Data type supported: same as @p a
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &a, const std::vector<const ITensorInfo *> &b, const std::vector<const ITensorInfo *> &d);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    /** Allocates the workspace and picks the dimension the batch is split on */
+    void configure_workspace(unsigned int M, unsigned int N, unsigned int K, unsigned int num_batches);
+    /** Configures the packing of the matrix B shared by the whole batch */
+    void configure_packed_b(const ITensor *b, const GEMMInfo &gemm_info);
+
+    MemoryGroup                      _memory_group;
+    NEGEMMAssemblyBatchedPackBKernel _pack_b_kernel;
+    NEGEMMAssemblyBatchedKernel      _mm_kernel;
+    Tensor                           _workspace;
+    Tensor                           _packed_b;
+    size_t                           _split_dimension;
+    bool                             _pack_b;
+    bool                             _is_first_run;
+    bool                             _reshape_b_only_on_first_run;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEBATCHEDGEMM_H__ */
@@ -42,10 +42,11 @@ class ITensor;
 /** Basic function to execute canny edge on NEON. This function calls the following NEON kernels and functions:
  *
  *  -# @ref NEFillBorderKernel (if border_mode == REPLICATE or border_mode == CONSTANT)
- *  -# @ref NESobel3x3 (if gradient_size == 3) or
+ *  -# @ref NESobel3x3GradientKernel (if gradient_size == 3 and use_fp16 == false) or
+ *     @ref NESobel3x3 (if gradient_size == 3 and use_fp16 == true) or
  *     @ref NESobel5x5 (if gradient_size == 5) or
  *     @ref NESobel7x7 (if gradient_size == 7)
- *  -# @ref NEGradientKernel
+ *  -# @ref NEGradientKernel (if the Sobel function is used)
  *  -# @ref NEEdgeNonMaxSuppressionKernel
  *  -# @ref NEEdgeTraceKernel
  *
@@ -87,6 +88,7 @@ private:
     std::unique_ptr<INEKernel>    _gradient;            /**< Gradient kernel */
     NEEdgeNonMaxSuppressionKernel _non_max_suppr;       /**< Non-Maxima suppression kernel */
     NEEdgeTraceKernel             _edge_trace;          /**< Edge tracing kernel */
+    NEFillBorderKernel            _border_input;        /**< Fill border on input tensor kernel (fused 3x3 gradient only) */
     NEFillBorderKernel            _border_mag_gradient; /**< Fill border on magnitude tensor kernel */
     NEFillBorderKernel            _border_edge_trace;   /**< Fill border before edge trace */
     Tensor                        _gx;                  /**< Source tensor - Gx component */
@@ -56,10 +56,11 @@ public:
      *    1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = QS8/QS16/F16/F32
      *    3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = QS8/F16/F32
      *    5x5 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F32
+     *    NxM convolution with any stride_x, stride_y data type = F16/F32
      *
      * @param[in, out] input     Input tensor. Data types supported: QS8/QS16/F16/F32.
      * @param[in]      weights   Set of kernels to convolve the input volume.
-     *                           Supported sizes: 1x1, 3x3 and 5x5.
+     *                           Supported sizes: 1x1, 3x3 and 5x5 for all data types, any size for F16/F32.
      *                           The 3rd dimension must be the same as the input's volume 3rd dimension.
      *                           Data type supported: Same as @p input.
      * @param[in]      bias      Set of biases. Can be nullptr. Data type supported: Same as @p input.
@@ -74,10 +75,11 @@ public:
      *    1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = QS8/QS16/F16/F32
      *    3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = QS8/F16/F32
      *    5x5 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F32
+     *    NxM convolution with any stride_x, stride_y data type = F16/F32
      *
      * @param[in] input     Input tensor. Data types supported: QS8/QS16/F16/F32.
      * @param[in] weights   Set of kernels to convolve the input volume.
-     *                      Supported sizes: 1x1, 3x3 and 5x5.
+     *                      Supported sizes: 1x1, 3x3 and 5x5 for all data types, any size for F16/F32.
      *                      The 3rd dimension must be the same as the input's volume 3rd dimension.
      *                      Data type supported: Same as @p input.
      * @param[in] bias      Set of biases. Can be nullptr. Data type supported: Same as @p input.
@@ -31,7 +31,9 @@
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/Lut.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 
 namespace arm_compute
 {
@@ -41,6 +43,7 @@ using IImage = ITensor;
 /** Basic function to execute histogram equalization. This function calls the following NEON kernels:
  *
  * -# @ref NEHistogramKernel
+ * -# @ref NEHistogramReductionKernel
  * -# @ref NECumulativeDistributionKernel
  * -# @ref NETableLookupKernel
  *
@@ -63,13 +66,16 @@ public:
     void run() override;
 
 private:
-    NEHistogramKernel              _histogram_kernel;        /**< Kernel that calculates the histogram of input. */
+    NEHistogramKernel              _histogram_kernel;        /**< Kernel that calculates the local histograms of input. */
+    NEHistogramReductionKernel     _reduction_kernel;        /**< Kernel that sums the local histograms. */
     NECumulativeDistributionKernel _cd_histogram_kernel;     /**< Kernel that calculates the cumulative distribution
                                                                   and creates the relevant LookupTable. */
     NETableLookupKernel            _map_histogram_kernel;    /**< Kernel that maps the input to output using the lut. */
     Distribution1D                 _hist;                    /**< Distribution that holds the histogram of the input image. */
     Distribution1D                 _cum_dist;                /**< Distribution that holds the cummulative distribution of the input histogram. */
     Lut                            _cd_lut;                  /**< Holds the equalization lookuptable. */
+    std::unique_ptr<uint32_t[]>    _local_hist;              /**< Threads local histograms. */
+    size_t                         _local_hist_size;         /**< Number of elements of the local histograms. */
     static constexpr uint32_t      nr_bins{ 256 };           /**< Histogram bins of the internal histograms. */
     static constexpr uint32_t      max_range{ nr_bins - 1 }; /**< Histogram range of the internal histograms. */
 };
@@ -91,6 +91,8 @@ private:
  * -# @ref NEWeightsReshapeKernel   (executed only once for each configuration)
  * -# @ref NEIm2ColKernel
  * -# @ref NEGEMMInterleave4x4Kernel (executed only in case GEMM is required for the operation)
+ * -# @ref NEGEMMAArch64ImplicitConvolutionKernel (AArch64 F32 only: replaces @ref NEIm2ColKernel and the matrix multiply,
+ *    the patches are gathered block by block while packing the GEMM panels so the im2col matrix is never allocated)
  * -# @ref NEGEMMMatrixMultiplyKernel or @ref NEGEMMLowpMatrixMultiplyCore (if quantized asymmetric)
  * -# @ref NEGEMMLowpQuantizeDownInt32ToUint8Scale (if quantized asymmetric)
  * -# @ref NECol2ImKernel
@@ -165,6 +167,7 @@ private:
     NEConvolutionLayerReshapeWeights                    _reshape_weights;
     NEGEMMMatrixMultiplyKernel                          _mm_kernel;
     std::unique_ptr<NEGEMMAssemblyBaseKernel>           _mm_optimised_kernel;
+    std::unique_ptr<INEKernel>                          _mm_implicit_kernel;
     NEGEMMLowpMatrixMultiplyCore                        _mm_gemmlowp;
     NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint _gemmlowp_output_stage;
     NECol2ImKernel                                      _output_col2im_kernel;
@@ -181,6 +184,7 @@ private:
     bool _are_weights_reshaped;
     bool _is_quantized;
     bool _is_interleaved;
+    bool _is_implicit_gemm;
 };
 }
 #endif /* __ARM_COMPUTE_NECONVOLUTIONGEMMLAYER_H__ */
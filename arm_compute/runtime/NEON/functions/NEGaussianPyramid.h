@@ -25,11 +25,10 @@
 #define __ARM_COMPUTE_NEGAUSSIANPYRAMID_H__
 
 #include "arm_compute/core/IPyramid.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGaussianPyramidKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussian5x5.h"
-#include "arm_compute/runtime/NEON/functions/NEScale.h"
 #include "arm_compute/runtime/Pyramid.h"
 #include "arm_compute/runtime/Tensor.h"
 
@@ -70,14 +69,12 @@ public:
 protected:
     const ITensor *_input;
     IPyramid      *_pyramid;
-    Pyramid        _tmp;
 };
 
 /** Basic function to execute gaussian pyramid with HALF scale factor. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NEGaussianPyramidHorKernel
- * -# @ref NEGaussianPyramidVertKernel
+ * -# @ref NEGaussianPyramidDownsampleKernel
  *
  */
 class NEGaussianPyramidHalf : public NEGaussianPyramid
@@ -91,17 +88,14 @@ public:
     void run() override;
 
 private:
-    std::unique_ptr<NEFillBorderKernel[]>          _horizontal_border_handler;
-    std::unique_ptr<NEFillBorderKernel[]>          _vertical_border_handler;
-    std::unique_ptr<NEGaussianPyramidHorKernel[]>  _horizontal_reduction;
-    std::unique_ptr<NEGaussianPyramidVertKernel[]> _vertical_reduction;
+    std::unique_ptr<NEFillBorderKernel[]>                _border_handler;
+    std::unique_ptr<NEGaussianPyramidDownsampleKernel[]> _downsample;
 };
 
-/** Basic function to execute gaussian pyramid with ORB scale factor. This function calls the following NEON kernels and functions:
+/** Basic function to execute gaussian pyramid with ORB scale factor. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NEGaussian5x5
- * -# @ref NEScaleKernel
+ * -# @ref NEGaussianPyramidDownsampleKernel
  *
  */
 class NEGaussianPyramidOrb : public NEGaussianPyramid
@@ -115,8 +109,8 @@ public:
     void run() override;
 
 private:
-    std::unique_ptr<NEGaussian5x5[]> _gaus5x5;
-    std::unique_ptr<NEScale[]>       _scale_nearest;
+    std::unique_ptr<NEFillBorderKernel[]>                _border_handler;
+    std::unique_ptr<NEGaussianPyramidDownsampleKernel[]> _downsample;
 };
 }
 #endif /*__ARM_COMPUTE_NEGAUSSIANPYRAMID_H__ */
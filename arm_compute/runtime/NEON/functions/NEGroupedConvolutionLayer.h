@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGROUPEDCONVOLUTIONLAYER_H__
+#define __ARM_COMPUTE_NEGROUPEDCONVOLUTIONLAYER_H__
+
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/NEON/kernels/NECol2ImKernel.h"
+#include "arm_compute/core/NEON/kernels/NEWeightsReshapeKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to compute a grouped convolution layer. The input and output feature maps are split into @p num_groups groups
+ * and group g of the output only depends on group g of the input.
+ *
+ * On AArch64 for F32 all the groups are computed by a single scheduled kernel. This function calls the following NEON kernels:
+ * -# @ref NEWeightsReshapeKernel (executed only once, shared by all the groups)
+ * -# @ref NEGEMMAArch64ImplicitConvolutionKernel
+ * -# @ref NECol2ImKernel
+ *
+ * Otherwise one @ref NEGEMMConvolutionLayer is run per group on sub-tensors of the input, weights, biases and output.
+ */
+class NEGroupedConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEGroupedConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupedConvolutionLayer(const NEGroupedConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupedConvolutionLayer &operator=(const NEGroupedConvolutionLayer &) = delete;
+    /** Set the input and output tensors.
+     *
+     * @note The tensors are not modified, they are non-const only because sub-tensors of them may be created.
+     *
+     * @param[in]  input      Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                        while every optional dimension from 4 and above represent a batch of inputs.
+     *                        Data types supported: QS8/QASYMM8/QS16/F16/F32.
+     * @param[in]  weights    Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases     Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                        Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
+     * @param[out] output     Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                        Data types supported: Same as @p input.
+     * @param[in]  conv_info  Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  num_groups Number of groups. IFM and OFM must be multiples of it.
+     */
+    void configure(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int num_groups);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGroupedConvolutionLayer
+     *
+     * @param[in] input      Source tensor info. Data types supported: QS8/QASYMM8/QS16/F16/F32.
+     * @param[in] weights    Weights tensor info with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     * @param[in] biases     Biases tensor info with dimensions [OFM]. Data type supported: Same as @p input, except for input of QASYMM8 type where biases should be of S32 type.
+     * @param[in] output     Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] conv_info  Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] num_groups Number of groups. IFM and OFM must be multiples of it.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info, unsigned int num_groups);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    MemoryGroup                                          _memory_group;
+    NEWeightsReshapeKernel                               _weights_reshape_kernel;
+    std::unique_ptr<INEKernel>                           _mm_kernel;
+    NECol2ImKernel                                       _output_col2im_kernel;
+    std::vector<SubTensor>                               _sub_tensors;
+    std::vector<std::unique_ptr<NEGEMMConvolutionLayer>> _convolutions;
+    Tensor                                               _weights_reshaped;
+    Tensor                                               _gemm_output;
+    Tensor                                               _workspace;
+    bool                                                 _are_weights_reshaped;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEGROUPEDCONVOLUTIONLAYER_H__ */
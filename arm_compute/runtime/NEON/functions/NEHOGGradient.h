@@ -25,12 +25,11 @@
 #define __ARM_COMPUTE_NEHOGGRADIENT_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/NEON/functions/NEDerivative.h"
-#include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
 #include <memory>
@@ -40,9 +39,10 @@ namespace arm_compute
 class ITensor;
 /** Basic function to calculate the gradient for HOG. This function calls the following NEON kernels:
  *
- * -# @ref NEDerivative
- * -# NEMagnitudePhaseKernel
+ * -# @ref NEFillBorderKernel (if border_mode == REPLICATE or border_mode == CONSTANT)
+ * -# NEDerivativeMagnitudePhaseKernel
  *
+ * @note The derivatives are not stored: magnitude and phase are computed from them in the same pass.
  */
 class NEHOGGradient : public IFunction
 {
@@ -66,10 +66,8 @@ public:
 
 private:
     MemoryGroup                _memory_group;
-    NEDerivative               _derivative;
+    NEFillBorderKernel         _border_handler;
     std::unique_ptr<INEKernel> _mag_phase;
-    Tensor                     _gx;
-    Tensor                     _gy;
 };
 }
 #endif /*__ARM_COMPUTE_NEHOGGRADIENT_H__ */
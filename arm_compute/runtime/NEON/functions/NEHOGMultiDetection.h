@@ -28,6 +28,7 @@
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/IMultiHOG.h"
 #include "arm_compute/core/NEON/kernels/NEHOGDescriptorKernel.h"
+#include "arm_compute/core/NEON/kernels/NEHOGDetectorKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -44,7 +45,7 @@ namespace arm_compute
  * -# @ref NEHOGGradient
  * -# @ref NEHOGOrientationBinningKernel
  * -# @ref NEHOGBlockNormalizationKernel
- * -# @ref NEHOGDetector
+ * -# @ref NEHOGDetectorKernel
  * -# @ref CPPDetectionWindowNonMaximaSuppressionKernel (executed if non_maxima_suppression == true)
  *
  * @note This implementation works if all the HOG data-objects within the IMultiHOG container have the same:
@@ -93,7 +94,7 @@ private:
     NEHOGGradient                                                 _gradient_kernel;
     std::unique_ptr<NEHOGOrientationBinningKernel[]>              _orient_bin_kernel;
     std::unique_ptr<NEHOGBlockNormalizationKernel[]>              _block_norm_kernel;
-    std::unique_ptr<NEHOGDetector[]>                              _hog_detect_kernel;
+    std::unique_ptr<NEHOGDetectorKernel[]>                        _hog_detect_kernel;
     std::unique_ptr<CPPDetectionWindowNonMaximaSuppressionKernel> _non_maxima_kernel;
     std::unique_ptr<Tensor[]>                                     _hog_space;
     std::unique_ptr<Tensor[]>                                     _hog_norm_space;
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/CPP/kernels/CPPCornerCandidatesKernel.h"
 #include "arm_compute/core/CPP/kernels/CPPSortEuclideanDistanceKernel.h"
+#include "arm_compute/core/CPP/kernels/CPPSortKeypointsKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NEHarrisCornersKernel.h"
 #include "arm_compute/core/Types.h"
@@ -55,6 +56,7 @@ using IImage = ITensor;
  *    NEHarrisScoreKernel<7> (if block_size == 7)
  * -# @ref NENonMaximaSuppression3x3
  * -# @ref CPPCornerCandidatesKernel
+ * -# @ref CPPSortKeypointsKernel
  * -# @ref CPPSortEuclideanDistanceKernel
  *
  */
@@ -92,6 +94,7 @@ private:
     std::unique_ptr<INEHarrisScoreKernel> _harris_score;          /**< Harris score kernel */
     NENonMaximaSuppression3x3             _non_max_suppr;         /**< Non-maxima suppression function */
     CPPCornerCandidatesKernel             _candidates;            /**< Sort kernel */
+    CPPSortKeypointsKernel                _sort_candidates;       /**< Parallel sort kernel */
     CPPSortEuclideanDistanceKernel        _sort_euclidean;        /**< Euclidean distance kernel */
     NEFillBorderKernel                    _border_gx;             /**< Border handler before running harris score */
     NEFillBorderKernel                    _border_gy;             /**< Border handler before running harris score */
@@ -35,7 +35,12 @@ namespace arm_compute
 {
 class IDistribution1D;
 
-/** Basic function to run @ref NEHistogramKernel. */
+/** Basic function to execute histogram. This function calls the following NEON kernels:
+ *
+ * -# @ref NEHistogramKernel
+ * -# @ref NEHistogramReductionKernel
+ *
+ */
 class NEHistogram : public IFunction
 {
 public:
@@ -53,6 +58,7 @@ public:
 
 private:
     NEHistogramKernel           _histogram_kernel;
+    NEHistogramReductionKernel  _reduction_kernel;
     std::unique_ptr<uint32_t[]> _local_hist;
     std::unique_ptr<uint32_t[]> _window_lut;
     size_t                      _local_hist_size;
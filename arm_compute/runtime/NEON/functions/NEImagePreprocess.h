@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEIMAGEPREPROCESS_H__
+#define __ARM_COMPUTE_NEIMAGEPREPROCESS_H__
+
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+#include "arm_compute/core/Types.h"
+
+#include <array>
+
+namespace arm_compute
+{
+class IMultiImage;
+class ITensor;
+using IImage = ITensor;
+
+/** Basic function to run @ref NEImagePreprocessKernel
+ *
+ * Replaces the sequence @ref NEColorConvert, @ref NEScale and a per-element normalisation with a single pass which
+ * reads the source image and writes the planar network input directly. The interpolation is bilinear.
+ */
+class NEImagePreprocess : public INESimpleFunction
+{
+public:
+    /** Initialise the function with an interleaved source image
+     *
+     * @param[in]  input   Source image. Formats supported: RGB888/RGBA8888.
+     * @param[out] output  Destination tensor of shape [width, height, 3]. Data types supported: F32/QASYMM8.
+     * @param[in]  mean    Mean of each channel, in RGB order.
+     * @param[in]  std_dev Standard deviation of each channel, in RGB order.
+     * @param[in]  bgr     (Optional) Store the blue channel in the first plane of @p output.
+     */
+    void configure(const IImage *input, ITensor *output, const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr = false);
+    /** Initialise the function with a multi-planar source image
+     *
+     * @param[in]  input   Source image. Formats supported: NV12/NV21.
+     * @param[out] output  Destination tensor of shape [width, height, 3]. Data types supported: F32/QASYMM8.
+     * @param[in]  mean    Mean of each channel, in RGB order.
+     * @param[in]  std_dev Standard deviation of each channel, in RGB order.
+     * @param[in]  bgr     (Optional) Store the blue channel in the first plane of @p output.
+     */
+    void configure(const IMultiImage *input, ITensor *output, const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr = false);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEImagePreprocess
+     *
+     * @param[in] input   Source image info. Formats supported: RGB888/RGBA8888.
+     * @param[in] output  Destination tensor info of shape [width, height, 3]. Data types supported: F32/QASYMM8.
+     * @param[in] std_dev Standard deviation of each channel, in RGB order.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const std::array<float, 3> &std_dev);
+};
+}
+#endif /* __ARM_COMPUTE_NEIMAGEPREPROCESS_H__ */
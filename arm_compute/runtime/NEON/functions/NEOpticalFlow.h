@@ -34,6 +34,7 @@
 #include "arm_compute/runtime/NEON/functions/NEScharr3x3.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -48,6 +49,10 @@ using LKInternalKeypointArray = Array<NELKInternalKeypoint>;
  * -# @ref NEScharr3x3
  * -# @ref NELKTrackerKernel
  *
+ * For video, configure_streaming() sets up a pair of pyramids used in turn as old and new frame: the new frame of a call
+ * becomes the old frame of the next one without being copied or rebuilt.
+ *
+ * @note The Scharr gradients of the old frame are recomputed by every call to run().
  */
 class NEOpticalFlow : public IFunction
 {
@@ -77,11 +82,78 @@ public:
     void configure(const Pyramid *old_pyramid, const Pyramid *new_pyramid, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
                    IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
                    bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value = 0);
+    /**  Initialise the function input and output for a stream of frames
+     *
+     * The first frame must be written to @p pyramid_a and the second one to @p pyramid_b. After each call to next_frame(),
+     * the next frame must be written to the pyramid returned by new_pyramid().
+     *
+     * @param[in]  pyramid_a             Pointer to the first pyramid of the pair. Data type supported U8
+     * @param[in]  pyramid_b             Pointer to the second pyramid of the pair. Data type supported U8
+     * @param[in]  old_points            Pointer to the IKeyPointArray storing old key points
+     * @param[in]  new_points_estimates  Pointer to the IKeyPointArray storing new estimates key points
+     * @param[out] new_points            Pointer to the IKeyPointArray storing new key points
+     * @param[in]  termination           The criteria to terminate the search of each keypoint.
+     * @param[in]  epsilon               The error for terminating the algorithm
+     * @param[in]  num_iterations        The maximum number of iterations before terminate the alogrithm
+     * @param[in]  window_dimension      The size of the window on which to perform the algorithm
+     * @param[in]  use_initial_estimate  The flag to indicate whether the initial estimated position should be used
+     * @param[in]  border_mode           The border mode applied at scharr kernel stage
+     * @param[in]  constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT
+     *
+     */
+    void configure_streaming(const Pyramid *pyramid_a, const Pyramid *pyramid_b, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
+                             IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
+                             bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value = 0);
+    /** Move on to the next frame of the stream: the new frame becomes the old one
+     *
+     * @note Only valid if the function has been configured with configure_streaming()
+     */
+    void next_frame();
+    /** Pyramid currently used as old frame
+     *
+     * @return The old pyramid
+     */
+    const Pyramid *old_pyramid() const;
+    /** Pyramid currently used as new frame: in streaming mode, the next frame has to be written to it after next_frame()
+     *
+     * @return The new pyramid
+     */
+    const Pyramid *new_pyramid() const;
 
     // Inherited methods overridden:
     void run() override;
 
 private:
+    /** Initialise the Scharr gradient tensors of one pyramid level
+     *
+     * @param[in] level Pyramid level
+     * @param[in] input Level of one of the pyramids
+     */
+    void init_gradients(unsigned int level, const IImage *input);
+    /** Configure the kernels and functions of one pyramid level
+     *
+     * @note The gradient tensors of the level must have been initialised.
+     *
+     * @param[in] idx                   Index of the Scharr function and of the tracker in the internal arrays
+     * @param[in] old_input             Level of the old pyramid
+     * @param[in] new_input             Level of the new pyramid
+     * @param[in] level                 Pyramid level
+     * @param[in] old_points            Pointer to the IKeyPointArray storing old key points
+     * @param[in] new_points_estimates  Pointer to the IKeyPointArray storing new estimates key points
+     * @param[in] new_points            Pointer to the IKeyPointArray storing new key points
+     * @param[in] termination           The criteria to terminate the search of each keypoint.
+     * @param[in] epsilon               The error for terminating the algorithm
+     * @param[in] num_iterations        The maximum number of iterations before terminate the alogrithm
+     * @param[in] window_dimension      The size of the window on which to perform the algorithm
+     * @param[in] use_initial_estimate  The flag to indicate whether the initial estimated position should be used
+     * @param[in] border_mode           The border mode applied at scharr kernel stage
+     * @param[in] constant_border_value Constant value to use for borders if border_mode is set to CONSTANT
+     * @param[in] pyr_scale             Scale factor of the pyramids
+     */
+    void configure_level(unsigned int idx, IImage *old_input, IImage *new_input, unsigned int level, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
+                         IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
+                         bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value, float pyr_scale);
+
     MemoryGroup                          _memory_group;
     std::unique_ptr<NEScharr3x3[]>       _func_scharr;
     std::unique_ptr<NELKTrackerKernel[]> _kernel_tracker;
@@ -93,6 +165,9 @@ private:
     LKInternalKeypointArray              _new_points_internal;
     LKInternalKeypointArray              _old_points_internal;
     unsigned int                         _num_levels;
+    bool                                 _is_streaming;
+    std::array<const Pyramid *, 2>       _pyramids;
+    unsigned int                         _old_index;
 };
 }
 #endif /*__ARM_COMPUTE_NEOPTICALFLOW_H__ */
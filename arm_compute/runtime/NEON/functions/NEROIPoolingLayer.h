@@ -46,7 +46,7 @@ public:
     NEROIPoolingLayer();
     /** Set the input and output tensors.
      *
-     * @param[in]  input     Source tensor. Data types supported: F32.
+     * @param[in]  input     Source tensor. Data types supported: F16/F32.
      * @param[in]  rois      Array containing @ref ROI.
      * @param[out] output    Destination tensor. Data types supported: Same as @p input.
      * @param[in]  pool_info Contains pooling operation information described in @ref ROIPoolingLayerInfo.
@@ -43,18 +43,21 @@ class NERemap : public INESimpleFunction
 {
 public:
     /** Initialise the function's sources, destination, interpolation policy and border mode.
+     *
+     * The maps can be compressed to save memory bandwidth: see @ref NERemapKernel.
      *
      * @param[in, out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
-     * @param[in]      map_x                 Map for X coordinates. Data type supported: F32.
-     * @param[in]      map_y                 Map for Y coordinates. Data type supported: F32.
+     * @param[in]      map_x                 Map for X coordinates. Data type supported: F32/QS16.
+     * @param[in]      map_y                 Map for Y coordinates. Data type supported: Same as @p map_x.
      * @param[out]     output                Output tensor. Data type supported: U8.
      * @param[in]      policy                Interpolation policy to use. Only NEAREST and BILINEAR are supported.
      * @param[in]      border_mode           Border mode to use on the input tensor.
      * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     * @param[in]      map_subsampling       (Optional) Sub-sampling factor of the maps.
      *
      */
     void configure(ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output,
-                   InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value = 0);
+                   InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value = 0, unsigned int map_subsampling = 1);
 };
 }
 #endif /*__ARM_COMPUTE_NEREMAP_H__ */
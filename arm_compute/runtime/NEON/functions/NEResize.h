@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NERESIZE_H__
+#define __ARM_COMPUTE_NERESIZE_H__
+
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run @ref NEResizeKernel
+ *
+ * Unlike @ref NEScale the interpolation coefficients are stored per row and per column, no offsets tensors are needed,
+ * and interleaved RGB888/RGBA8888 images are supported. Planar images can be resized plane by plane.
+ *
+ * @note Source pixels outside of the image are clamped to the closest edge pixel.
+ */
+class NEResize : public INESimpleFunction
+{
+public:
+    /** Initialise the function's source, destination and interpolation type.
+     *
+     * @param[in]  input           Source tensor. Formats supported: U8/RGB888/RGBA8888.
+     * @param[out] output          Destination tensor. Format supported: same as @p input.
+     *                             All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
+     * @param[in]  policy          The interpolation type. Supported: NEAREST_NEIGHBOR/BILINEAR/BICUBIC/AREA.
+     * @param[in]  sampling_policy (Optional) Sampling policy used by the interpolation. Defaults to @ref SamplingPolicy::CENTER
+     */
+    void configure(const ITensor *input, ITensor *output, InterpolationPolicy policy, SamplingPolicy sampling_policy = SamplingPolicy::CENTER);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEResize
+     *
+     * @param[in] input           Source tensor info. Formats supported: U8/RGB888/RGBA8888.
+     * @param[in] output          Destination tensor info. Format supported: same as @p input.
+     * @param[in] policy          The interpolation type. Supported: NEAREST_NEIGHBOR/BILINEAR/BICUBIC/AREA.
+     * @param[in] sampling_policy (Optional) Sampling policy used by the interpolation. Defaults to @ref SamplingPolicy::CENTER
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, InterpolationPolicy policy, SamplingPolicy sampling_policy = SamplingPolicy::CENTER);
+};
+}
+#endif /* __ARM_COMPUTE_NERESIZE_H__ */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_SCHEDULERCOUNTERS_H__
+#define __ARM_COMPUTE_SCHEDULERCOUNTERS_H__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+/** Counters of one thread of a scheduler. All the times are in nanoseconds. */
+struct ThreadCounters
+{
+    uint64_t windows{ 0 };            /**< Number of windows executed by the thread */
+    uint64_t busy_time{ 0 };          /**< Time spent running kernels */
+    uint64_t wakeups{ 0 };            /**< Number of times the thread was woken up to run a window */
+    uint64_t wakeup_latency{ 0 };     /**< Total time between a window being handed to the thread and the thread starting it */
+    uint64_t max_wakeup_latency{ 0 }; /**< Longest time between a window being handed to the thread and the thread starting it */
+};
+
+/** Snapshot of the counters of a scheduler. All the times are in nanoseconds.
+ *
+ * The time spent by a thread neither running kernels nor waking up is @ref
+ * elapsed_time - ThreadCounters::busy_time - ThreadCounters::wakeup_latency.
+ * The difference between two snapshots taken around the run of a function
+ * gives the breakdown of that function.
+ */
+struct SchedulerCounters
+{
+    uint64_t                    kernels{ 0 };        /**< Number of kernels scheduled */
+    uint64_t                    serial_kernels{ 0 }; /**< Number of kernels which ran on the calling thread only */
+    uint64_t                    windows{ 0 };        /**< Number of windows the kernels were split into */
+    uint64_t                    schedule_time{ 0 };  /**< Time spent in the schedule calls */
+    uint64_t                    dispatch_time{ 0 };  /**< Time spent splitting the windows and handing them to the worker threads */
+    uint64_t                    wait_time{ 0 };      /**< Time the calling thread waited for the worker threads after finishing its own window */
+    uint64_t                    elapsed_time{ 0 };   /**< Time since the counters were last reset */
+    std::vector<ThreadCounters> threads{};           /**< Per thread counters, indexed by ThreadInfo::thread_id */
+};
+
+/** Lock-free storage of the counters of a scheduler.
+ *
+ * There is one slot per ThreadInfo::thread_id, updated with relaxed atomic
+ * operations so recording never blocks and threads don't share cache lines.
+ * A slot is written by whichever thread runs the windows with its id: a
+ * worker thread, or the calling thread for its own window of a parallel
+ * kernel and for kernels running serially (slot 0). The windows of a kernel
+ * all have different ids, so a slot is never written by two threads at once.
+ * A snapshot taken while kernels are running might be slightly inconsistent.
+ *
+ * @note @ref resize must not be called concurrently with the other methods.
+ */
+class SchedulerCounterStorage
+{
+public:
+    /** Clock used to time the events */
+    using clock = std::chrono::steady_clock;
+
+    /** Default constructor */
+    SchedulerCounterStorage();
+    /** Set the number of threads to keep counters for, resets the counters.
+     *
+     * @param[in] num_threads Number of threads.
+     */
+    void resize(unsigned int num_threads);
+    /** Reset all the counters to zero */
+    void reset();
+    /** Read all the counters.
+     *
+     * @return A snapshot of the counters.
+     */
+    SchedulerCounters snapshot() const;
+    /** Record a kernel scheduled on a single thread.
+     *
+     * @param[in] schedule_time Time spent in the schedule call.
+     */
+    void record_serial_kernel(uint64_t schedule_time);
+    /** Record a kernel split across several threads.
+     *
+     * @param[in] num_windows   Number of windows the kernel was split into.
+     * @param[in] schedule_time Time spent in the schedule call.
+     * @param[in] dispatch_time Time spent handing the windows to the worker threads.
+     * @param[in] wait_time     Time spent waiting for the worker threads.
+     */
+    void record_parallel_kernel(unsigned int num_windows, uint64_t schedule_time, uint64_t dispatch_time, uint64_t wait_time);
+    /** Record the execution of a window.
+     *
+     * @param[in] thread_id ThreadInfo::thread_id of the window, 0 for a kernel running serially.
+     * @param[in] busy_time Time spent running the window.
+     */
+    void record_window(unsigned int thread_id, uint64_t busy_time);
+    /** Record a worker thread being woken up.
+     *
+     * @param[in] thread_id Id of the thread.
+     * @param[in] latency   Time between the window being handed to the thread and the thread starting it.
+     */
+    void record_wakeup(unsigned int thread_id, uint64_t latency);
+    /** Nanoseconds elapsed between two time points
+     *
+     * @param[in] start Start time.
+     * @param[in] end   End time.
+     *
+     * @return Elapsed time in nanoseconds.
+     */
+    static uint64_t elapsed(clock::time_point start, clock::time_point end)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+private:
+    struct ThreadSlot
+    {
+        std::atomic<uint64_t> windows;
+        std::atomic<uint64_t> busy_time;
+        std::atomic<uint64_t> wakeups;
+        std::atomic<uint64_t> wakeup_latency;
+        std::atomic<uint64_t> max_wakeup_latency;
+        // Pad to two cache lines so the counters of two slots are never in the same line whatever the alignment of the allocation
+        char padding[128 - 5 * sizeof(std::atomic<uint64_t>)];
+    };
+
+    std::atomic<uint64_t>         _kernels;
+    std::atomic<uint64_t>         _serial_kernels;
+    std::atomic<uint64_t>         _windows;
+    std::atomic<uint64_t>         _schedule_time;
+    std::atomic<uint64_t>         _dispatch_time;
+    std::atomic<uint64_t>         _wait_time;
+    std::atomic<int64_t>          _reset_time;
+    std::unique_ptr<ThreadSlot[]> _slots;
+    unsigned int                  _num_slots;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_SCHEDULERCOUNTERS_H__ */
@@ -56,7 +56,7 @@ public:
 
 private:
     /** Constructor. */
-    SingleThreadScheduler() = default;
+    SingleThreadScheduler();
 };
 }
 #endif /* __ARM_COMPUTE_SINGLETHREADSCHEDULER_H__ */
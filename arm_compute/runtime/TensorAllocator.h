@@ -100,6 +100,20 @@ public:
      * @return error status
      */
     arm_compute::Status import_memory(Memory memory);
+    /** Import caller-owned memory as the tensor's backing memory
+     *
+     * The memory is not freed by the tensor and must outlive it.
+     *
+     * @note The memory must follow the tensor's layout, so the tensor info must be initialised first (e.g. with
+     *       @ref TensorInfo::init_with_row_stride for images with a custom row stride).
+     * @note Calling free on a tensor with imported memory will just clear the internal pointer value.
+     *
+     * @param[in] memory Pointer to the memory to import. Must be aligned to the tensor's element size.
+     * @param[in] size   Size of the memory in bytes. Must be at least the total size of the tensor.
+     *
+     * @return error status
+     */
+    arm_compute::Status import_memory(void *memory, size_t size);
     /** Associates the tensor with a memory group
      *
      * @param[in] associated_memory_group Memory group to associate the tensor with
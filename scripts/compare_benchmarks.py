@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+"""Compares two benchmark runs written by the JSON printer and flags the statistically significant regressions.
+Usage
+    python compare_benchmarks.py -a baseline.json -b candidate.json
+
+Both files are produced by arm_compute_benchmark with --log-format=json (or --json-file). Run the benchmarks with
+enough iterations (e.g. --iterations=30) for the comparison to be meaningful.
+
+For every test and instrument present in both runs the raw measurements are compared after removing the outliers
+(values further away from the median than a number of scaled median absolute deviations). The difference is
+significant if the two-sided Mann-Whitney U test rejects the hypothesis that both samples come from the same
+distribution. A test is flagged as a regression if the difference is significant and its median increased by more
+than the threshold (All the instruments are assumed to be lower is better).
+
+The script returns 1 if at least one regression was found, 0 otherwise.
+
+Tested on Python 2.7 and Python 3.5.
+"""
+import argparse
+import json
+import math
+import sys
+
+
+def median(values):
+    ordered = sorted(values)
+    n = len(ordered)
+    if n % 2 == 1:
+        return ordered[n // 2]
+    return 0.5 * (ordered[n // 2 - 1] + ordered[n // 2])
+
+
+def reject_outliers(values, threshold):
+    if threshold <= 0 or len(values) < 3:
+        return values
+    m = median(values)
+    mad = 1.4826 * median([abs(v - m) for v in values])
+    if mad == 0:
+        return values
+    return [v for v in values if abs(v - m) <= threshold * mad]
+
+
+def mann_whitney_u(a, b):
+    """Returns the p-value of the two-sided Mann-Whitney U test (Normal approximation with tie correction)."""
+    n1, n2 = len(a), len(b)
+    ranked = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+
+    # Average the ranks of tied values
+    ranks = [0.0] * len(ranked)
+    tie_term = 0.0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = 0.5 * (i + j) + 1
+        t = j - i + 1
+        tie_term += t ** 3 - t
+        i = j + 1
+
+    r1 = sum(r for r, (_, group) in zip(ranks, ranked) if group == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2.0
+    mean_u = n1 * n2 / 2.0
+    n = n1 + n2
+    var_u = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if var_u <= 0:
+        return 1.0
+
+    # Continuity correction
+    z = (abs(u1 - mean_u) - 0.5) / math.sqrt(var_u)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2)))
+
+
+def load_measurements(path):
+    with open(path) as f:
+        data = json.load(f)
+
+    measurements = {}
+    for test, result in data.get('tests', {}).items():
+        for instrument, values in result.get('measurements', {}).items():
+            # Measurements made of several raw values (e.g. MALI counters) are not comparable
+            raw = [float(v) for v in values['raw'] if not isinstance(v, list)]
+            if raw:
+                measurements[(test, instrument)] = (raw, values.get('unit', ''))
+    return measurements
+
+
+if __name__ == "__main__":
+    # Parse arguments
+    parser = argparse.ArgumentParser('Compare two benchmark runs')
+    parser.add_argument('-a', dest='baseline', type=str, required=True, help='JSON output of the baseline run')
+    parser.add_argument('-b', dest='candidate', type=str, required=True, help='JSON output of the candidate run')
+    parser.add_argument('--alpha', dest='alpha', type=float, default=0.01, help='Significance level of the test (Default: 0.01)')
+    parser.add_argument('--threshold', dest='threshold', type=float, default=2.0, help='Minimum change of the median in percent to report (Default: 2)')
+    parser.add_argument('--outlier-threshold', dest='outlierThreshold', type=float, default=3.0,
+                        help='Number of scaled MADs beyond which a measurement is rejected, 0 to disable (Default: 3)')
+    parser.add_argument('--all', dest='showAll', action='store_true', help='Print all the comparisons, not only the significant ones')
+    args = parser.parse_args()
+
+    baseline = load_measurements(args.baseline)
+    candidate = load_measurements(args.candidate)
+
+    common = sorted(set(baseline) & set(candidate))
+    regressions = 0
+    improvements = 0
+
+    for key in common:
+        a = reject_outliers(baseline[key][0], args.outlierThreshold)
+        b = reject_outliers(candidate[key][0], args.outlierThreshold)
+        unit = baseline[key][1]
+
+        median_a = median(a)
+        median_b = median(b)
+        change = 100.0 * (median_b - median_a) / median_a if median_a != 0 else 0.0
+
+        # A single measurement doesn't say anything about the noise
+        p_value = mann_whitney_u(a, b) if min(len(a), len(b)) > 1 else 1.0
+        significant = p_value < args.alpha and abs(change) >= args.threshold
+
+        if significant and change > 0:
+            status = 'REGRESSION'
+            regressions += 1
+        elif significant:
+            status = 'IMPROVEMENT'
+            improvements += 1
+        else:
+            status = ''
+
+        if significant or args.showAll:
+            print('{0:<12}{1} [{2}]: {3:.4f} {6} -> {4:.4f} {6} ({5:+.2f}%, p={7:.4f}, n={8}/{9})'.format(
+                status, key[0], key[1], median_a, median_b, change, unit, p_value, len(a), len(b)))
+
+    missing = len(set(baseline) ^ set(candidate))
+    print('Compared {0} measurement(s): {1} regression(s), {2} improvement(s), {3} not present in both runs'.format(
+        len(common), regressions, improvements, missing))
+
+    sys.exit(1 if regressions > 0 else 0)
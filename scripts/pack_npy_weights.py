@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+"""Packs all the numpy arrays found under a directory into a single file which the graph examples can memory-map.
+Usage
+    python pack_npy_weights.py -d path_to_data_directory -o output_file.aclpack
+
+The layout of the packed file is:
+    "ACLPACK\\0" magic string, uint32 version (1), uint32 number of entries
+    for each entry: uint32 name length, name, uint64 offset, uint64 size
+    the unmodified .npy files, each one starting at a 64 bytes aligned offset
+
+Entries are named after the path of their .npy file relative to the data directory.
+All the integers are little-endian.
+
+To use the packed file pass "output_file.aclpack" to the graph examples instead of the data directory.
+
+Tested on Python 2.7 and Python 3.5.
+"""
+import argparse
+import os
+import struct
+
+ALIGNMENT = 64
+
+
+def align(offset):
+    return (offset + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+
+
+if __name__ == "__main__":
+    # Parse arguments
+    parser = argparse.ArgumentParser('Pack numpy arrays into a single file')
+    parser.add_argument('-d', dest='dataDir', type=str, required=True, help='Path to the directory containing the .npy files')
+    parser.add_argument('-o', dest='outFile', type=str, required=True, help='Path to the packed file to create')
+    args = parser.parse_args()
+
+    # Collect .npy files
+    entries = []
+    for root, _, files in os.walk(args.dataDir):
+        for f in sorted(files):
+            if f.endswith('.npy'):
+                path = os.path.join(root, f)
+                name = os.path.relpath(path, args.dataDir).replace(os.path.sep, '/')
+                entries.append((name.encode('utf-8'), path, os.path.getsize(path)))
+    entries.sort()
+
+    # Compute the index size and the offset of each entry
+    index_size = 16 + sum(4 + len(name) + 16 for name, _, _ in entries)
+    offsets = []
+    offset = align(index_size)
+    for _, _, size in entries:
+        offsets.append(offset)
+        offset = align(offset + size)
+
+    with open(args.outFile, 'wb') as out:
+        # Header and index
+        out.write(b'ACLPACK\0')
+        out.write(struct.pack('<II', 1, len(entries)))
+        for (name, _, size), offset in zip(entries, offsets):
+            out.write(struct.pack('<I', len(name)))
+            out.write(name)
+            out.write(struct.pack('<QQ', offset, size))
+
+        # Data
+        for (name, path, size), offset in zip(entries, offsets):
+            out.write(b'\0' * (offset - out.tell()))
+            with open(path, 'rb') as f:
+                out.write(f.read())
+            print('Packed {0} ({1} bytes)'.format(name.decode('utf-8'), size))
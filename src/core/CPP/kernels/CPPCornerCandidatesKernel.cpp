@@ -33,32 +33,33 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
+#include <array>
+
 using namespace arm_compute;
 
 namespace
 {
-inline void check_corner(float x, float y, float strength, InternalKeypoint *output, int32_t *num_corner_candidates, arm_compute::Mutex *corner_candidates_mutex)
+/** Number of candidates a thread buffers before appending them to the shared array */
+constexpr size_t max_local_candidates = 256;
+
+inline void append_candidates(const InternalKeypoint *candidates, size_t num_candidates, InternalKeypoint *output, int32_t *num_corner_candidates, arm_compute::Mutex *corner_candidates_mutex)
 {
-    if(strength != 0.0f)
+    if(num_candidates != 0)
     {
-        /* Set index and update num_corner_candidate */
+        /* Reserve space for the whole batch and update num_corner_candidate */
         std::unique_lock<arm_compute::Mutex> lock(*corner_candidates_mutex);
 
         const int32_t idx = *num_corner_candidates;
 
-        *num_corner_candidates += 1;
+        *num_corner_candidates += static_cast<int32_t>(num_candidates);
 
         lock.unlock();
 
-        /* Add keypoint */
-        output[idx] = std::make_tuple(x, y, strength);
+        /* Add keypoints */
+        std::copy(candidates, candidates + num_candidates, output + idx);
     }
 }
-
-inline void corner_candidates(const float *__restrict input, InternalKeypoint *__restrict output, int32_t x, int32_t y, int32_t *num_corner_candidates, arm_compute::Mutex *corner_candidates_mutex)
-{
-    check_corner(x, y, *input, output, num_corner_candidates, corner_candidates_mutex);
-}
 } // namespace
 
 bool keypoint_compare(const InternalKeypoint &lhs, const InternalKeypoint &rhs)
@@ -100,9 +101,26 @@ void CPPCornerCandidatesKernel::run(const Window &window, const ThreadInfo &info
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     Iterator input(_input, window);
 
+    // Candidates are buffered per thread so the shared counter is only updated once per batch
+    std::array<InternalKeypoint, max_local_candidates> candidates;
+    size_t num_candidates = 0;
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        corner_candidates(reinterpret_cast<float *>(input.ptr()), &_output[0], id.x(), id.y(), _num_corner_candidates, &_corner_candidates_mutex);
+        const float strength = *reinterpret_cast<const float *>(input.ptr());
+
+        if(strength != 0.0f)
+        {
+            candidates[num_candidates++] = std::make_tuple(id.x(), id.y(), strength);
+
+            if(num_candidates == candidates.size())
+            {
+                append_candidates(candidates.data(), num_candidates, _output, _num_corner_candidates, &_corner_candidates_mutex);
+                num_candidates = 0;
+            }
+        }
     },
     input);
+
+    append_candidates(candidates.data(), num_candidates, _output, _num_corner_candidates, &_corner_candidates_mutex);
 }
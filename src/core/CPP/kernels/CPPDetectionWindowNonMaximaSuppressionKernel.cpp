@@ -28,6 +28,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 using namespace arm_compute;
 
@@ -37,6 +40,12 @@ bool compare_detection_window(const DetectionWindow &lhs, const DetectionWindow
 {
     return lhs.score > rhs.score;
 }
+
+/** Unique key of a grid cell, built from the unsigned representation of the coordinates to avoid shifting negative values */
+inline uint64_t cell_key(int x, int y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32) | static_cast<uint32_t>(x);
+}
 } // namespace
 
 CPPDetectionWindowNonMaximaSuppressionKernel::CPPDetectionWindowNonMaximaSuppressionKernel()
@@ -75,48 +84,75 @@ void CPPDetectionWindowNonMaximaSuppressionKernel::run(const Window &window, con
 
     const float min_distance_pow2 = _min_distance * _min_distance;
 
+    // Bucket the candidates on a grid of cells at least min_distance wide, sorted by cell and then by score:
+    // only the candidates of the 3x3 neighbouring cells can be closer than min_distance.
+    // The cells are at least one pixel wide so that a zero or tiny minimum distance can't make the cell coordinates overflow.
+    const float        inv_cell_size = 1.0f / std::max(_min_distance, 1.0f);
+    std::vector<float> centres_x(num_candidates);
+    std::vector<float> centres_y(num_candidates);
+    std::vector<std::pair<uint64_t, size_t>> buckets(num_candidates);
+
+    for(size_t i = 0; i < num_candidates; ++i)
+    {
+        centres_x[i] = _input_output->at(i).x + _input_output->at(i).width * 0.5f;
+        centres_y[i] = _input_output->at(i).y + _input_output->at(i).height * 0.5f;
+        buckets[i]   = std::make_pair(cell_key(std::floor(centres_x[i] * inv_cell_size), std::floor(centres_y[i] * inv_cell_size)), i);
+    }
+
+    std::sort(buckets.begin(), buckets.end());
+
     // Euclidean distance
     for(size_t i = 0; i < num_candidates; ++i)
     {
         if(0.0f != _input_output->at(i).score)
         {
-            DetectionWindow cur;
-            cur.x         = _input_output->at(i).x;
-            cur.y         = _input_output->at(i).y;
-            cur.width     = _input_output->at(i).width;
-            cur.height    = _input_output->at(i).height;
-            cur.idx_class = _input_output->at(i).idx_class;
-            cur.score     = _input_output->at(i).score;
-
-            // Store window
-            _input_output->at(num_detections) = cur;
+            const float xc = centres_x[i];
+            const float yc = centres_y[i];
 
-            ++num_detections;
-
-            const float xc = cur.x + cur.width * 0.5f;
-            const float yc = cur.y + cur.height * 0.5f;
+            const int cell_x = std::floor(xc * inv_cell_size);
+            const int cell_y = std::floor(yc * inv_cell_size);
 
-            for(size_t k = i + 1; k < num_candidates; ++k)
+            for(int ny = cell_y - 1; ny <= cell_y + 1; ++ny)
             {
-                const float xn = _input_output->at(k).x + _input_output->at(k).width * 0.5f;
-                const float yn = _input_output->at(k).y + _input_output->at(k).height * 0.5f;
-
-                const float dx = std::fabs(xn - xc);
-                const float dy = std::fabs(yn - yc);
-
-                if(dx < _min_distance && dy < _min_distance)
+                for(int nx = cell_x - 1; nx <= cell_x + 1; ++nx)
                 {
-                    const float d = dx * dx + dy * dy;
+                    // Only the candidates with a lower score than the current window can be suppressed by it
+                    auto       it  = std::upper_bound(buckets.begin(), buckets.end(), std::make_pair(cell_key(nx, ny), i));
+                    const auto end = std::upper_bound(it, buckets.end(), std::make_pair(cell_key(nx, ny), num_candidates));
 
-                    if(d < min_distance_pow2)
+                    for(; it != end; ++it)
                     {
-                        // Invalidate keypoint
-                        _input_output->at(k).score = 0.0f;
+                        const size_t k = it->second;
+
+                        const float dx = std::fabs(centres_x[k] - xc);
+                        const float dy = std::fabs(centres_y[k] - yc);
+
+                        if(dx < _min_distance && dy < _min_distance)
+                        {
+                            const float d = dx * dx + dy * dy;
+
+                            if(d < min_distance_pow2)
+                            {
+                                // Invalidate keypoint
+                                _input_output->at(k).score = 0.0f;
+                            }
+                        }
                     }
                 }
             }
         }
     }
 
+    // Compact the remaining windows, keeping them sorted by score
+    for(size_t i = 0; i < num_candidates; ++i)
+    {
+        if(0.0f != _input_output->at(i).score)
+        {
+            _input_output->at(num_detections) = _input_output->at(i);
+
+            ++num_detections;
+        }
+    }
+
     _input_output->resize(num_detections);
 }
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/CPP/kernels/CPPSortEuclideanDistanceKernel.h"
 
+#include "arm_compute/core/CPP/kernels/CPPSortKeypointsKernel.h"
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -32,24 +33,18 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 using namespace arm_compute;
 
-namespace
-{
-bool keypoint_compare(const InternalKeypoint &lhs, const InternalKeypoint &rhs)
-{
-    return std::get<2>(lhs) > std::get<2>(rhs);
-}
-} // namespace
-
 CPPSortEuclideanDistanceKernel::CPPSortEuclideanDistanceKernel()
-    : _num_corner_candidates(), _min_distance(0.0f), _in_out(nullptr), _output(nullptr)
+    : _num_corner_candidates(), _min_distance(0.0f), _in_out(nullptr), _output(nullptr), _num_sorted_runs(0), _cell_head(), _kept_next(), _kept()
 {
 }
 
-void CPPSortEuclideanDistanceKernel::configure(InternalKeypoint *in_out, IKeyPointArray *output, const int32_t *num_corner_candidates, float min_distance)
+void CPPSortEuclideanDistanceKernel::configure(InternalKeypoint *in_out, IKeyPointArray *output, const int32_t *num_corner_candidates, float min_distance, unsigned int num_sorted_runs)
 {
     ARM_COMPUTE_ERROR_ON(nullptr == in_out);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
@@ -60,6 +55,7 @@ void CPPSortEuclideanDistanceKernel::configure(InternalKeypoint *in_out, IKeyPoi
     _output                = output;
     _min_distance          = min_distance * min_distance; // We compare squares of distances
     _num_corner_candidates = num_corner_candidates;
+    _num_sorted_runs       = num_sorted_runs;
     ICPPKernel::configure(Window()); // Default 1 iteration window
 }
 
@@ -77,41 +73,124 @@ void CPPSortEuclideanDistanceKernel::run(const Window &window, const ThreadInfo
 
     const int32_t num_corner_candidates = *_num_corner_candidates;
 
+    if(num_corner_candidates <= 0)
+    {
+        return;
+    }
+
     /* Sort list of corner candidates */
-    std::sort(_in_out, _in_out + num_corner_candidates, keypoint_compare);
+    if(_num_sorted_runs == 0)
+    {
+        std::sort(_in_out, _in_out + num_corner_candidates, CPPSortKeypointsKernel::keypoint_compare);
+    }
+    else
+    {
+        // Bottom-up merge of the runs sorted by CPPSortKeypointsKernel
+        for(unsigned int width = 1; width < _num_sorted_runs; width *= 2)
+        {
+            for(unsigned int run = 0; run + width < _num_sorted_runs; run += 2 * width)
+            {
+                const int32_t first  = CPPSortKeypointsKernel::run_bounds(num_corner_candidates, _num_sorted_runs, run).first;
+                const int32_t middle = CPPSortKeypointsKernel::run_bounds(num_corner_candidates, _num_sorted_runs, run + width).first;
+                const int32_t last   = CPPSortKeypointsKernel::run_bounds(num_corner_candidates, _num_sorted_runs, std::min(run + 2 * width, _num_sorted_runs) - 1).second;
+                std::inplace_merge(_in_out + first, _in_out + middle, _in_out + last, CPPSortKeypointsKernel::keypoint_compare);
+            }
+        }
+    }
+
+    /* Bounding box of the valid candidates */
+    float min_x = std::numeric_limits<float>::max();
+    float min_y = std::numeric_limits<float>::max();
+    float max_x = std::numeric_limits<float>::lowest();
+    float max_y = std::numeric_limits<float>::lowest();
 
-    /* Euclidean distance */
     for(int32_t i = 0; i < num_corner_candidates; ++i)
     {
         if(std::get<2>(_in_out[i]) != 0.0f)
         {
-            KeyPoint   keypt;
-            const auto xc = std::get<0>(_in_out[i]);
-            const auto yc = std::get<1>(_in_out[i]);
-
-            keypt.x               = xc;
-            keypt.y               = yc;
-            keypt.strength        = std::get<2>(_in_out[i]);
-            keypt.tracking_status = 1;
-
-            /* Store corner */
-            _output->push_back(keypt);
-            for(int32_t k = i + 1; k < num_corner_candidates; ++k)
-            {
-                const float dx = std::fabs(std::get<0>(_in_out[k]) - xc);
-                const float dy = std::fabs(std::get<1>(_in_out[k]) - yc);
+            min_x = std::min(min_x, std::get<0>(_in_out[i]));
+            min_y = std::min(min_y, std::get<1>(_in_out[i]));
+            max_x = std::max(max_x, std::get<0>(_in_out[i]));
+            max_y = std::max(max_y, std::get<1>(_in_out[i]));
+        }
+    }
+
+    if(min_x > max_x)
+    {
+        return;
+    }
+
+    /* Grid of cells at least as large as the minimum distance: a suppressing keypoint can only be in the 3x3 neighbouring cells.
+     * The cells are at least one pixel wide so that a zero or tiny minimum distance can't make the cell coordinates overflow,
+     * and are grown until the grid is no larger than the number of candidates to bound the memory used. */
+    float   cell_size = std::max(std::sqrt(_min_distance), 1.f);
+    int32_t grid_w    = static_cast<int32_t>((max_x - min_x) / cell_size) + 1;
+    int32_t grid_h    = static_cast<int32_t>((max_y - min_y) / cell_size) + 1;
+
+    while(static_cast<int64_t>(grid_w) * grid_h > std::max(num_corner_candidates, 1024))
+    {
+        cell_size *= 2.0f;
+        grid_w = static_cast<int32_t>((max_x - min_x) / cell_size) + 1;
+        grid_h = static_cast<int32_t>((max_y - min_y) / cell_size) + 1;
+    }
+
+    _cell_head.assign(grid_w * grid_h, -1);
+    _kept_next.clear();
+    _kept.clear();
+
+    /* Euclidean distance */
+    for(int32_t i = 0; i < num_corner_candidates; ++i)
+    {
+        if(std::get<2>(_in_out[i]) == 0.0f)
+        {
+            continue;
+        }
+
+        const auto    xc = std::get<0>(_in_out[i]);
+        const auto    yc = std::get<1>(_in_out[i]);
+        const int32_t cx = static_cast<int32_t>((xc - min_x) / cell_size);
+        const int32_t cy = static_cast<int32_t>((yc - min_y) / cell_size);
+
+        bool suppressed = false;
 
-                if((dx < _min_distance) && (dy < _min_distance))
+        for(int32_t y = std::max(cy - 1, 0); y <= std::min(cy + 1, grid_h - 1) && !suppressed; ++y)
+        {
+            for(int32_t x = std::max(cx - 1, 0); x <= std::min(cx + 1, grid_w - 1) && !suppressed; ++x)
+            {
+                for(int32_t k = _cell_head[x + y * grid_w]; k != -1; k = _kept_next[k])
                 {
-                    const float d = (dx * dx + dy * dy);
+                    const float dx = std::get<0>(_in_out[_kept[k]]) - xc;
+                    const float dy = std::get<1>(_in_out[_kept[k]]) - yc;
 
-                    if(d < _min_distance)
+                    if((dx * dx + dy * dy) < _min_distance)
                     {
-                        /* Invalidate keypoint */
-                        std::get<2>(_in_out[k]) = 0.0f;
+                        suppressed = true;
+                        break;
                     }
                 }
             }
         }
+
+        if(suppressed)
+        {
+            /* Invalidate keypoint */
+            std::get<2>(_in_out[i]) = 0.0f;
+            continue;
+        }
+
+        KeyPoint keypt;
+        keypt.x               = xc;
+        keypt.y               = yc;
+        keypt.strength        = std::get<2>(_in_out[i]);
+        keypt.tracking_status = 1;
+
+        /* Store corner */
+        _output->push_back(keypt);
+
+        /* Add it to its cell */
+        const int32_t cell = cx + cy * grid_w;
+        _kept_next.push_back(_cell_head[cell]);
+        _kept.push_back(i);
+        _cell_head[cell] = static_cast<int32_t>(_kept.size()) - 1;
     }
 }
@@ -1312,6 +1312,110 @@ void mag_phase_l2norm_S32_S32_U32_U8(const void *__restrict gx_ptr, const void *
     }
 }
 
+/* Loads 40 consecutive U8 pixels and widens them to S16
+ *
+ * @param[in]  ptr  Pointer to the first pixel to load
+ * @param[out] tail The last 8 widened pixels
+ *
+ * @return The first 32 widened pixels, 8 per vector
+ */
+inline int16x8x4_t load_row_U8_S16(const uint8_t *__restrict ptr, int16x8_t &tail)
+{
+    const uint8x16_t data0 = vld1q_u8(ptr);
+    const uint8x16_t data1 = vld1q_u8(ptr + 16);
+
+    tail = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ptr + 32)));
+
+    const int16x8x4_t out =
+    {
+        {
+            vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data0))),
+            vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(data0))),
+            vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data1))),
+            vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(data1)))
+        }
+    };
+
+    return out;
+}
+
+/* Computes the 3x3 Sobel gradients of 8 pixels
+ *
+ * @param[in]  top0 Top row, left neighbours of the 8 pixels
+ * @param[in]  top1 Top row, the following 8 pixels
+ * @param[in]  mid0 Middle row, left neighbours of the 8 pixels
+ * @param[in]  mid1 Middle row, the following 8 pixels
+ * @param[in]  bot0 Bottom row, left neighbours of the 8 pixels
+ * @param[in]  bot1 Bottom row, the following 8 pixels
+ * @param[out] gx   Gradient along the X direction
+ * @param[out] gy   Gradient along the Y direction
+ */
+inline void sobel3x3_S16(int16x8_t top0, int16x8_t top1, int16x8_t mid0, int16x8_t mid1, int16x8_t bot0, int16x8_t bot1, int16x8_t &gx, int16x8_t &gy)
+{
+    const int16x8_t two      = vdupq_n_s16(2);
+    const int16x8_t minustwo = vdupq_n_s16(-2);
+
+    // Sobel Y
+    gy = vnegq_s16(top0);
+    gy = vmlaq_s16(gy, vextq_s16(top0, top1, 1), minustwo);
+    gy = vsubq_s16(gy, vextq_s16(top0, top1, 2));
+    gy = vaddq_s16(gy, bot0);
+    gy = vmlaq_s16(gy, vextq_s16(bot0, bot1, 1), two);
+    gy = vaddq_s16(gy, vextq_s16(bot0, bot1, 2));
+
+    // Sobel X
+    gx = vnegq_s16(top0);
+    gx = vaddq_s16(gx, vextq_s16(top0, top1, 2));
+    gx = vmlaq_s16(gx, mid0, minustwo);
+    gx = vmlaq_s16(gx, vextq_s16(mid0, mid1, 2), two);
+    gx = vsubq_s16(gx, bot0);
+    gx = vaddq_s16(gx, vextq_s16(bot0, bot1, 2));
+}
+
+/* Fused 3x3 Sobel and gradient function. Computes 32 pixels per call.
+ *
+ * @param[in]  top_ptr       Pointer to the top-left neighbour of the first pixel. Data type supported U8
+ * @param[in]  mid_ptr       Pointer to the left neighbour of the first pixel. Data type supported U8
+ * @param[in]  bot_ptr       Pointer to the bottom-left neighbour of the first pixel. Data type supported U8
+ * @param[out] magnitude_ptr Pointer to destination image. Magnitude. Data type supported U16
+ * @param[out] phase_ptr     Pointer to destination image. Quantized phase. Data type supported U8
+ */
+template <int32_t norm_type>
+void sobel3x3_mag_phase_U8_U16_U8(const uint8_t *__restrict top_ptr, const uint8_t *__restrict mid_ptr, const uint8_t *__restrict bot_ptr, void *__restrict magnitude_ptr,
+                                  void *__restrict phase_ptr)
+{
+    const auto magnitude = static_cast<uint16_t *__restrict>(magnitude_ptr);
+    const auto phase     = static_cast<uint8_t *__restrict>(phase_ptr);
+
+    int16x8_t         top_tail;
+    int16x8_t         mid_tail;
+    int16x8_t         bot_tail;
+    const int16x8x4_t top = load_row_U8_S16(top_ptr, top_tail);
+    const int16x8x4_t mid = load_row_U8_S16(mid_ptr, mid_tail);
+    const int16x8x4_t bot = load_row_U8_S16(bot_ptr, bot_tail);
+
+    int16x8x4_t gx_val{ {} };
+    int16x8x4_t gy_val{ {} };
+
+    sobel3x3_S16(top.val[0], top.val[1], mid.val[0], mid.val[1], bot.val[0], bot.val[1], gx_val.val[0], gy_val.val[0]);
+    sobel3x3_S16(top.val[1], top.val[2], mid.val[1], mid.val[2], bot.val[1], bot.val[2], gx_val.val[1], gy_val.val[1]);
+    sobel3x3_S16(top.val[2], top.val[3], mid.val[2], mid.val[3], bot.val[2], bot.val[3], gx_val.val[2], gy_val.val[2]);
+    sobel3x3_S16(top.val[3], top_tail, mid.val[3], mid_tail, bot.val[3], bot_tail, gx_val.val[3], gy_val.val[3]);
+
+    // Compute and store phase
+    vst1_u8(phase + 0, phase_quantization_S16_S16(gx_val.val[0], gy_val.val[0]));
+    vst1_u8(phase + 8, phase_quantization_S16_S16(gx_val.val[1], gy_val.val[1]));
+    vst1_u8(phase + 16, phase_quantization_S16_S16(gx_val.val[2], gy_val.val[2]));
+    vst1_u8(phase + 24, phase_quantization_S16_S16(gx_val.val[3], gy_val.val[3]));
+
+    // Compute and store magnitude
+    for(size_t i = 0; i < 4; ++i)
+    {
+        const uint16x8_t mag = (norm_type == 1) ? mag_l1_S16_S16(gx_val.val[i], gy_val.val[i]) : mag_l2_S16_S16(gx_val.val[i], gy_val.val[i]);
+        vst1q_u16(magnitude + 8 * i, mag);
+    }
+}
+
 /* Computes non-maxima suppression and hysteresis when the gradient size = 3 or 5
  *
  * @param[in]  magnitude_ptr Pointer to source image. Magnitude. Data type supported U16
@@ -1695,6 +1799,87 @@ void NEGradientKernel::run(const Window &window, const ThreadInfo &info)
     gx, gy, magnitude, phase);
 }
 
+NESobel3x3GradientKernel::NESobel3x3GradientKernel()
+    : _func(nullptr), _input(nullptr), _magnitude(nullptr), _phase(nullptr)
+{
+}
+
+BorderSize NESobel3x3GradientKernel::border_size() const
+{
+    return BorderSize(1);
+}
+
+void NESobel3x3GradientKernel::configure(const ITensor *input, ITensor *magnitude, ITensor *phase, int32_t norm_type, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, magnitude, phase);
+
+    set_shape_if_empty(*magnitude->info(), input->info()->tensor_shape());
+    set_shape_if_empty(*phase->info(), input->info()->tensor_shape());
+
+    set_format_if_unknown(*magnitude->info(), Format::U16);
+    set_format_if_unknown(*phase->info(), Format::U8);
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, magnitude, phase);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(magnitude, 1, DataType::U16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(phase, 1, DataType::U8);
+
+    _input     = input;
+    _magnitude = magnitude;
+    _phase     = phase;
+
+    if(norm_type == 1)
+    {
+        _func = &sobel3x3_mag_phase_U8_U16_U8<1>;
+    }
+    else
+    {
+        _func = &sobel3x3_mag_phase_U8_U16_U8<2>;
+    }
+
+    constexpr unsigned int num_elems_processed_per_iteration = 32;
+    constexpr unsigned int num_elems_read_per_iteration      = 40;
+    constexpr unsigned int num_rows_read_per_iteration       = 3;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+
+    AccessWindowHorizontal mag_access(magnitude->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal phase_access(phase->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_read_per_iteration, num_rows_read_per_iteration),
+                              mag_access,
+                              phase_access);
+
+    mag_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+    phase_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+void NESobel3x3GradientKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    const uint8_t *const input_top_ptr = _input->ptr_to_element(Coordinates(-1, -1));
+    const uint8_t *const input_mid_ptr = _input->ptr_to_element(Coordinates(-1, 0));
+    const uint8_t *const input_bot_ptr = _input->ptr_to_element(Coordinates(-1, 1));
+
+    Iterator input(_input, window);
+    Iterator magnitude(_magnitude, window);
+    Iterator phase(_phase, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        (*_func)(input_top_ptr + input.offset(), input_mid_ptr + input.offset(), input_bot_ptr + input.offset(), magnitude.ptr(), phase.ptr());
+    },
+    input, magnitude, phase);
+}
+
 NEEdgeNonMaxSuppressionKernel::NEEdgeNonMaxSuppressionKernel()
     : _func(nullptr), _magnitude(nullptr), _phase(nullptr), _output(nullptr), _lower_thr(0), _upper_thr(0)
 {
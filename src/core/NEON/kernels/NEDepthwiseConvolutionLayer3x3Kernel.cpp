@@ -143,6 +143,44 @@ inline void convolve_3x3(const Window &window, unsigned int num_elems_written_pe
             ARM_COMPUTE_ERROR("Not implemented");
     }
 }
+
+template <typename T>
+std::unique_ptr<depthwise::IDepthwiseConvolution> create_typed_convolver(const TensorShape &shape, const PadStrideInfo &conv_info,
+                                                                         const uint8_t *w_ptr, uint8_t *in_ptr, uint8_t *out_ptr)
+{
+    const int  in_rows      = shape.z();
+    const int  in_cols      = shape.y();
+    const int  n_batches    = shape[3];
+    const int  n_channels   = shape.x();
+    const bool padding_same = conv_info.has_padding();
+
+    const auto stride_x = conv_info.stride().first;
+    switch(stride_x)
+    {
+        case 1:
+            return arm_compute::support::cpp14::make_unique<DepthwiseConvolution<2, 2, 3, 3, 1, 1, T, T>>(
+                       n_batches,
+                       in_rows,
+                       in_cols,
+                       n_channels,
+                       padding_same,
+                       reinterpret_cast<const T *>(w_ptr),
+                       reinterpret_cast<T *>(in_ptr),
+                       reinterpret_cast<T *>(out_ptr));
+        case 2:
+            return arm_compute::support::cpp14::make_unique<DepthwiseConvolution<2, 2, 3, 3, 2, 2, T, T>>(
+                       n_batches,
+                       in_rows,
+                       in_cols,
+                       n_channels,
+                       padding_same,
+                       reinterpret_cast<const T *>(w_ptr),
+                       reinterpret_cast<T *>(in_ptr),
+                       reinterpret_cast<T *>(out_ptr));
+        default:
+            return nullptr;
+    }
+}
 } // namespace
 
 NEDepthwiseConvolutionLayer3x3Kernel::NEDepthwiseConvolutionLayer3x3Kernel()
@@ -157,7 +195,7 @@ BorderSize NEDepthwiseConvolutionLayer3x3Kernel::border_size() const
 
 void NEDepthwiseConvolutionLayer3x3Kernel::configure(const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info, DataLayout data_layout)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
 
     _input     = input;
@@ -194,7 +232,11 @@ bool NEDepthwiseConvolutionLayer3x3Kernel::is_optimized_execution_possible(Tenso
     }
 
     // Check supported data type
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    bool supported_datatype = (dt == DataType::F32) || (dt == DataType::F16);
+#else  /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
     bool supported_datatype = (dt == DataType::F32);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 
     // Check for supported strides
     const auto &strides           = conv_info.stride();
@@ -215,11 +257,11 @@ bool NEDepthwiseConvolutionLayer3x3Kernel::is_optimized_execution_possible(Tenso
 
 void NEDepthwiseConvolutionLayer3x3Kernel::generate_convolver()
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(_input, _weights);
     ARM_COMPUTE_ERROR_ON(_weights->info()->dimension(1) != 3 || _weights->info()->dimension(2) != 3);
 
-    _convolver = create_convolver_object(_input->info()->tensor_shape(), _conv_info,
+    _convolver = create_convolver_object(_input->info()->tensor_shape(), _conv_info, _input->info()->data_type(),
                                          _weights->buffer(), _input->buffer(), _output->buffer());
 }
 
@@ -257,6 +299,12 @@ void NEDepthwiseConvolutionLayer3x3Kernel::configure_generic()
             num_elems_read_per_iteration     = 12;
             _num_elems_written_per_iteration = 16 >> conv_stride_x;
             break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            num_elems_read_per_iteration     = 24;
+            _num_elems_written_per_iteration = 32 >> conv_stride_x;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         default:
             ARM_COMPUTE_ERROR("Data type not supported.");
     }
@@ -282,7 +330,7 @@ void NEDepthwiseConvolutionLayer3x3Kernel::configure_optimized()
     ARM_COMPUTE_ERROR_ON(_weights->info()->dimension(1) != 3 || _weights->info()->dimension(2) != 3);
 
     _border_size = BorderSize(0, 0);
-    _convolver   = create_convolver_object(_input->info()->tensor_shape(), _conv_info,
+    _convolver   = create_convolver_object(_input->info()->tensor_shape(), _conv_info, _input->info()->data_type(),
                                            _weights->buffer(), _input->buffer(), _output->buffer());
 
     // Auto-configure output
@@ -312,6 +360,11 @@ void NEDepthwiseConvolutionLayer3x3Kernel::run_generic(const Window &window, con
         case DataType::F32:
             convolve_3x3<float, float>(window, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
             break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            convolve_3x3<float16_t, float16_t>(window, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         case DataType::QASYMM8:
             convolve_3x3<uint8_t, int32_t>(window, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
             break;
@@ -332,40 +385,20 @@ void NEDepthwiseConvolutionLayer3x3Kernel::run_optimized(const Window &window, c
 
 std::unique_ptr<depthwise::IDepthwiseConvolution> NEDepthwiseConvolutionLayer3x3Kernel::create_convolver_object(TensorShape    shape,
                                                                                                                 PadStrideInfo  conv_info,
+                                                                                                                DataType       dt,
                                                                                                                 const uint8_t *w_ptr,
                                                                                                                 uint8_t       *in_ptr,
                                                                                                                 uint8_t       *out_ptr)
 {
-    const int  in_rows      = shape.z();
-    const int  in_cols      = shape.y();
-    const int  n_batches    = shape[3];
-    const int  n_channels   = shape.x();
-    const bool padding_same = conv_info.has_padding();
-
-    const auto stride_x = conv_info.stride().first;
-    switch(stride_x)
+    switch(dt)
     {
-        case 1:
-            return arm_compute::support::cpp14::make_unique<DepthwiseConvolution<2, 2, 3, 3, 1, 1, float, float>>(
-                       n_batches,
-                       in_rows,
-                       in_cols,
-                       n_channels,
-                       padding_same,
-                       reinterpret_cast<const float *>(w_ptr),
-                       reinterpret_cast<float *>(in_ptr),
-                       reinterpret_cast<float *>(out_ptr));
-        case 2:
-            return arm_compute::support::cpp14::make_unique<DepthwiseConvolution<2, 2, 3, 3, 2, 2, float, float>>(
-                       n_batches,
-                       in_rows,
-                       in_cols,
-                       n_channels,
-                       padding_same,
-                       reinterpret_cast<const float *>(w_ptr),
-                       reinterpret_cast<float *>(in_ptr),
-                       reinterpret_cast<float *>(out_ptr));
+        case DataType::F32:
+            return create_typed_convolver<float>(shape, conv_info, w_ptr, in_ptr, out_ptr);
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            return create_typed_convolver<float16_t>(shape, conv_info, w_ptr, in_ptr, out_ptr);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         default:
             return nullptr;
     }
-}
\ No newline at end of file
+}
@@ -94,6 +94,28 @@ float16x8_t internal_vld1q<3>(const float16_t *in)
     return tmp.val[0];
 }
 
+template <unsigned int stridex>
+float16x8_t internal_vld1q_strided(const float16_t *in, int stride)
+{
+    ARM_COMPUTE_UNUSED(stride);
+    return internal_vld1q<stridex>(in);
+}
+
+template <>
+float16x8_t internal_vld1q_strided<0>(const float16_t *in, int stride)
+{
+    float16x8_t r = vdupq_n_f16(0);
+    r             = vld1q_lane_f16(in + 0 * stride, r, 0);
+    r             = vld1q_lane_f16(in + 1 * stride, r, 1);
+    r             = vld1q_lane_f16(in + 2 * stride, r, 2);
+    r             = vld1q_lane_f16(in + 3 * stride, r, 3);
+    r             = vld1q_lane_f16(in + 4 * stride, r, 4);
+    r             = vld1q_lane_f16(in + 5 * stride, r, 5);
+    r             = vld1q_lane_f16(in + 6 * stride, r, 6);
+    r             = vld1q_lane_f16(in + 7 * stride, r, 7);
+    return r;
+}
+
 inline float16x8_t internal_vdupq_n(float16_t v)
 {
     return vdupq_n_f16(v);
@@ -140,6 +162,24 @@ float32x4_t internal_vld1q<3>(const float *in)
     return tmp.val[0];
 }
 
+template <unsigned int stridex>
+float32x4_t internal_vld1q_strided(const float *in, int stride)
+{
+    ARM_COMPUTE_UNUSED(stride);
+    return internal_vld1q<stridex>(in);
+}
+
+template <>
+float32x4_t internal_vld1q_strided<0>(const float *in, int stride)
+{
+    float32x4_t r = vdupq_n_f32(0.f);
+    r             = vld1q_lane_f32(in + 0 * stride, r, 0);
+    r             = vld1q_lane_f32(in + 1 * stride, r, 1);
+    r             = vld1q_lane_f32(in + 2 * stride, r, 2);
+    r             = vld1q_lane_f32(in + 3 * stride, r, 3);
+    return r;
+}
+
 inline float32x4_t internal_vdupq_n(float v)
 {
     return vdupq_n_f32(v);
@@ -899,6 +939,106 @@ public:
     }
 };
 
+// Register-blocked convolver for floating point kernels of any width and height (e.g. 7x7, 1x7, 7x1) and any stride.
+// Each iteration keeps two NEON registers of output values live and accumulates all the kernel taps of an input plane into them,
+// so that each output element is loaded and stored only once per input plane. A stridex of 0 selects the lane-gather path used for strides larger than 3.
+template <typename T, unsigned int stridex>
+class convolver_nxm
+{
+public:
+    static void convolve(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
+                         const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+    {
+        ARM_COMPUTE_UNUSED(num_elems_read_per_iteration);
+        const int          num_elems_per_vector = 16 / sizeof(T);
+        const int          input_stride_x       = input->info()->strides_in_bytes().x();
+        const int          input_stride_y       = input->info()->strides_in_bytes().y();
+        const int          input_stride_z       = input->info()->strides_in_bytes().z();
+        const int          output_stride_y      = output->info()->strides_in_bytes().y();
+        const int          output_stride_z      = output->info()->strides_in_bytes().z();
+        const int          kernel_stride_x      = weights->info()->strides_in_bytes().x();
+        const int          kernel_stride_y      = weights->info()->strides_in_bytes().y();
+        const int          kernel_stride_z      = weights->info()->strides_in_bytes().z();
+        const int          kernel_stride_w      = weights->info()->strides_in_bytes()[3];
+        const int          kernel_w             = weights->info()->dimension(0);
+        const int          kernel_h             = weights->info()->dimension(1);
+        const int          output_w             = output->info()->dimension(0);
+        const int          output_h             = output->info()->dimension(1);
+        const int          num_planes_z         = window.z().end() - window.z().start();
+        const int          kernel_depth         = weights->info()->dimension(Window::DimZ);
+        const int          conv_stride_x        = std::get<0>(conv_info.stride());
+        const unsigned int conv_stride_y        = std::get<1>(conv_info.stride());
+        const unsigned int conv_pad_left        = conv_info.pad_left();
+        const unsigned int conv_pad_top         = conv_info.pad_top();
+        const int          fixed_point_position = input->info()->fixed_point_position();
+
+        // setup output window for the iterator
+        Window window_out = window;
+        window_out.set(Window::DimX, Window::Dimension(0, output->info()->dimension(Window::DimX), output->info()->dimension(Window::DimX)));
+        window_out.set(Window::DimY, Window::Dimension(0, output->info()->dimension(Window::DimY), output->info()->dimension(Window::DimY)));
+        window_out.set(Window::DimZ, Window::Dimension(window.z().start(), window.z().end(), num_planes_z));
+
+        // setup input window for the iterator
+        Window window_in = window;
+        // we just want execute_window_loop to iterate over the higher dimensions (>3), so we set the first 3 dimensions to 0
+        window_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+        window_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+        window_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+        Window window_k = calculate_max_window(*weights->info(), Steps(1u));
+
+        Iterator out(output, window_out);
+        Iterator in(input, window_in);
+        Iterator k(weights, window_k);
+
+        const uint8_t *k_ptr = k.ptr();
+
+        execute_window_loop(window_out, [&](const Coordinates & id)
+        {
+            const uint8_t *input_ptr = in.ptr() - conv_pad_left * input_stride_x - conv_pad_top * input_stride_y;
+            uint8_t       *out_ptr   = out.ptr();
+            for(int oz = 0; oz < num_planes_z; ++oz)
+            {
+                const int zoffset    = id.z() + oz;
+                uint8_t *p_out_base = out_ptr + oz * output_stride_z;
+                for(int p = 0; p < kernel_depth; ++p)
+                {
+                    const uint8_t *ptr_k_base = k_ptr + p * kernel_stride_z + zoffset * kernel_stride_w;
+                    const uint8_t *input_base = input_ptr + p * input_stride_z;
+                    for(int ih = 0, oh = 0; oh < output_h; ++oh, ih += conv_stride_y)
+                    {
+                        auto p_out = reinterpret_cast<T *>(p_out_base + oh * output_stride_y);
+                        for(int ow = 0; ow < output_w; ow += num_elems_written_per_iteration, p_out += num_elems_written_per_iteration)
+                        {
+                            // The first input plane initializes the output, the remaining ones accumulate into it
+                            auto acc0 = (p == 0) ? internal_vdupq_n(static_cast<T>(0)) : internal_vld1q<1>(p_out);
+                            auto acc1 = (p == 0) ? internal_vdupq_n(static_cast<T>(0)) : internal_vld1q<1>(p_out + num_elems_per_vector);
+
+                            for(int kh = 0; kh < kernel_h; ++kh)
+                            {
+                                const auto in_row = reinterpret_cast<const T *>(input_base + (ih + kh) * input_stride_y) + ow * conv_stride_x;
+                                const auto k_row  = ptr_k_base + kh * kernel_stride_y;
+                                for(int kw = 0; kw < kernel_w; ++kw)
+                                {
+                                    const auto vk  = internal_vdupq_n(*reinterpret_cast<const T *>(k_row + kw * kernel_stride_x));
+                                    const auto vi0 = internal_vld1q_strided<stridex>(in_row + kw, conv_stride_x);
+                                    const auto vi1 = internal_vld1q_strided<stridex>(in_row + kw + num_elems_per_vector * conv_stride_x, conv_stride_x);
+                                    acc0           = internal_vmlal(acc0, vi0, vk, fixed_point_position);
+                                    acc1           = internal_vmlal(acc1, vi1, vk, fixed_point_position);
+                                }
+                            }
+
+                            internal_vst1q(p_out, acc0);
+                            internal_vst1q(p_out + num_elems_per_vector, acc1);
+                        }
+                    }
+                }
+            }
+        },
+        in, out);
+    }
+};
+
 template <typename T1, typename T2>
 inline void convolve_1x1(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
                          const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
@@ -1003,11 +1143,54 @@ inline void convolve_5x5(const Window &window, unsigned int num_elems_read_per_i
     }
 }
 
-inline TensorShape get_convolved_dimensions(const ITensorInfo *input, const ITensorInfo *weights, const int kernel_size, const PadStrideInfo &conv_info)
+template <typename T>
+inline void convolve_nxm(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
+                         const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+{
+    const unsigned int conv_stride_x = std::get<0>(conv_info.stride());
+    switch(conv_stride_x)
+    {
+        case 1:
+            convolver_nxm<T, 1>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 2:
+            convolver_nxm<T, 2>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 3:
+            convolver_nxm<T, 3>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        default:
+            convolver_nxm<T, 0>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+    }
+}
+
+/** Checks whether the convolution has to be run by the generic NxM convolver
+ *
+ * The specialised convolvers only handle square 1x1, 3x3 and 5x5 kernels with strides up to 3,
+ * any other floating point configuration is dispatched to @ref convolver_nxm.
+ */
+inline bool run_generic_convolver(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info)
+{
+    const DataType     data_type     = input->data_type();
+    const unsigned int kernel_w      = weights->dimension(0);
+    const unsigned int kernel_h      = weights->dimension(1);
+    const unsigned int conv_stride_x = std::get<0>(conv_info.stride());
+
+    if(!is_data_type_float(data_type))
+    {
+        return false;
+    }
+
+    const bool is_specialised_size = (kernel_w == kernel_h) && ((kernel_w == 1) || (kernel_w == 3) || (kernel_w == 5 && data_type == DataType::F32));
+    return !is_specialised_size || (conv_stride_x > 3);
+}
+
+inline TensorShape get_convolved_dimensions(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info)
 {
     unsigned int output_width  = 0;
     unsigned int output_height = 0;
-    std::tie(output_width, output_height) = scaled_dimensions(input->dimension(0), input->dimension(1), kernel_size, kernel_size, conv_info);
+    std::tie(output_width, output_height) = scaled_dimensions(input->dimension(0), input->dimension(1), weights->dimension(0), weights->dimension(1), conv_info);
 
     TensorShape output_shape = input->tensor_shape();
     output_shape.set(0, output_width);
@@ -1023,15 +1206,20 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights,
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
 
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(std::get<0>(conv_info.stride()) > 3, "Strides larger than 3 not supported.");
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(2) != input->dimension(2));
-    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != weights->dimension(1));
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
+    if(!is_data_type_float(input->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(std::get<0>(conv_info.stride()) > 3, "Strides larger than 3 not supported.");
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != weights->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(0) != 1 && weights->dimension(0) != 3, "Only kernel sizes 1x1 and 3x3 are supported for fixed point.");
+    }
+
     // Checks performed when output is configured
     if(output->total_size() != 0)
     {
-        TensorShape output_shape = get_convolved_dimensions(input, weights, weights->dimension(0), conv_info);
+        TensorShape output_shape = get_convolved_dimensions(input, weights, conv_info);
 
         DataType data_type = input->data_type();
         if(is_data_type_fixed_point(data_type))
@@ -1052,77 +1240,93 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 {
     // Calculate right and bottom border
     unsigned int kernel_size   = weights->dimension(0);
+    unsigned int kernel_height = weights->dimension(1);
     const int    conv_stride_x = std::get<0>(conv_info.stride());
     const int    conv_stride_y = std::get<1>(conv_info.stride());
     const int    input_width   = input->dimension(0);
 
-    switch(kernel_size)
+    // Calculate right pad
+    int upper_bound_w = 0;
+
+    if(run_generic_convolver(input, weights, conv_info))
     {
-        case 1:
+        // Two NEON registers of outputs per iteration
+        num_elems_written_per_iteration = 32 / input->element_size();
+        num_weight_elems_read_per_row   = kernel_size;
+        num_elems_read_per_iteration    = num_elems_written_per_iteration * conv_stride_x + kernel_size - 1;
+
+        const int end_x = ceil_to_multiple(static_cast<int>(output->dimension(0)), num_elems_written_per_iteration) * conv_stride_x;
+        upper_bound_w   = end_x + kernel_size - 1 - static_cast<int>(conv_info.pad_left()) - input_width;
+    }
+    else
+    {
+        switch(kernel_size)
         {
-            switch(input->data_type())
+            case 1:
             {
+                switch(input->data_type())
+                {
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-                case DataType::F16:
+                    case DataType::F16:
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
-                case DataType::QS8:
-                case DataType::QS16:
-                    num_elems_written_per_iteration = 8;
-                    break;
-                case DataType::F32:
-                    if(run_optim_small_tensor_info(input))
-                    {
+                    case DataType::QS8:
+                    case DataType::QS16:
                         num_elems_written_per_iteration = 8;
-                    }
-                    else
-                    {
-                        num_elems_written_per_iteration = 4;
-                    }
-                    break;
-                default:
-                    ARM_COMPUTE_ERROR("Data type not supported.");
-                    break;
+                        break;
+                    case DataType::F32:
+                        if(run_optim_small_tensor_info(input))
+                        {
+                            num_elems_written_per_iteration = 8;
+                        }
+                        else
+                        {
+                            num_elems_written_per_iteration = 4;
+                        }
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Data type not supported.");
+                        break;
+                }
+                num_weight_elems_read_per_row = kernel_size;
+                num_elems_read_per_iteration  = conv_stride_x * num_elems_written_per_iteration;
+                break;
             }
-            num_weight_elems_read_per_row = kernel_size;
-            num_elems_read_per_iteration  = conv_stride_x * num_elems_written_per_iteration;
-            break;
-        }
-        case 3:
-        case 5:
-        {
-            switch(input->data_type())
+            case 3:
+            case 5:
             {
-                case DataType::F32:
-                    num_weight_elems_read_per_row   = 4 + kernel_size - 1;
-                    num_elems_read_per_iteration    = 12;
-                    num_elems_written_per_iteration = 16 >> conv_stride_x;
-                    break;
+                switch(input->data_type())
+                {
+                    case DataType::F32:
+                        num_weight_elems_read_per_row   = 4 + kernel_size - 1;
+                        num_elems_read_per_iteration    = 12;
+                        num_elems_written_per_iteration = 16 >> conv_stride_x;
+                        break;
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-                case DataType::F16:
+                    case DataType::F16:
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
-                case DataType::QS8:
-                case DataType::QS16:
-                    num_weight_elems_read_per_row   = 8 + kernel_size - 1;
-                    num_elems_read_per_iteration    = 24;
-                    num_elems_written_per_iteration = 32 >> conv_stride_x;
-                    break;
-                default:
-                    ARM_COMPUTE_ERROR("Data type not supported.");
-                    break;
+                    case DataType::QS8:
+                    case DataType::QS16:
+                        num_weight_elems_read_per_row   = 8 + kernel_size - 1;
+                        num_elems_read_per_iteration    = 24;
+                        num_elems_written_per_iteration = 32 >> conv_stride_x;
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Data type not supported.");
+                        break;
+                }
             }
-        }
-        break;
-        default:
-        {
-            ARM_COMPUTE_ERROR("Not implemented");
             break;
+            default:
+            {
+                ARM_COMPUTE_ERROR("Not implemented");
+                break;
+            }
         }
-    }
 
-    // Calculate right pad
-    int start_x       = kernel_size / 2 - static_cast<int>(conv_info.pad_left());
-    int end_x         = ceil_to_multiple(static_cast<int>(output->dimension(0)), num_elems_written_per_iteration) * conv_stride_x;
-    int upper_bound_w = ceil_to_multiple(start_x + end_x, num_elems_read_per_iteration) - input_width;
+        const int start_x = kernel_size / 2 - static_cast<int>(conv_info.pad_left());
+        const int end_x   = ceil_to_multiple(static_cast<int>(output->dimension(0)), num_elems_written_per_iteration) * conv_stride_x;
+        upper_bound_w     = ceil_to_multiple(start_x + end_x, num_elems_read_per_iteration) - input_width;
+    }
 
     // Calculate border
     const unsigned int conv_pad_left   = conv_info.pad_left();
@@ -1139,9 +1343,9 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
     Window win = calculate_max_window(*output, Steps(num_elems_written_per_iteration));
 
     AccessWindowRectangle input_access(input, -conv_pad_left, -conv_pad_top,
-                                       num_elems_read_per_iteration, kernel_size,
+                                       num_elems_read_per_iteration, kernel_height,
                                        conv_stride_x, conv_stride_y);
-    AccessWindowStatic     weights_access(weights, 0, 0, num_weight_elems_read_per_row, kernel_size);
+    AccessWindowStatic     weights_access(weights, 0, 0, num_weight_elems_read_per_row, kernel_height);
     AccessWindowHorizontal output_access(output, 0, num_elems_written_per_iteration);
     bool                   window_changed = update_window_and_padding(win, input_access, weights_access, output_access);
     output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
@@ -1179,7 +1383,7 @@ void NEDirectConvolutionLayerKernel::configure(const ITensor *input, const ITens
     _border_size                       = BorderSize(conv_pad_top, conv_pad_right, conv_pad_bottom, conv_pad_left);
 
     // Get convolved dimensions
-    TensorShape output_shape = get_convolved_dimensions(input->info(), weights->info(), _kernel_size, conv_info);
+    TensorShape output_shape = get_convolved_dimensions(input->info(), weights->info(), conv_info);
 
     DataType data_type = input->info()->data_type();
 
@@ -1231,6 +1435,25 @@ void NEDirectConvolutionLayerKernel::run(const Window &window, const ThreadInfo
 
     const int kernel_size = _weights->info()->dimension(0);
 
+    if(run_generic_convolver(_input->info(), _weights->info(), _conv_info))
+    {
+        switch(_input->info()->data_type())
+        {
+            case DataType::F32:
+                convolve_nxm<float>(window, _num_elems_read_per_iteration, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
+                break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+            case DataType::F16:
+                convolve_nxm<float16_t>(window, _num_elems_read_per_iteration, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
+                break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+            default:
+                ARM_COMPUTE_ERROR("Data type not supported");
+                break;
+        }
+        return;
+    }
+
     switch(kernel_size)
     {
         case 1:
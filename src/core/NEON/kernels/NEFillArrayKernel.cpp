@@ -29,10 +29,18 @@
 #include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/Validate.h"
 
+#include <array>
+
 using namespace arm_compute;
 
+namespace
+{
+/** Number of keypoints a thread buffers before appending them to the shared array */
+constexpr size_t max_local_keypoints = 256;
+} // namespace
+
 NEFillArrayKernel::NEFillArrayKernel()
-    : _input(nullptr), _output(nullptr), _threshold(0)
+    : _input(nullptr), _output(nullptr), _threshold(0), _mtx()
 {
 }
 
@@ -57,11 +65,6 @@ void NEFillArrayKernel::configure(const IImage *input, uint8_t threshold, IKeyPo
     INEKernel::configure(win);
 }
 
-bool NEFillArrayKernel::is_parallelisable() const
-{
-    return false;
-}
-
 void NEFillArrayKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
@@ -70,11 +73,32 @@ void NEFillArrayKernel::run(const Window &window, const ThreadInfo &info)
 
     Iterator input(_input, window);
 
+    // Keypoints are buffered per thread so the array is only locked once per batch
+    std::array<KeyPoint, max_local_keypoints> keypoints;
+    size_t num_keypoints = 0;
+    bool   overflowed    = false;
+
+    auto append_keypoints = [&]()
+    {
+        std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+        for(size_t i = 0; i < num_keypoints; ++i)
+        {
+            if(!_output->push_back(keypoints[i]))
+            {
+                overflowed = true; //Overflowed: stop trying to add more points
+                break;
+            }
+        }
+
+        num_keypoints = 0;
+    };
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
         const uint8_t value = *input.ptr();
 
-        if(value >= _threshold)
+        if(value >= _threshold && !overflowed)
         {
             KeyPoint p;
             p.x               = id.x();
@@ -85,11 +109,18 @@ void NEFillArrayKernel::run(const Window &window, const ThreadInfo &info)
             p.orientation     = 0.f;
             p.error           = 0.f;
 
-            if(!_output->push_back(p))
+            keypoints[num_keypoints++] = p;
+
+            if(num_keypoints == keypoints.size())
             {
-                return; //Overflowed: stop trying to add more points
+                append_keypoints();
             }
         }
     },
     input);
+
+    if(num_keypoints != 0 && !overflowed)
+    {
+        append_keypoints();
+    }
 }
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEGEMMAssemblyBatchedKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "support/ToolchainSupport.h"
+
+namespace arm_compute
+{
+#include "arm_compute/core/NEON/kernels/assembly/gemm_interleaved.hpp"
+#include "arm_compute/core/NEON/kernels/assembly/kernels/a32_sgemm_8x6.hpp"
+#include "arm_compute/core/NEON/kernels/assembly/kernels/a64_sgemm_12x8.hpp"
+} // namespace arm_compute
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace
+{
+#if defined(__aarch64__)
+using batched_strategy = sgemm_12x8;
+#elif defined(__arm__)
+using batched_strategy = sgemm_8x6;
+#endif /* defined(__arm__) || defined(__aarch64__) */
+
+Status validate_arguments(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c)
+{
+#if !defined(__arm__) && !defined(__aarch64__)
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(true, "The assembly GEMM is not available on this architecture");
+#endif /* !defined(__arm__) && !defined(__aarch64__) */
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, c);
+    ARM_COMPUTE_RETURN_ERROR_ON(a->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(b->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(c->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(1), "The number of columns in A must be equal to the number of rows in B");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(c->dimension(0) != b->dimension(0), "The number of columns in C must be equal to the number of columns in B");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(c->dimension(1) != a->dimension(1), "The number of rows in C must be equal to the number of rows in A");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(c->dimension(2) != a->dimension(2), "A and C must have the same number of batches");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->dimension(2) != 1 && b->dimension(2) != c->dimension(2), "B must either be shared or have the same number of batches as C");
+
+    return Status{};
+}
+
+Status validate_arguments(const std::vector<const ITensorInfo *> &a, const std::vector<const ITensorInfo *> &b, const std::vector<const ITensorInfo *> &c)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a.empty(), "The batch must contain at least one problem");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(c.size() != a.size(), "There must be one matrix C per matrix A");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b.size() != 1 && b.size() != a.size(), "B must either be shared or have one matrix per matrix A");
+
+    for(size_t i = 0; i < a.size(); ++i)
+    {
+        const ITensorInfo *b_i = b[(b.size() == 1) ? 0 : i];
+
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a[i], b_i, c[i]);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(a[i]->num_dimensions() > 2 || b_i->num_dimensions() > 2 || c[i]->num_dimensions() > 2, "The matrices of an array must be 2D");
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(a[i], b_i, c[i]));
+
+        // All the problems must have the same shape and data type
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(a[0], a[i]);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(b[0], b_i);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(c[0], c[i]);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a[0], a[i]);
+    }
+
+    return Status{};
+}
+
+template <typename T>
+std::vector<const ITensorInfo *> tensor_infos(const std::vector<T *> &tensors)
+{
+    std::vector<const ITensorInfo *> infos;
+    infos.reserve(tensors.size());
+
+    for(auto t : tensors)
+    {
+        infos.push_back((t != nullptr) ? t->info() : nullptr);
+    }
+
+    return infos;
+}
+} // namespace
+
+NEGEMMAssemblyBatchedKernel::NEGEMMAssemblyBatchedKernel()
+    : _a(), _b(), _c(), _workspace(nullptr), _packed_b(nullptr), _alpha(1.f), _beta(0.f), _is_strided(true)
+{
+}
+
+size_t NEGEMMAssemblyBatchedKernel::get_workspace_size(const CPUInfo &ci, unsigned int M, unsigned int N, unsigned int K, unsigned int num_threads)
+{
+#if defined(__arm__) || defined(__aarch64__)
+    GemmInterleaved<batched_strategy, float, float> gemm(&ci, M, N, K, false, false);
+    constexpr size_t alignment = 4096;
+    return (gemm.get_working_size() + alignment - 1) * num_threads;
+#else  /* defined(__arm__) || defined(__aarch64__) */
+    ARM_COMPUTE_UNUSED(ci);
+    ARM_COMPUTE_UNUSED(M);
+    ARM_COMPUTE_UNUSED(N);
+    ARM_COMPUTE_UNUSED(K);
+    ARM_COMPUTE_UNUSED(num_threads);
+    return 0;
+#endif /* defined(__arm__) || defined(__aarch64__) */
+}
+
+void NEGEMMAssemblyBatchedKernel::configure(const ITensor *a, const ITensor *b, ITensor *c, ITensor *workspace, float alpha, float beta, const ITensor *packed_b)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, c, workspace);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(a->info(), b->info(), c->info()));
+    ARM_COMPUTE_ERROR_ON_MSG(packed_b != nullptr && b->info()->dimension(2) != 1, "Only a matrix B shared by the batch can be packed");
+
+    _a          = { a };
+    _b          = { b };
+    _c          = { c };
+    _workspace  = workspace;
+    _packed_b   = packed_b;
+    _alpha      = alpha;
+    _beta       = beta;
+    _is_strided = true;
+
+    configure_common(c->info()->dimension(2));
+}
+
+void NEGEMMAssemblyBatchedKernel::configure(const std::vector<const ITensor *> &a, const std::vector<const ITensor *> &b, const std::vector<ITensor *> &c, ITensor *workspace, float alpha,
+                                            float beta, const ITensor *packed_b)
+{
+    ARM_COMPUTE_ERROR_ON(workspace == nullptr);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(tensor_infos(a), tensor_infos(b), tensor_infos(c)));
+    ARM_COMPUTE_ERROR_ON_MSG(packed_b != nullptr && b.size() != 1, "Only a matrix B shared by the batch can be packed");
+
+    _a          = a;
+    _b          = b;
+    _c          = c;
+    _workspace  = workspace;
+    _packed_b   = packed_b;
+    _alpha      = alpha;
+    _beta       = beta;
+    _is_strided = false;
+
+    configure_common(c.size());
+}
+
+Status NEGEMMAssemblyBatchedKernel::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(a, b, c));
+    return Status{};
+}
+
+Status NEGEMMAssemblyBatchedKernel::validate(const std::vector<const ITensorInfo *> &a, const std::vector<const ITensorInfo *> &b, const std::vector<const ITensorInfo *> &c)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(a, b, c));
+    return Status{};
+}
+
+void NEGEMMAssemblyBatchedKernel::configure_common(unsigned int num_batches)
+{
+    // The interleaving transforms and the merge of the assembly GEMM are bounded to the matrix sizes, so no padding is needed.
+    // The window runs over the rows of C and over the problems of the batch, the columns are processed within a single call.
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, _c[0]->info()->dimension(1), 1));
+    win.set(Window::DimZ, Window::Dimension(0, num_batches, 1));
+
+    for(auto c : _c)
+    {
+        c->info()->set_valid_region(ValidRegion(Coordinates(), c->info()->tensor_shape()));
+    }
+
+    INEKernel::configure(win);
+}
+
+void NEGEMMAssemblyBatchedKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+#if defined(__arm__) || defined(__aarch64__)
+    const int y0   = window.y().start();
+    const int ymax = std::min(static_cast<int>(_c[0]->info()->dimension(1)), window.y().end());
+    const int M    = ymax - y0;
+    const int N    = _c[0]->info()->dimension(0);
+    const int K    = _a[0]->info()->dimension(0);
+
+    GemmInterleaved<batched_strategy, float, float> gemm(&info.cpu_info, M, N, K, false, false);
+    constexpr size_t alignment      = 4096;
+    const size_t     offset         = (gemm.get_working_size() + alignment - 1) * info.thread_id;
+    void            *workspace      = _workspace->buffer() + offset;
+    size_t           workspace_size = _workspace->info()->total_size();
+
+    if(support::cpp11::align(alignment, gemm.get_working_size(), workspace, workspace_size) == nullptr)
+    {
+        ARM_COMPUTE_ERROR("Not enough space to align buffer!");
+    }
+
+    // Pointer to the first row of the matrix of the given batch handled by this window
+    auto matrix_ptr = [](const ITensor * t, int batch, int row) -> uint8_t *
+    {
+        const ITensorInfo *t_info = t->info();
+        return t->buffer() + t_info->offset_first_element_in_bytes() + batch * t_info->strides_in_bytes().z() + row * t_info->strides_in_bytes().y();
+    };
+
+    for(int z = window.z().start(); z < window.z().end(); z += window.z().step())
+    {
+        const ITensor *a = _is_strided ? _a[0] : _a[z];
+        const ITensor *b = (_b.size() == 1) ? _b[0] : _b[z];
+        ITensor       *c = _is_strided ? _c[0] : _c[z];
+
+        const int a_batch = _is_strided ? z : 0;
+        const int b_batch = (_is_strided && b->info()->dimension(2) > 1) ? z : 0;
+        const int c_batch = _is_strided ? z : 0;
+
+        const int lda = a->info()->strides_in_bytes().y() / sizeof(float);
+        const int ldb = b->info()->strides_in_bytes().y() / sizeof(float);
+        const int ldc = c->info()->strides_in_bytes().y() / sizeof(float);
+
+        if(_packed_b != nullptr)
+        {
+            // The shared matrix B has been interleaved once for the whole batch
+            gemm.execute_pretransposed_B(reinterpret_cast<const float *>(matrix_ptr(a, a_batch, y0)), lda,
+                                         _packed_b->buffer() + _packed_b->info()->offset_first_element_in_bytes(),
+                                         reinterpret_cast<float *>(matrix_ptr(c, c_batch, y0)), ldc,
+                                         _alpha, _beta, workspace);
+        }
+        else
+        {
+            gemm.execute(reinterpret_cast<const float *>(matrix_ptr(a, a_batch, y0)), lda,
+                         reinterpret_cast<const float *>(matrix_ptr(b, b_batch, 0)), ldb,
+                         reinterpret_cast<float *>(matrix_ptr(c, c_batch, y0)), ldc,
+                         _alpha, _beta, workspace);
+        }
+    }
+#else  /* defined(__arm__) || defined(__aarch64__) */
+    ARM_COMPUTE_UNUSED(window);
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR("The assembly GEMM is not available on this architecture");
+#endif /* defined(__arm__) || defined(__aarch64__) */
+}
+
+NEGEMMAssemblyBatchedPackBKernel::NEGEMMAssemblyBatchedPackBKernel()
+    : _b(nullptr), _packed_b(nullptr)
+{
+}
+
+size_t NEGEMMAssemblyBatchedPackBKernel::get_packed_b_size(const CPUInfo &ci, unsigned int N, unsigned int K)
+{
+#if defined(__arm__) || defined(__aarch64__)
+    // The layout of the panels doesn't depend on the number of rows of A
+    GemmInterleaved<batched_strategy, float, float> gemm(&ci, 1, N, K, false, false);
+    return gemm.get_B_pretransposed_array_size();
+#else  /* defined(__arm__) || defined(__aarch64__) */
+    ARM_COMPUTE_UNUSED(ci);
+    ARM_COMPUTE_UNUSED(N);
+    ARM_COMPUTE_UNUSED(K);
+    return 0;
+#endif /* defined(__arm__) || defined(__aarch64__) */
+}
+
+void NEGEMMAssemblyBatchedPackBKernel::configure(const ITensor *b, ITensor *packed_b)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(b, packed_b);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(packed_b, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(b->info()->num_dimensions() > 2);
+
+    _b        = b;
+    _packed_b = packed_b;
+
+    // The whole matrix is packed by a single call: the panels are written once and then reused by every GEMM of the batch
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    INEKernel::configure(win);
+}
+
+void NEGEMMAssemblyBatchedPackBKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(window);
+
+#if defined(__arm__) || defined(__aarch64__)
+    const int N   = _b->info()->dimension(0);
+    const int K   = _b->info()->dimension(1);
+    const int ldb = _b->info()->strides_in_bytes().y() / sizeof(float);
+
+    GemmInterleaved<batched_strategy, float, float> gemm(&info.cpu_info, 1, N, K, false, false);
+    ARM_COMPUTE_ERROR_ON(_packed_b->info()->total_size() < gemm.get_B_pretransposed_array_size());
+
+    gemm.pretranspose_B_array(_packed_b->buffer() + _packed_b->info()->offset_first_element_in_bytes(),
+                              reinterpret_cast<const float *>(_b->buffer() + _b->info()->offset_first_element_in_bytes()), ldb);
+#else  /* defined(__arm__) || defined(__aarch64__) */
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR("The assembly GEMM is not available on this architecture");
+#endif /* defined(__arm__) || defined(__aarch64__) */
+}
+} // namespace arm_compute
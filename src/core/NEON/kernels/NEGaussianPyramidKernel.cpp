@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/NEON/kernels/NEGaussianPyramidKernel.h"
 
+#include "arm_compute/core/AccessWindowStatic.h"
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -33,10 +34,15 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <arm_neon.h>
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <tuple>
+#include <vector>
 
 using namespace arm_compute;
 
@@ -268,3 +274,210 @@ void NEGaussianPyramidVertKernel::run(const Window &window, const ThreadInfo &in
     },
     in, out);
 }
+
+NEGaussianPyramidDownsampleKernel::NEGaussianPyramidDownsampleKernel()
+    : _input(nullptr), _output(nullptr), _is_half(false), _x_offset(0), _y_offset(0), _hr(0.f), _x_samples()
+{
+}
+
+BorderSize NEGaussianPyramidDownsampleKernel::border_size() const
+{
+    return BorderSize(2);
+}
+
+void NEGaussianPyramidDownsampleKernel::configure(const ITensor *input, ITensor *output, float scale, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+
+    for(size_t i = 2; i < Coordinates::num_max_dimensions; ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(input->info()->dimension(i) != output->info()->dimension(i));
+    }
+
+    _input   = input;
+    _output  = output;
+    _is_half = (scale == SCALE_PYRAMID_HALF);
+    _hr      = static_cast<float>(input->info()->dimension(1)) / static_cast<float>(output->info()->dimension(1));
+
+    const int input_width  = input->info()->dimension(0);
+    const int input_height = input->info()->dimension(1);
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 8;
+
+    Window                 win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    if(_is_half)
+    {
+        // Select odd pixels for even shapes and even pixels for odd shapes, as NEGaussianPyramidHorKernel and NEGaussianPyramidVertKernel do
+        const ValidRegion &valid_region = input->info()->valid_region();
+
+        _x_offset = ((valid_region.anchor[0] + valid_region.shape[0]) % 2 == 0) ? 1 : 0;
+        _y_offset = ((valid_region.anchor[1] + valid_region.shape[1]) % 2 == 0) ? 1 : 0;
+
+        // Each iteration loads 32 pixels (vld2q) starting 2 pixels before the first sample, on 5 rows
+        update_window_and_padding(win,
+                                  AccessWindowRectangle(input->info(), _x_offset - 2, _y_offset - 2, 32, 5, 2.f, 2.f),
+                                  AccessWindowStatic(input->info(), -2, -2, input_width + 2, input_height + 2),
+                                  output_access);
+
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    }
+    else
+    {
+        update_window_and_padding(win,
+                                  AccessWindowStatic(input->info(), -2, -2, input_width + 2, input_height + 2),
+                                  output_access);
+
+        // Pre-compute the sampled columns, including the ones of the padding processed by the last iteration
+        const float wr = static_cast<float>(input->info()->dimension(0)) / static_cast<float>(output->info()->dimension(0));
+
+        _x_samples.resize(win.x().end());
+
+        for(size_t x = 0; x < _x_samples.size(); ++x)
+        {
+            _x_samples[x] = std::min(static_cast<int>((x + 0.5f) * wr), input_width - 1);
+        }
+
+        // Same valid region as NEGaussian5x5 followed by NEScaleKernel with nearest neighbour interpolation
+        auto        blurred_info = input->info()->clone();
+        ValidRegion blurred_region(input->info()->valid_region());
+
+        if(border_undefined)
+        {
+            blurred_region.anchor.set(0, blurred_region.anchor[0] + border_size().left);
+            blurred_region.anchor.set(1, blurred_region.anchor[1] + border_size().top);
+            blurred_region.shape.set(0, std::max<int>(0, blurred_region.shape[0] - border_size().left - border_size().right));
+            blurred_region.shape.set(1, std::max<int>(0, blurred_region.shape[1] - border_size().top - border_size().bottom));
+        }
+
+        blurred_info->set_valid_region(blurred_region);
+
+        output->info()->set_valid_region(calculate_valid_region_scale(*blurred_info, output->info()->tensor_shape(), InterpolationPolicy::NEAREST_NEIGHBOR, border_size(), true));
+    }
+
+    INEKernel::configure(win);
+}
+
+int NEGaussianPyramidDownsampleKernel::input_row(int y) const
+{
+    if(_is_half)
+    {
+        return 2 * y + _y_offset;
+    }
+
+    return std::min(static_cast<int>(std::floor((y + 0.5f) * _hr)), static_cast<int>(_input->info()->dimension(1)) - 1);
+}
+
+void NEGaussianPyramidDownsampleKernel::horizontal_pass(int row, int plane, int x_start, int x_end, uint16_t *line) const
+{
+    if(_is_half)
+    {
+        static const uint16x8_t six  = vdupq_n_u16(6);
+        static const uint16x8_t four = vdupq_n_u16(4);
+
+        const uint8_t *in = _input->ptr_to_element(Coordinates(2 * x_start + _x_offset - 2, row, plane));
+
+        for(int x = 0; x < x_end - x_start; x += 8)
+        {
+            const uint8x16x2_t data_2q   = vld2q_u8(in + 2 * x);
+            const uint8x16_t &data_even = data_2q.val[0];
+            const uint8x16_t &data_odd  = data_2q.val[1];
+
+            const uint16x8_t data_l2 = vmovl_u8(vget_low_u8(data_even));
+            const uint16x8_t data_l1 = vmovl_u8(vget_low_u8(data_odd));
+            const uint16x8_t data_m  = vmovl_u8(vget_low_u8(vextq_u8(data_even, data_even, 1)));
+            const uint16x8_t data_r1 = vmovl_u8(vget_low_u8(vextq_u8(data_odd, data_odd, 1)));
+            const uint16x8_t data_r2 = vmovl_u8(vget_low_u8(vextq_u8(data_even, data_even, 2)));
+
+            uint16x8_t out_val = vaddq_u16(data_l2, data_r2);
+            out_val            = vmlaq_u16(out_val, data_l1, four);
+            out_val            = vmlaq_u16(out_val, data_m, six);
+            out_val            = vmlaq_u16(out_val, data_r1, four);
+
+            vst1q_u16(line + x, out_val);
+        }
+    }
+    else
+    {
+        const uint8_t *in = _input->ptr_to_element(Coordinates(0, row, plane));
+
+        for(int x = x_start; x < x_end; ++x)
+        {
+            const uint8_t *p = in + _x_samples[x];
+
+            line[x - x_start] = p[-2] + 4 * p[-1] + 6 * p[0] + 4 * p[1] + p[2];
+        }
+    }
+}
+
+void NEGaussianPyramidDownsampleKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(window.x().step() != 8);
+
+    static const uint16x8_t six  = vdupq_n_u16(6);
+    static const uint16x8_t four = vdupq_n_u16(4);
+
+    constexpr int num_lines = 5;
+
+    const int x_start = window.x().start();
+    const int x_end   = window.x().end();
+    const int width   = x_end - x_start;
+
+    // Horizontal pass of the input rows, input row r is stored in slot r % num_lines
+    std::vector<uint16_t> lines(num_lines * width);
+    std::array<int, num_lines> line_rows{ {} };
+    int                        plane = -1;
+
+    // Handle X dimension manually
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator out(_output, win);
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        // Lines of a previous plane cannot be reused
+        if(id.z() != plane)
+        {
+            line_rows.fill(std::numeric_limits<int>::min());
+            plane = id.z();
+        }
+
+        const int       centre_row = input_row(id.y());
+        const uint16_t *l[num_lines];
+
+        for(int i = 0; i < num_lines; ++i)
+        {
+            const int row  = centre_row - 2 + i;
+            const int slot = ((row % num_lines) + num_lines) % num_lines;
+
+            if(line_rows[slot] != row)
+            {
+                horizontal_pass(row, plane, x_start, x_end, lines.data() + slot * width);
+                line_rows[slot] = row;
+            }
+
+            l[i] = lines.data() + slot * width;
+        }
+
+        // Vertical pass
+        uint8_t *const dst = out.ptr() + x_start;
+
+        for(int x = 0; x < width; x += 8)
+        {
+            uint16x8_t out_val = vaddq_u16(vld1q_u16(l[0] + x), vld1q_u16(l[4] + x));
+            out_val            = vmlaq_u16(out_val, vld1q_u16(l[1] + x), four);
+            out_val            = vmlaq_u16(out_val, vld1q_u16(l[2] + x), six);
+            out_val            = vmlaq_u16(out_val, vld1q_u16(l[3] + x), four);
+
+            vst1_u8(dst + x, vqshrn_n_u16(out_val, 8));
+        }
+    },
+    out);
+}
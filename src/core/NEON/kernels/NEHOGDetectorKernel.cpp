@@ -30,23 +30,35 @@
 #include "arm_compute/core/Validate.h"
 
 #include <arm_neon.h>
+#include <mutex>
 
 using namespace arm_compute;
 
+constexpr size_t NEHOGDetectorKernel::max_num_models;
+
 NEHOGDetectorKernel::NEHOGDetectorKernel()
-    : _input(nullptr), _detection_windows(), _hog_descriptor(nullptr), _bias(0.0f), _threshold(0.0f), _idx_class(0), _num_bins_per_descriptor_x(0), _num_blocks_per_descriptor_y(0), _block_stride_width(0),
-      _block_stride_height(0), _detection_window_width(0), _detection_window_height(0), _max_num_detection_windows(0), _mutex()
+    : _input(nullptr), _detection_windows(), _hog_descriptors(), _biases(), _idx_classes(), _num_models(0), _threshold(0.0f), _num_bins_per_descriptor_x(0), _num_blocks_per_descriptor_y(0),
+      _block_stride_width(0), _block_stride_height(0), _detection_window_width(0), _detection_window_height(0), _max_num_detection_windows(0), _mutex()
 {
 }
 
 void NEHOGDetectorKernel::configure(const ITensor *input, const IHOG *hog, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride, float threshold, uint16_t idx_class)
+{
+    configure(input, std::vector<const IHOG *> { hog }, detection_windows, detection_window_stride, threshold, std::vector<uint16_t> { idx_class });
+}
+
+void NEHOGDetectorKernel::configure(const ITensor *input, const std::vector<const IHOG *> &hogs, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride, float threshold,
+                                    const std::vector<uint16_t> &idx_classes)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F32);
-    ARM_COMPUTE_ERROR_ON(hog == nullptr);
+    ARM_COMPUTE_ERROR_ON(hogs.empty() || hogs.size() > max_num_models);
+    ARM_COMPUTE_ERROR_ON(hogs.size() != idx_classes.size());
+    ARM_COMPUTE_ERROR_ON(hogs[0] == nullptr);
     ARM_COMPUTE_ERROR_ON(detection_windows == nullptr);
-    ARM_COMPUTE_ERROR_ON((detection_window_stride.width % hog->info()->block_stride().width) != 0);
-    ARM_COMPUTE_ERROR_ON((detection_window_stride.height % hog->info()->block_stride().height) != 0);
+    ARM_COMPUTE_ERROR_ON((detection_window_stride.width % hogs[0]->info()->block_stride().width) != 0);
+    ARM_COMPUTE_ERROR_ON((detection_window_stride.height % hogs[0]->info()->block_stride().height) != 0);
 
+    const IHOG   *hog                   = hogs[0];
     const Size2D &detection_window_size = hog->info()->detection_window_size();
     const Size2D &block_size            = hog->info()->block_size();
     const Size2D &block_stride          = hog->info()->block_stride();
@@ -54,9 +66,7 @@ void NEHOGDetectorKernel::configure(const ITensor *input, const IHOG *hog, IDete
     _input                       = input;
     _detection_windows           = detection_windows;
     _threshold                   = threshold;
-    _idx_class                   = idx_class;
-    _hog_descriptor              = hog->descriptor();
-    _bias                        = _hog_descriptor[hog->info()->descriptor_size() - 1];
+    _num_models                  = hogs.size();
     _num_bins_per_descriptor_x   = ((detection_window_size.width - block_size.width) / block_stride.width + 1) * input->info()->num_channels();
     _num_blocks_per_descriptor_y = (detection_window_size.height - block_size.height) / block_stride.height + 1;
     _block_stride_width          = block_stride.width;
@@ -67,6 +77,20 @@ void NEHOGDetectorKernel::configure(const ITensor *input, const IHOG *hog, IDete
 
     ARM_COMPUTE_ERROR_ON((_num_bins_per_descriptor_x * _num_blocks_per_descriptor_y + 1) != hog->info()->descriptor_size());
 
+    for(size_t m = 0; m < _num_models; ++m)
+    {
+        ARM_COMPUTE_ERROR_ON(hogs[m] == nullptr);
+        ARM_COMPUTE_ERROR_ON(hogs[m]->info()->descriptor_size() != hog->info()->descriptor_size());
+        ARM_COMPUTE_ERROR_ON(hogs[m]->info()->detection_window_size().width != detection_window_size.width);
+        ARM_COMPUTE_ERROR_ON(hogs[m]->info()->detection_window_size().height != detection_window_size.height);
+        ARM_COMPUTE_ERROR_ON(hogs[m]->info()->block_stride().width != block_stride.width);
+        ARM_COMPUTE_ERROR_ON(hogs[m]->info()->block_stride().height != block_stride.height);
+
+        _hog_descriptors[m] = hogs[m]->descriptor();
+        _biases[m]          = _hog_descriptors[m][hog->info()->descriptor_size() - 1];
+        _idx_classes[m]     = idx_classes[m];
+    }
+
     // Get the number of blocks along the x and y directions of the input tensor
     const ValidRegion &valid_region = input->info()->valid_region();
     const size_t       num_blocks_x = valid_region.shape[0];
@@ -97,10 +121,13 @@ void NEHOGDetectorKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
-    ARM_COMPUTE_ERROR_ON(_hog_descriptor == nullptr);
+    ARM_COMPUTE_ERROR_ON(_num_models == 0);
 
     const size_t in_step_y = _input->info()->strides_in_bytes()[Window::DimY] / data_size_from_type(_input->info()->data_type());
 
+    // Detections are gathered locally and appended to the shared array under a single lock at the end of run()
+    std::vector<DetectionWindow> detections;
+
     Iterator in(_input, window);
 
     execute_window_loop(window, [&](const Coordinates & id)
@@ -108,12 +135,18 @@ void NEHOGDetectorKernel::run(const Window &window, const ThreadInfo &info)
         const auto *in_row_ptr = reinterpret_cast<const float *>(in.ptr());
 
         // Init score_f32 with 0
-        float32x4_t score_f32 = vdupq_n_f32(0.0f);
+        float32x4_t score_f32[max_num_models];
 
         // Init score with bias
-        float score = _bias;
+        float score[max_num_models];
 
-        // Compute Linear SVM
+        for(size_t m = 0; m < _num_models; ++m)
+        {
+            score_f32[m] = vdupq_n_f32(0.0f);
+            score[m]     = _biases[m];
+        }
+
+        // Compute Linear SVM: the descriptor values are loaded once for all the models
         for(size_t yb = 0; yb < _num_blocks_per_descriptor_y; ++yb, in_row_ptr += in_step_y)
         {
             int32_t xb = 0;
@@ -133,55 +166,75 @@ void NEHOGDetectorKernel::run(const Window &window, const ThreadInfo &info)
                     }
                 };
 
-                // Load detector values
-                const float32x4x4_t b_f32 =
+                for(size_t m = 0; m < _num_models; ++m)
                 {
-                    {
-                        vld1q_f32(&_hog_descriptor[xb + 0 + offset_y]),
-                        vld1q_f32(&_hog_descriptor[xb + 4 + offset_y]),
-                        vld1q_f32(&_hog_descriptor[xb + 8 + offset_y]),
-                        vld1q_f32(&_hog_descriptor[xb + 12 + offset_y])
-                    }
-                };
+                    const float *hog_descriptor = _hog_descriptors[m];
 
-                // Multiply accumulate
-                score_f32 = vmlaq_f32(score_f32, a_f32.val[0], b_f32.val[0]);
-                score_f32 = vmlaq_f32(score_f32, a_f32.val[1], b_f32.val[1]);
-                score_f32 = vmlaq_f32(score_f32, a_f32.val[2], b_f32.val[2]);
-                score_f32 = vmlaq_f32(score_f32, a_f32.val[3], b_f32.val[3]);
+                    // Load detector values
+                    const float32x4x4_t b_f32 =
+                    {
+                        {
+                            vld1q_f32(&hog_descriptor[xb + 0 + offset_y]),
+                            vld1q_f32(&hog_descriptor[xb + 4 + offset_y]),
+                            vld1q_f32(&hog_descriptor[xb + 8 + offset_y]),
+                            vld1q_f32(&hog_descriptor[xb + 12 + offset_y])
+                        }
+                    };
+
+                    // Multiply accumulate
+                    score_f32[m] = vmlaq_f32(score_f32[m], a_f32.val[0], b_f32.val[0]);
+                    score_f32[m] = vmlaq_f32(score_f32[m], a_f32.val[1], b_f32.val[1]);
+                    score_f32[m] = vmlaq_f32(score_f32[m], a_f32.val[2], b_f32.val[2]);
+                    score_f32[m] = vmlaq_f32(score_f32[m], a_f32.val[3], b_f32.val[3]);
+                }
             }
 
             for(; xb < static_cast<int32_t>(_num_bins_per_descriptor_x); ++xb)
             {
                 const float a = in_row_ptr[xb];
-                const float b = _hog_descriptor[xb + offset_y];
 
-                score += a * b;
+                for(size_t m = 0; m < _num_models; ++m)
+                {
+                    score[m] += a * _hog_descriptors[m][xb + offset_y];
+                }
             }
         }
 
-        score += vgetq_lane_f32(score_f32, 0);
-        score += vgetq_lane_f32(score_f32, 1);
-        score += vgetq_lane_f32(score_f32, 2);
-        score += vgetq_lane_f32(score_f32, 3);
-
-        if(score > _threshold)
+        for(size_t m = 0; m < _num_models; ++m)
         {
-            if(_detection_windows->num_values() < _max_num_detection_windows)
+            score[m] += vgetq_lane_f32(score_f32[m], 0);
+            score[m] += vgetq_lane_f32(score_f32[m], 1);
+            score[m] += vgetq_lane_f32(score_f32[m], 2);
+            score[m] += vgetq_lane_f32(score_f32[m], 3);
+
+            if(score[m] > _threshold)
             {
                 DetectionWindow win;
                 win.x         = (id.x() * _block_stride_width);
                 win.y         = (id.y() * _block_stride_height);
                 win.width     = _detection_window_width;
                 win.height    = _detection_window_height;
-                win.idx_class = _idx_class;
-                win.score     = score;
+                win.idx_class = _idx_classes[m];
+                win.score     = score[m];
 
-                std::unique_lock<arm_compute::Mutex> lock(_mutex);
-                _detection_windows->push_back(win);
-                lock.unlock();
+                detections.push_back(win);
             }
         }
     },
     in);
+
+    if(!detections.empty())
+    {
+        std::lock_guard<arm_compute::Mutex> lock(_mutex);
+
+        for(const auto &win : detections)
+        {
+            if(_detection_windows->num_values() >= _max_num_detection_windows)
+            {
+                break;
+            }
+
+            _detection_windows->push_back(win);
+        }
+    }
 }
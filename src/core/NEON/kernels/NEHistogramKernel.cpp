@@ -29,6 +29,7 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Window.h"
 
 #include <algorithm>
@@ -42,49 +43,40 @@ namespace arm_compute
 class Coordinates;
 } // namespace arm_compute
 
-inline void NEHistogramKernel::merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins)
+namespace
 {
-    std::lock_guard<arm_compute::Mutex> lock(_hist_mtx);
-
-    const unsigned int v_end = (bins / 4) * 4;
-
-    for(unsigned int b = 0; b < v_end; b += 4)
-    {
-        const uint32x4_t tmp_global = vld1q_u32(global_hist + b);
-        const uint32x4_t tmp_local  = vld1q_u32(local_hist + b);
-        vst1q_u32(global_hist + b, vaddq_u32(tmp_global, tmp_local));
-    }
-
-    for(unsigned int b = v_end; b < bins; ++b)
-    {
-        global_hist[b] += local_hist[b];
-    }
-}
+/** Number of uint32_t counters in a cache line */
+constexpr size_t cache_line_elements = 64 / sizeof(uint32_t);
+} // namespace
 
 NEHistogramKernel::NEHistogramKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _local_hist(nullptr), _window_lut(nullptr), _hist_mtx()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _local_hist(nullptr), _window_lut(nullptr)
 {
 }
 
-void NEHistogramKernel::histogram_U8(Window win, const ThreadInfo &info)
+size_t NEHistogramKernel::local_hist_stride(size_t num_bins)
 {
-    ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
-
-    const size_t          bins       = _output->num_bins();
-    const int32_t         offset     = _output->offset();
-    const uint32_t        offrange   = offset + _output->range();
-    const uint32_t *const w_lut      = _window_lut;
-    uint32_t *const       local_hist = _local_hist + info.thread_id * bins;
+    return ceil_to_multiple(num_bins, cache_line_elements);
+}
 
-    // Clear local_histogram
-    std::fill_n(local_hist, bins, 0);
+void NEHistogramKernel::count_U8(Window win, uint32_t *counters) const
+{
+    uint32_t *const counters0 = counters;
+    uint32_t *const counters1 = counters + _max_range_size;
+    uint32_t *const counters2 = counters + 2 * _max_range_size;
+    uint32_t *const counters3 = counters + 3 * _max_range_size;
 
-    auto update_local_hist = [&](uint8_t p)
+    // Bin the 8 pixels packed in a 64 bit value, rotating over the 4 sets of counters
+    auto update_counters = [&](uint64_t pixels)
     {
-        if(offset <= p && p < offrange)
-        {
-            ++local_hist[w_lut[p]];
-        }
+        ++counters0[pixels & 0xFF];
+        ++counters1[(pixels >> 8) & 0xFF];
+        ++counters2[(pixels >> 16) & 0xFF];
+        ++counters3[(pixels >> 24) & 0xFF];
+        ++counters0[(pixels >> 32) & 0xFF];
+        ++counters1[(pixels >> 40) & 0xFF];
+        ++counters2[(pixels >> 48) & 0xFF];
+        ++counters3[pixels >> 56];
     };
 
     const int x_start = win.x().start();
@@ -97,85 +89,65 @@ void NEHistogramKernel::histogram_U8(Window win, const ThreadInfo &info)
 
     Iterator input(_input, win);
 
-    // Calculate local histogram
     execute_window_loop(win, [&](const Coordinates &)
     {
         int x = x_start;
 
         // Vector loop
-        for(; x <= x_end - 8; x += 8)
+        for(; x <= x_end - 16; x += 16)
         {
-            const uint8x8_t pixels = vld1_u8(input.ptr() + x);
-
-            update_local_hist(vget_lane_u8(pixels, 0));
-            update_local_hist(vget_lane_u8(pixels, 1));
-            update_local_hist(vget_lane_u8(pixels, 2));
-            update_local_hist(vget_lane_u8(pixels, 3));
-            update_local_hist(vget_lane_u8(pixels, 4));
-            update_local_hist(vget_lane_u8(pixels, 5));
-            update_local_hist(vget_lane_u8(pixels, 6));
-            update_local_hist(vget_lane_u8(pixels, 7));
+            const uint64x2_t pixels = vreinterpretq_u64_u8(vld1q_u8(input.ptr() + x));
+
+            update_counters(vgetq_lane_u64(pixels, 0));
+            update_counters(vgetq_lane_u64(pixels, 1));
         }
 
         // Process leftover pixels
         for(; x < x_end; ++x)
         {
-            update_local_hist(input.ptr()[x]);
+            ++counters0[input.ptr()[x]];
         }
     },
     input);
-
-    // Merge histograms
-    merge_histogram(_output->buffer(), local_hist, bins);
 }
 
-void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
+void NEHistogramKernel::histogram_U8(Window win, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
-    ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
-
-    std::array<uint32_t, _max_range_size> local_hist{ { 0 } };
+    const size_t          bins       = _output->num_bins();
+    const int32_t         offset     = _output->offset();
+    const uint32_t        offrange   = std::min(offset + _output->range(), static_cast<uint32_t>(_max_range_size));
+    const uint32_t *const w_lut      = _window_lut;
+    uint32_t *const       local_hist = _local_hist + info.thread_id * local_hist_stride(bins);
 
-    const int x_start = win.x().start();
-    const int x_end   = win.x().end();
+    std::array<uint32_t, _num_ways * _max_range_size> counters{ { 0 } };
 
-    // Handle X dimension manually to split into two loops
-    // First one will use vector operations, second one processes the left over
-    // pixels
-    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    count_U8(win, counters.data());
 
-    Iterator input(_input, win);
-
-    // Calculate local histogram
-    execute_window_loop(win, [&](const Coordinates &)
+    // Apply the window to the pixel values counted
+    for(unsigned int p = offset; p < offrange; ++p)
     {
-        int x = x_start;
+        local_hist[w_lut[p]] += counters[p] + counters[p + _max_range_size] + counters[p + 2 * _max_range_size] + counters[p + 3 * _max_range_size];
+    }
+}
 
-        // Vector loop
-        for(; x <= x_end - 8; x += 8)
-        {
-            const uint8x8_t pixels = vld1_u8(input.ptr() + x);
-
-            ++local_hist[vget_lane_u8(pixels, 0)];
-            ++local_hist[vget_lane_u8(pixels, 1)];
-            ++local_hist[vget_lane_u8(pixels, 2)];
-            ++local_hist[vget_lane_u8(pixels, 3)];
-            ++local_hist[vget_lane_u8(pixels, 4)];
-            ++local_hist[vget_lane_u8(pixels, 5)];
-            ++local_hist[vget_lane_u8(pixels, 6)];
-            ++local_hist[vget_lane_u8(pixels, 7)];
-        }
+void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
+{
+    uint32_t *const local_hist = _local_hist + info.thread_id * local_hist_stride(_max_range_size);
 
-        // Process leftover pixels
-        for(; x < x_end; ++x)
-        {
-            ++local_hist[input.ptr()[x]];
-        }
-    },
-    input);
+    std::array<uint32_t, _num_ways * _max_range_size> counters{ { 0 } };
+
+    count_U8(win, counters.data());
 
-    // Merge histograms
-    merge_histogram(_output->buffer(), local_hist.data(), _max_range_size);
+    // Sum the interleaved counters
+    for(unsigned int b = 0; b < _max_range_size; b += 4)
+    {
+        uint32x4_t sum = vld1q_u32(local_hist + b);
+        sum            = vaddq_u32(sum, vld1q_u32(counters.data() + b));
+        sum            = vaddq_u32(sum, vld1q_u32(counters.data() + b + _max_range_size));
+        sum            = vaddq_u32(sum, vld1q_u32(counters.data() + b + 2 * _max_range_size));
+        sum            = vaddq_u32(sum, vld1q_u32(counters.data() + b + 3 * _max_range_size));
+        vst1q_u32(local_hist + b, sum);
+    }
 }
 
 void NEHistogramKernel::calculate_window_lut() const
@@ -192,7 +164,7 @@ void NEHistogramKernel::calculate_window_lut() const
     }
 }
 
-void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut)
+void NEHistogramKernel::configure(const IImage *input, const IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
@@ -224,14 +196,17 @@ void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output,
     INEKernel::configure(win);
 }
 
-void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output)
+void NEHistogramKernel::configure(const IImage *input, const IDistribution1D *output, uint32_t *local_hist)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
+    ARM_COMPUTE_ERROR_ON(nullptr == local_hist);
+    ARM_COMPUTE_ERROR_ON(output->num_bins() != _max_range_size);
 
-    _input  = input;
-    _output = output;
+    _input      = input;
+    _output     = output;
+    _local_hist = local_hist;
 
     // Set appropriate function
     _func = &NEHistogramKernel::histogram_fixed_U8;
@@ -251,3 +226,64 @@ void NEHistogramKernel::run(const Window &window, const ThreadInfo &info)
 
     (this->*_func)(window, info);
 }
+
+NEHistogramReductionKernel::NEHistogramReductionKernel()
+    : _local_hist(nullptr), _num_local_hist(0), _output(nullptr)
+{
+}
+
+void NEHistogramReductionKernel::configure(const uint32_t *local_hist, unsigned int num_local_hist, IDistribution1D *output)
+{
+    ARM_COMPUTE_ERROR_ON(nullptr == local_hist);
+    ARM_COMPUTE_ERROR_ON(nullptr == output);
+    ARM_COMPUTE_ERROR_ON(num_local_hist == 0);
+
+    _local_hist     = local_hist;
+    _num_local_hist = num_local_hist;
+    _output         = output;
+
+    // One window iteration per bin
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, output->num_bins(), 1));
+    INEKernel::configure(win);
+}
+
+void NEHistogramReductionKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
+
+    const size_t    stride = NEHistogramKernel::local_hist_stride(_output->num_bins());
+    uint32_t *const output = _output->buffer();
+
+    const int b_end = window.x().end();
+    int       b     = window.x().start();
+
+    // Vector loop
+    for(; b <= b_end - 4; b += 4)
+    {
+        uint32x4_t sum = vdupq_n_u32(0);
+
+        for(unsigned int h = 0; h < _num_local_hist; ++h)
+        {
+            sum = vaddq_u32(sum, vld1q_u32(_local_hist + h * stride + b));
+        }
+
+        vst1q_u32(output + b, sum);
+    }
+
+    // Process leftover bins
+    for(; b < b_end; ++b)
+    {
+        uint32_t sum = 0;
+
+        for(unsigned int h = 0; h < _num_local_hist; ++h)
+        {
+            sum += _local_hist[h * stride + b];
+        }
+
+        output[b] = sum;
+    }
+}
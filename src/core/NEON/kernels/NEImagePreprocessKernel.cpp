@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEImagePreprocessKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IMultiImage.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/MultiImageInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+using namespace arm_compute;
+
+namespace
+{
+// BT709 coefficients, as used by NEColorConvertKernel
+constexpr float red_coef_bt709    = 1.5748f;
+constexpr float green_coef_bt709  = -0.1873f;
+constexpr float green_coef2_bt709 = -0.4681f;
+constexpr float blue_coef_bt709   = 1.8556f;
+
+Status validate_arguments(const ITensorInfo *output, const std::array<float, 3> &std_dev)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32, DataType::QASYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(2) != 3, "The output must have 3 planes");
+    ARM_COMPUTE_RETURN_ERROR_ON(output->tensor_shape().total_size_upper(3) != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(std_dev[0] == 0.f || std_dev[1] == 0.f || std_dev[2] == 0.f);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->data_type() == DataType::QASYMM8 && output->quantization_info().scale == 0.f);
+
+    return Status{};
+}
+
+/** Load 4 source pixels into a vector of floats
+ *
+ * @param[in] ptr     Pointer to the source row
+ * @param[in] offsets Byte offsets of the 4 pixels
+ *
+ * @return the pixels converted to float
+ */
+inline float32x4_t gather(const uint8_t *ptr, const int32_t *offsets)
+{
+    const float values[4] =
+    {
+        static_cast<float>(ptr[offsets[0]]),
+        static_cast<float>(ptr[offsets[1]]),
+        static_cast<float>(ptr[offsets[2]]),
+        static_cast<float>(ptr[offsets[3]])
+    };
+
+    return vld1q_f32(values);
+}
+
+/** Bilinear interpolation of 4 output pixels
+ *
+ * @param[in] row0 Pointer to the upper source row
+ * @param[in] row1 Pointer to the lower source row
+ * @param[in] x0   Byte offsets of the left taps
+ * @param[in] x1   Byte offsets of the right taps
+ * @param[in] wx   Weights of the right taps
+ * @param[in] wy   Weight of the lower row
+ *
+ * @return the interpolated pixels
+ */
+inline float32x4_t bilinear(const uint8_t *row0, const uint8_t *row1, const int32_t *x0, const int32_t *x1, const float32x4_t &wx, const float32x4_t &wy)
+{
+    const float32x4_t p00 = gather(row0, x0);
+    const float32x4_t p01 = gather(row0, x1);
+    const float32x4_t p10 = gather(row1, x0);
+    const float32x4_t p11 = gather(row1, x1);
+
+    const float32x4_t top    = vmlaq_f32(p00, wx, vsubq_f32(p01, p00));
+    const float32x4_t bottom = vmlaq_f32(p10, wx, vsubq_f32(p11, p10));
+
+    return vmlaq_f32(top, wy, vsubq_f32(bottom, top));
+}
+
+/** Store the first @p n elements of a normalised vector
+ *
+ * @param[out] ptr Destination pointer
+ * @param[in]  v   Normalised values
+ * @param[in]  n   Number of values to store
+ */
+inline void store(float *ptr, const float32x4_t &v, int n)
+{
+    if(n == 4)
+    {
+        vst1q_f32(ptr, v);
+    }
+    else
+    {
+        float tmp[4];
+        vst1q_f32(tmp, v);
+        std::copy_n(tmp, n, ptr);
+    }
+}
+
+/** Round, saturate and store the first @p n elements of a normalised vector already expressed in the quantized domain
+ *
+ * @param[out] ptr Destination pointer
+ * @param[in]  v   Normalised values
+ * @param[in]  n   Number of values to store
+ */
+inline void store(uint8_t *ptr, const float32x4_t &v, int n)
+{
+    const float32x4_t clamped = vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.f)), vdupq_n_f32(255.f));
+    const uint16x4_t  q16     = vmovn_u32(vcvtq_u32_f32(vaddq_f32(clamped, vdupq_n_f32(0.5f))));
+    const uint8x8_t   q8      = vmovn_u16(vcombine_u16(q16, q16));
+
+    uint8_t tmp[8];
+    vst1_u8(tmp, q8);
+    std::copy_n(tmp, n, ptr);
+}
+} // namespace
+
+NEImagePreprocessKernel::NEImagePreprocessKernel()
+    : _func(nullptr), _input(nullptr), _multi_input(nullptr), _output(nullptr), _scale(), _bias(), _channel(), _table_x(), _table_y(), _table_uvx(), _table_uvy(), _u_offset(0)
+{
+}
+
+Status NEImagePreprocessKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const std::array<float, 3> &std_dev)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->num_channels() != 3 && input->num_channels() != 4, "Only RGB888 and RGBA8888 are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape().total_size_upper(2) != 1);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(output, std_dev));
+
+    return Status{};
+}
+
+void NEImagePreprocessKernel::compute_table(int src_size, int dst_size, int element_size, SampleTable &table)
+{
+    const float scale  = static_cast<float>(src_size) / dst_size;
+    const int   padded = ceil_to_multiple(dst_size, 4);
+
+    table.index0.resize(padded);
+    table.index1.resize(padded);
+    table.weight.resize(padded);
+
+    for(int d = 0; d < padded; ++d)
+    {
+        // Replicate the last output pixel in the padding so a vector never reads outside of the source
+        const float src = (std::min(d, dst_size - 1) + 0.5f) * scale - 0.5f;
+        const int   i0  = static_cast<int>(std::floor(src));
+
+        table.index0[d] = std::min(std::max(i0, 0), src_size - 1) * element_size;
+        table.index1[d] = std::min(std::max(i0 + 1, 0), src_size - 1) * element_size;
+        table.weight[d] = src - i0;
+    }
+}
+
+void NEImagePreprocessKernel::configure_common(ITensor *output, int width, int height, const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr)
+{
+    _output = output;
+
+    const int output_width  = output->info()->dimension(0);
+    const int output_height = output->info()->dimension(1);
+
+    compute_table(width, output_width, _input != nullptr ? _input->info()->element_size() : 1, _table_x);
+    compute_table(height, output_height, 1, _table_y);
+
+    // Fold the normalisation and, for QASYMM8, the quantization in a single multiply-add per value
+    const bool             is_quantized = output->info()->data_type() == DataType::QASYMM8;
+    const QuantizationInfo qinfo        = output->info()->quantization_info();
+
+    for(int plane = 0; plane < 3; ++plane)
+    {
+        const int channel = bgr ? 2 - plane : plane;
+
+        _channel[plane] = channel;
+        _scale[plane]   = 1.f / std_dev[channel];
+        _bias[plane]    = -mean[channel] / std_dev[channel];
+
+        if(is_quantized)
+        {
+            _scale[plane] /= qinfo.scale;
+            _bias[plane] = _bias[plane] / qinfo.scale + qinfo.offset;
+        }
+    }
+
+    switch(output->info()->data_type())
+    {
+        case DataType::F32:
+            _func = (_input != nullptr) ? &NEImagePreprocessKernel::preprocess_rgb<float> : &NEImagePreprocessKernel::preprocess_nv<float>;
+            break;
+        case DataType::QASYMM8:
+            _func = (_input != nullptr) ? &NEImagePreprocessKernel::preprocess_rgb<uint8_t> : &NEImagePreprocessKernel::preprocess_nv<uint8_t>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not supported");
+            break;
+    }
+
+    // Configure kernel window: each window step computes a whole output row of the 3 planes. The tables clamp all the
+    // accesses to the source and the stores are bounded by the width, so no padding is needed.
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, output_height, 1));
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEImagePreprocessKernel::configure(const IImage *input, ITensor *output, const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(input->info(), output->info(), std_dev));
+
+    _input       = input;
+    _multi_input = nullptr;
+
+    configure_common(output, input->info()->dimension(0), input->info()->dimension(1), mean, std_dev, bgr);
+}
+
+void NEImagePreprocessKernel::configure(const IMultiImage *input, ITensor *output, const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_ON(input->info()->format() != Format::NV12 && input->info()->format() != Format::NV21);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(output->info(), std_dev));
+
+    _input       = nullptr;
+    _multi_input = input;
+    _u_offset    = (input->info()->format() == Format::NV12) ? 0 : 1;
+
+    const ITensorInfo *uv_info = input->plane(1)->info();
+
+    compute_table(uv_info->dimension(0), output->info()->dimension(0), uv_info->element_size(), _table_uvx);
+    compute_table(uv_info->dimension(1), output->info()->dimension(1), 1, _table_uvy);
+
+    configure_common(output, input->info()->width(), input->info()->height(), mean, std_dev, bgr);
+}
+
+template <typename T>
+void NEImagePreprocessKernel::preprocess_rgb(const Window &window)
+{
+    const int      width        = _output->info()->dimension(0);
+    const size_t   in_stride    = _input->info()->strides_in_bytes()[1];
+    const size_t   plane_stride = _output->info()->strides_in_bytes()[2];
+    const uint8_t *in_base      = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t    *row0 = in_base + _table_y.index0[id.y()] * in_stride;
+        const uint8_t    *row1 = in_base + _table_y.index1[id.y()] * in_stride;
+        const float32x4_t wy   = vdupq_n_f32(_table_y.weight[id.y()]);
+
+        for(int x = 0; x < width; x += 4)
+        {
+            const float32x4_t wx = vld1q_f32(_table_x.weight.data() + x);
+            const int32_t    *x0 = _table_x.index0.data() + x;
+            const int32_t    *x1 = _table_x.index1.data() + x;
+
+            const float32x4_t rgb[3] =
+            {
+                bilinear(row0, row1, x0, x1, wx, wy),
+                bilinear(row0 + 1, row1 + 1, x0, x1, wx, wy),
+                bilinear(row0 + 2, row1 + 2, x0, x1, wx, wy)
+            };
+
+            for(int plane = 0; plane < 3; ++plane)
+            {
+                const float32x4_t res = vmlaq_f32(vdupq_n_f32(_bias[plane]), rgb[_channel[plane]], vdupq_n_f32(_scale[plane]));
+                store(reinterpret_cast<T *>(out.ptr() + plane * plane_stride) + x, res, std::min(4, width - x));
+            }
+        }
+    },
+    out);
+}
+
+template <typename T>
+void NEImagePreprocessKernel::preprocess_nv(const Window &window)
+{
+    const IImage  *luma         = _multi_input->plane(0);
+    const IImage  *chroma       = _multi_input->plane(1);
+    const int      width        = _output->info()->dimension(0);
+    const size_t   luma_stride  = luma->info()->strides_in_bytes()[1];
+    const size_t   uv_stride    = chroma->info()->strides_in_bytes()[1];
+    const size_t   plane_stride = _output->info()->strides_in_bytes()[2];
+    const uint8_t *luma_base    = luma->buffer() + luma->info()->offset_first_element_in_bytes();
+    const uint8_t *uv_base      = chroma->buffer() + chroma->info()->offset_first_element_in_bytes() + _u_offset;
+
+    const float32x4_t c0   = vdupq_n_f32(0.f);
+    const float32x4_t c128 = vdupq_n_f32(128.f);
+    const float32x4_t c255 = vdupq_n_f32(255.f);
+
+    // Offset from U to V within an interleaved chroma pixel
+    const int v_offset = 1 - 2 * static_cast<int>(_u_offset);
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t    *y_row0  = luma_base + _table_y.index0[id.y()] * luma_stride;
+        const uint8_t    *y_row1  = luma_base + _table_y.index1[id.y()] * luma_stride;
+        const uint8_t    *uv_row0 = uv_base + _table_uvy.index0[id.y()] * uv_stride;
+        const uint8_t    *uv_row1 = uv_base + _table_uvy.index1[id.y()] * uv_stride;
+        const float32x4_t wy      = vdupq_n_f32(_table_y.weight[id.y()]);
+        const float32x4_t wuvy    = vdupq_n_f32(_table_uvy.weight[id.y()]);
+
+        for(int x = 0; x < width; x += 4)
+        {
+            const float32x4_t wx   = vld1q_f32(_table_x.weight.data() + x);
+            const float32x4_t wuvx = vld1q_f32(_table_uvx.weight.data() + x);
+            const int32_t    *x0   = _table_x.index0.data() + x;
+            const int32_t    *x1   = _table_x.index1.data() + x;
+            const int32_t    *uvx0 = _table_uvx.index0.data() + x;
+            const int32_t    *uvx1 = _table_uvx.index1.data() + x;
+
+            const float32x4_t y = bilinear(y_row0, y_row1, x0, x1, wx, wy);
+            const float32x4_t u = vsubq_f32(bilinear(uv_row0, uv_row1, uvx0, uvx1, wuvx, wuvy), c128);
+            const float32x4_t v = vsubq_f32(bilinear(uv_row0 + v_offset, uv_row1 + v_offset, uvx0, uvx1, wuvx, wuvy), c128);
+
+            const float32x4_t rgb[3] =
+            {
+                vminq_f32(vmaxq_f32(vmlaq_n_f32(y, v, red_coef_bt709), c0), c255),
+                vminq_f32(vmaxq_f32(vmlaq_n_f32(vmlaq_n_f32(y, u, green_coef_bt709), v, green_coef2_bt709), c0), c255),
+                vminq_f32(vmaxq_f32(vmlaq_n_f32(y, u, blue_coef_bt709), c0), c255)
+            };
+
+            for(int plane = 0; plane < 3; ++plane)
+            {
+                const float32x4_t res = vmlaq_f32(vdupq_n_f32(_bias[plane]), rgb[_channel[plane]], vdupq_n_f32(_scale[plane]));
+                store(reinterpret_cast<T *>(out.ptr() + plane * plane_stride) + x, res, std::min(4, width - x));
+            }
+        }
+    },
+    out);
+}
+
+void NEImagePreprocessKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
@@ -43,6 +43,7 @@ constexpr float D0                    = 1 << W_BITS;
 constexpr float DETERMINANT_THRESHOLD = 1.0e-07f; // Threshold for the determinant. Used for lost tracking criteria
 constexpr float EIGENVALUE_THRESHOLD  = 1.0e-04f; // Thresholds for minimum eigenvalue. Used for lost tracking criteria
 constexpr float FLT_SCALE             = 1.0f / (1 << 20);
+constexpr int   NUM_LANES             = 4; // Number of keypoints tracked together
 
 namespace
 {
@@ -130,7 +131,7 @@ void NELKTrackerKernel::init_keypoints(int start, int end)
     }
 }
 
-std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(const NELKInternalKeypoint &keypoint, int32_t *bilinear_ix, int32_t *bilinear_iy)
+std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(const NELKInternalKeypoint &keypoint, int32_t *bilinear_ix, int32_t *bilinear_iy, int32_t *bilinear_i)
 {
     int iA11 = 0;
     int iA12 = 0;
@@ -163,7 +164,11 @@ std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(con
     auto                   idy             = reinterpret_cast<const int16_t *>(_old_scharr_gy->buffer() + _old_scharr_gy->info()->offset_element_in_bytes(top_left_window_corner));
     static const int32x4_t nshifter_scharr = vdupq_n_s32(-W_BITS);
 
-    for(int ky = 0; ky < _window_dimension; ++ky, idx += row_stride, idy += row_stride)
+    const size_t           old_row_stride  = _input_old->info()->strides_in_bytes()[1];
+    const uint8_t         *old_ptr         = _input_old->buffer() + _input_old->info()->offset_element_in_bytes(top_left_window_corner);
+    static const int32x4_t nshifter_tensor = vdupq_n_s32(-(W_BITS - 5));
+
+    for(int ky = 0; ky < _window_dimension; ++ky, idx += row_stride, idy += row_stride, old_ptr += old_row_stride)
     {
         int kx = 0;
 
@@ -182,9 +187,16 @@ std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(con
 
             const int32x4_t nyval = compute_bilinear_interpolation(ndy_row1, ndy_row2, nw00, nw01, nw10, nw11, nshifter_scharr);
 
+            // Interpolation old tensor
+            const int16x8_t nold_row1 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(old_ptr + kx)));
+            const int16x8_t nold_row2 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(old_ptr + kx + old_row_stride)));
+
+            const int32x4_t noldval = compute_bilinear_interpolation(nold_row1, nold_row2, nw00, nw01, nw10, nw11, nshifter_tensor);
+
             // Store the intermediate data so that we don't need to recalculate them in later stage
             vst1q_s32(bilinear_ix + kx + ky * _window_dimension, nxval);
             vst1q_s32(bilinear_iy + kx + ky * _window_dimension, nyval);
+            vst1q_s32(bilinear_i + kx + ky * _window_dimension, noldval);
 
             // Accumulate Ix^2
             nA11 = vmlaq_s32(nA11, nxval, nxval);
@@ -208,6 +220,8 @@ std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(con
 
             bilinear_ix[kx + ky * _window_dimension] = ixval;
             bilinear_iy[kx + ky * _window_dimension] = iyval;
+            bilinear_i[kx + ky * _window_dimension]  = get_pixel<uint8_t>(_input_old, top_left_window_corner.x() + kx, top_left_window_corner.y() + ky,
+                                                                          iw00, iw01, iw10, iw11, W_BITS - 5);
         }
     }
 
@@ -218,8 +232,7 @@ std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(con
     return std::make_tuple(iA11, iA12, iA22);
 }
 
-std::pair<int, int> NELKTrackerKernel::compute_image_mismatch_vector(const NELKInternalKeypoint &old_keypoint, const NELKInternalKeypoint &new_keypoint, const int32_t *bilinear_ix,
-                                                                     const int32_t *bilinear_iy)
+std::pair<int, int> NELKTrackerKernel::compute_image_mismatch_vector(const NELKInternalKeypoint &new_keypoint, const int32_t *bilinear_ix, const int32_t *bilinear_iy, const int32_t *bilinear_i)
 {
     int ib1 = 0;
     int ib2 = 0;
@@ -227,23 +240,6 @@ std::pair<int, int> NELKTrackerKernel::compute_image_mismatch_vector(const NELKI
     int32x4_t nb1 = vdupq_n_s32(0);
     int32x4_t nb2 = vdupq_n_s32(0);
 
-    // Compute weights for the old keypoint
-    float old_keypoint_int_x = 0;
-    float old_keypoint_int_y = 0;
-
-    const float old_wx = std::modf(old_keypoint.x, &old_keypoint_int_x);
-    const float old_wy = std::modf(old_keypoint.y, &old_keypoint_int_y);
-
-    const int iw00_old = roundf((1.0f - old_wx) * (1.0f - old_wy) * D0);
-    const int iw01_old = roundf(old_wx * (1.0f - old_wy) * D0);
-    const int iw10_old = roundf((1.0f - old_wx) * old_wy * D0);
-    const int iw11_old = D0 - iw00_old - iw01_old - iw10_old;
-
-    const int16x4_t nw00_old = vdup_n_s16(iw00_old);
-    const int16x4_t nw01_old = vdup_n_s16(iw01_old);
-    const int16x4_t nw10_old = vdup_n_s16(iw10_old);
-    const int16x4_t nw11_old = vdup_n_s16(iw11_old);
-
     // Compute weights for the new keypoint
     float new_keypoint_int_x = 0;
     float new_keypoint_int_y = 0;
@@ -262,25 +258,17 @@ std::pair<int, int> NELKTrackerKernel::compute_image_mismatch_vector(const NELKI
     const int16x4_t nw11_new = vdup_n_s16(iw11_new);
 
     const int              row_stride = _input_new->info()->strides_in_bytes()[1];
-    const Coordinates      top_left_window_corner_old(static_cast<int>(old_keypoint_int_x) - _window_dimension / 2, static_cast<int>(old_keypoint_int_y) - _window_dimension / 2);
     const Coordinates      top_left_window_corner_new(static_cast<int>(new_keypoint_int_x) - _window_dimension / 2, static_cast<int>(new_keypoint_int_y) - _window_dimension / 2);
-    const uint8_t         *old_ptr         = _input_old->buffer() + _input_old->info()->offset_element_in_bytes(top_left_window_corner_old);
     const uint8_t         *new_ptr         = _input_new->buffer() + _input_new->info()->offset_element_in_bytes(top_left_window_corner_new);
     static const int32x4_t nshifter_tensor = vdupq_n_s32(-(W_BITS - 5));
 
-    for(int ky = 0; ky < _window_dimension; ++ky, new_ptr += row_stride, old_ptr += row_stride)
+    for(int ky = 0; ky < _window_dimension; ++ky, new_ptr += row_stride)
     {
         int kx = 0;
 
         // Calculate elements in blocks of four as long as possible
         for(; kx <= _window_dimension - 4; kx += 4)
         {
-            // Interpolation old tensor
-            const int16x8_t nold_row1 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(old_ptr + kx)));
-            const int16x8_t nold_row2 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(old_ptr + kx + row_stride)));
-
-            const int32x4_t noldval = compute_bilinear_interpolation(nold_row1, nold_row2, nw00_old, nw01_old, nw10_old, nw11_old, nshifter_tensor);
-
             // Interpolation new tensor
             const int16x8_t nnew_row1 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(new_ptr + kx)));
             const int16x8_t nnew_row2 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(new_ptr + kx + row_stride)));
@@ -288,7 +276,7 @@ std::pair<int, int> NELKTrackerKernel::compute_image_mismatch_vector(const NELKI
             const int32x4_t nnewval = compute_bilinear_interpolation(nnew_row1, nnew_row2, nw00_new, nw01_new, nw10_new, nw11_new, nshifter_tensor);
 
             // Calculate It gradient, i.e. pixelwise difference between old and new tensor
-            const int32x4_t diff = vsubq_s32(nnewval, noldval);
+            const int32x4_t diff = vsubq_s32(nnewval, vld1q_s32(bilinear_i + kx + ky * _window_dimension));
 
             // Load the Ix and Iy gradient computed in the previous stage
             const int32x4_t nxval = vld1q_s32(bilinear_ix + kx + ky * _window_dimension);
@@ -302,12 +290,10 @@ std::pair<int, int> NELKTrackerKernel::compute_image_mismatch_vector(const NELKI
         // Calculate the leftover elements
         for(; kx < _window_dimension; ++kx)
         {
-            const int32_t ival = get_pixel<uint8_t>(_input_old, top_left_window_corner_old.x() + kx, top_left_window_corner_old.y() + ky,
-                                                    iw00_old, iw01_old, iw10_old, iw11_old, W_BITS - 5);
             const int32_t jval = get_pixel<uint8_t>(_input_new, top_left_window_corner_new.x() + kx, top_left_window_corner_new.y() + ky,
                                                     iw00_new, iw01_new, iw10_new, iw11_new, W_BITS - 5);
 
-            const int32_t diff = jval - ival;
+            const int32_t diff = jval - bilinear_i[kx + ky * _window_dimension];
 
             ib1 += diff * bilinear_ix[kx + ky * _window_dimension];
             ib2 += diff * bilinear_iy[kx + ky * _window_dimension];
@@ -403,8 +389,9 @@ void NELKTrackerKernel::run(const Window &window, const ThreadInfo &info)
     init_keypoints(list_start, list_end);
 
     const int buffer_size = _window_dimension * _window_dimension;
-    int32_t   bilinear_ix[buffer_size];
-    int32_t   bilinear_iy[buffer_size];
+    int32_t   bilinear_ix[NUM_LANES * buffer_size];
+    int32_t   bilinear_iy[NUM_LANES * buffer_size];
+    int32_t   bilinear_i[NUM_LANES * buffer_size];
 
     const int half_window = _window_dimension / 2;
 
@@ -416,63 +403,130 @@ void NELKTrackerKernel::run(const Window &window, const ThreadInfo &info)
         return (x - half_window < _valid_region.start(0)) || (x + half_window >= _valid_region.end(0) - 1) || (y - half_window < _valid_region.start(1)) || (y + half_window >= _valid_region.end(1) - 1);
     };
 
-    for(int list_indx = list_start; list_indx < list_end; ++list_indx)
+    // State of the batch: keypoint tracked by each lane (-1 if idle), its structure tensor and its last motion
+    int          lane_index[NUM_LANES];
+    unsigned int lane_iteration[NUM_LANES];
+    bool         lane_done[NUM_LANES];
+    float        lane_A11[NUM_LANES];
+    float        lane_A12[NUM_LANES];
+    float        lane_A22[NUM_LANES];
+    float        lane_D[NUM_LANES];
+    float        lane_b1[NUM_LANES];
+    float        lane_b2[NUM_LANES];
+    float        lane_delta_x[NUM_LANES];
+    float        lane_delta_y[NUM_LANES];
+    float        lane_mag2[NUM_LANES];
+    float        lane_prev_delta_x[NUM_LANES];
+    float        lane_prev_delta_y[NUM_LANES];
+
+    int next_keypoint = list_start;
+
+    // Hand a lane over to the next keypoint worth tracking. Returns false once all the keypoints of the window have been taken
+    auto fill_lane = [&](int lane)
     {
-        NELKInternalKeypoint &old_keypoint = _old_points_internal->at(list_indx);
-        NELKInternalKeypoint &new_keypoint = _new_points_internal->at(list_indx);
-
-        if(!old_keypoint.tracking_status)
+        for(; next_keypoint < list_end; ++next_keypoint)
         {
-            continue;
-        }
+            const NELKInternalKeypoint &old_keypoint = _old_points_internal->at(next_keypoint);
+            NELKInternalKeypoint       &new_keypoint = _new_points_internal->at(next_keypoint);
 
-        if(is_invalid_keypoint(old_keypoint))
-        {
-            if(_level == 0)
+            if(!old_keypoint.tracking_status)
             {
-                new_keypoint.tracking_status = false;
+                continue;
             }
 
-            continue;
-        }
+            if(is_invalid_keypoint(old_keypoint))
+            {
+                if(_level == 0)
+                {
+                    new_keypoint.tracking_status = false;
+                }
 
-        // Compute spatial gradient matrix
-        int iA11 = 0;
-        int iA12 = 0;
-        int iA22 = 0;
+                continue;
+            }
 
-        std::tie(iA11, iA12, iA22) = compute_spatial_gradient_matrix(old_keypoint, bilinear_ix, bilinear_iy);
+            // Compute spatial gradient matrix
+            int iA11 = 0;
+            int iA12 = 0;
+            int iA22 = 0;
 
-        const float A11 = iA11 * FLT_SCALE;
-        const float A12 = iA12 * FLT_SCALE;
-        const float A22 = iA22 * FLT_SCALE;
+            std::tie(iA11, iA12, iA22) = compute_spatial_gradient_matrix(old_keypoint, bilinear_ix + lane * buffer_size, bilinear_iy + lane * buffer_size, bilinear_i + lane * buffer_size);
 
-        // Calculate minimum eigenvalue
-        const float sum_A11_A22  = A11 + A22;
-        const float discriminant = sum_A11_A22 * sum_A11_A22 - 4.0f * (A11 * A22 - A12 * A12);
-        // Divide by _window_dimension^2 to reduce the floating point accummulation error
-        const float minimum_eigenvalue = (sum_A11_A22 - std::sqrt(discriminant)) / (2.0f * _window_dimension * _window_dimension);
+            const float A11 = iA11 * FLT_SCALE;
+            const float A12 = iA12 * FLT_SCALE;
+            const float A22 = iA22 * FLT_SCALE;
 
-        // Determinant
-        const double D = A11 * A22 - A12 * A12;
+            // Calculate minimum eigenvalue
+            const float sum_A11_A22  = A11 + A22;
+            const float discriminant = sum_A11_A22 * sum_A11_A22 - 4.0f * (A11 * A22 - A12 * A12);
+            // Divide by _window_dimension^2 to reduce the floating point accummulation error
+            const float minimum_eigenvalue = (sum_A11_A22 - std::sqrt(discriminant)) / (2.0f * _window_dimension * _window_dimension);
 
-        // Check if it is a good point to track
-        if(minimum_eigenvalue < EIGENVALUE_THRESHOLD || D < DETERMINANT_THRESHOLD)
-        {
-            // Invalidate tracked point
-            if(_level == 0)
+            // Determinant
+            const float D = A11 * A22 - A12 * A12;
+
+            // Check if it is a good point to track
+            if(minimum_eigenvalue < EIGENVALUE_THRESHOLD || D < DETERMINANT_THRESHOLD)
             {
-                new_keypoint.tracking_status = false;
+                // Invalidate tracked point
+                if(_level == 0)
+                {
+                    new_keypoint.tracking_status = false;
+                }
+
+                continue;
             }
 
-            continue;
+            lane_index[lane]        = next_keypoint++;
+            lane_iteration[lane]    = 0;
+            lane_A11[lane]          = A11;
+            lane_A12[lane]          = A12;
+            lane_A22[lane]          = A22;
+            lane_D[lane]            = D;
+            lane_prev_delta_x[lane] = 0.0f;
+            lane_prev_delta_y[lane] = 0.0f;
+
+            return true;
         }
 
-        float prev_delta_x = 0.0f;
-        float prev_delta_y = 0.0f;
+        // Idle lanes solve a dummy system
+        lane_index[lane] = -1;
+        lane_A11[lane]   = 0.0f;
+        lane_A12[lane]   = 0.0f;
+        lane_A22[lane]   = 0.0f;
+        lane_D[lane]     = 1.0f;
+
+        return false;
+    };
+
+    int num_active_lanes = 0;
 
-        for(unsigned int j = 0; j < _num_iterations || _termination == Termination::TERM_CRITERIA_EPSILON; ++j)
+    for(int lane = 0; lane < NUM_LANES; ++lane)
+    {
+        num_active_lanes += fill_lane(lane) ? 1 : 0;
+    }
+
+    while(num_active_lanes > 0)
+    {
+        // Compute image mismatch vectors
+        for(int lane = 0; lane < NUM_LANES; ++lane)
         {
+            lane_b1[lane]   = 0.0f;
+            lane_b2[lane]   = 0.0f;
+            lane_done[lane] = (lane_index[lane] < 0);
+
+            if(lane_done[lane])
+            {
+                continue;
+            }
+
+            NELKInternalKeypoint &new_keypoint = _new_points_internal->at(lane_index[lane]);
+
+            if(lane_iteration[lane] >= _num_iterations && _termination != Termination::TERM_CRITERIA_EPSILON)
+            {
+                lane_done[lane] = true;
+                continue;
+            }
+
             if(is_invalid_keypoint(new_keypoint))
             {
                 if(_level == 0)
@@ -480,44 +534,85 @@ void NELKTrackerKernel::run(const Window &window, const ThreadInfo &info)
                     new_keypoint.tracking_status = false;
                 }
 
-                break;
+                lane_done[lane] = true;
+                continue;
             }
 
-            // Compute image mismatch vector
             int ib1 = 0;
             int ib2 = 0;
 
-            std::tie(ib1, ib2) = compute_image_mismatch_vector(old_keypoint, new_keypoint, bilinear_ix, bilinear_iy);
+            std::tie(ib1, ib2) = compute_image_mismatch_vector(new_keypoint, bilinear_ix + lane * buffer_size, bilinear_iy + lane * buffer_size, bilinear_i + lane * buffer_size);
 
-            double b1 = ib1 * FLT_SCALE;
-            double b2 = ib2 * FLT_SCALE;
+            lane_b1[lane] = ib1 * FLT_SCALE;
+            lane_b2[lane] = ib2 * FLT_SCALE;
+        }
+
+        // Compute motion vectors of the batch -> A^-1 * -b
+        {
+            const float32x4_t A11 = vld1q_f32(lane_A11);
+            const float32x4_t A12 = vld1q_f32(lane_A12);
+            const float32x4_t A22 = vld1q_f32(lane_A22);
+            const float32x4_t D   = vld1q_f32(lane_D);
+            const float32x4_t b1  = vld1q_f32(lane_b1);
+            const float32x4_t b2  = vld1q_f32(lane_b2);
+
+            // 1 / D with two Newton-Raphson iterations
+            float32x4_t inv_D = vrecpeq_f32(D);
+            inv_D             = vmulq_f32(vrecpsq_f32(D, inv_D), inv_D);
+            inv_D             = vmulq_f32(vrecpsq_f32(D, inv_D), inv_D);
+
+            const float32x4_t delta_x = vmulq_f32(vmlsq_f32(vmulq_f32(A12, b2), A22, b1), inv_D);
+            const float32x4_t delta_y = vmulq_f32(vmlsq_f32(vmulq_f32(A12, b1), A11, b2), inv_D);
+
+            vst1q_f32(lane_delta_x, delta_x);
+            vst1q_f32(lane_delta_y, delta_y);
+            vst1q_f32(lane_mag2, vmlaq_f32(vmulq_f32(delta_x, delta_x), delta_y, delta_y));
+        }
+
+        // Update the new positions and check the termination criteria
+        for(int lane = 0; lane < NUM_LANES; ++lane)
+        {
+            if(lane_done[lane])
+            {
+                continue;
+            }
 
-            // Compute motion vector -> A^-1 * -b
-            const float delta_x = (A12 * b2 - A22 * b1) / D;
-            const float delta_y = (A12 * b1 - A11 * b2) / D;
+            NELKInternalKeypoint &new_keypoint = _new_points_internal->at(lane_index[lane]);
+
+            const float delta_x = lane_delta_x[lane];
+            const float delta_y = lane_delta_y[lane];
 
-            // Update the new position
             new_keypoint.x += delta_x;
             new_keypoint.y += delta_y;
 
-            const float mag2 = delta_x * delta_x + delta_y * delta_y;
-
             // Check if termination criteria is EPSILON and if it is satisfied
-            if(mag2 <= _epsilon && (_termination == Termination::TERM_CRITERIA_EPSILON || _termination == Termination::TERM_CRITERIA_BOTH))
+            if(lane_mag2[lane] <= _epsilon && (_termination == Termination::TERM_CRITERIA_EPSILON || _termination == Termination::TERM_CRITERIA_BOTH))
             {
-                break;
+                lane_done[lane] = true;
+                continue;
             }
 
             // Check convergence analyzing the previous delta
-            if(j > 0 && std::fabs(delta_x + prev_delta_x) < 0.01f && std::fabs(delta_y + prev_delta_y) < 0.01f)
+            if(lane_iteration[lane] > 0 && std::fabs(delta_x + lane_prev_delta_x[lane]) < 0.01f && std::fabs(delta_y + lane_prev_delta_y[lane]) < 0.01f)
             {
                 new_keypoint.x -= delta_x * _pyramid_scale;
                 new_keypoint.y -= delta_y * _pyramid_scale;
-                break;
+                lane_done[lane] = true;
+                continue;
             }
 
-            prev_delta_x = delta_x;
-            prev_delta_y = delta_y;
+            lane_prev_delta_x[lane] = delta_x;
+            lane_prev_delta_y[lane] = delta_y;
+            ++lane_iteration[lane];
+        }
+
+        // Refill the lanes whose keypoint terminated so that the batch stays full
+        for(int lane = 0; lane < NUM_LANES; ++lane)
+        {
+            if(lane_done[lane] && lane_index[lane] >= 0 && !fill_lane(lane))
+            {
+                --num_active_lanes;
+            }
         }
     }
 
@@ -866,3 +866,128 @@ template class arm_compute::NEMagnitudePhaseKernel<MagnitudeType::L1NORM, PhaseT
 template class arm_compute::NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>;
 template class arm_compute::NEMagnitudePhaseKernel<MagnitudeType::L1NORM, PhaseType::UNSIGNED>;
 template class arm_compute::NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::UNSIGNED>;
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+NEDerivativeMagnitudePhaseKernel<mag_type, phase_type>::NEDerivativeMagnitudePhaseKernel()
+    : _input(nullptr), _magnitude(nullptr), _phase(nullptr)
+{
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+BorderSize NEDerivativeMagnitudePhaseKernel<mag_type, phase_type>::border_size() const
+{
+    return BorderSize(1);
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+void NEDerivativeMagnitudePhaseKernel<mag_type, phase_type>::configure(const ITensor *input, ITensor *magnitude, ITensor *phase, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, magnitude, phase);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(magnitude, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(phase, 1, DataType::U8);
+
+    _input     = input;
+    _magnitude = magnitude;
+    _phase     = phase;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+    constexpr unsigned int num_rows_read_per_iteration       = 3;
+
+    // Configure kernel window
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+    AccessWindowHorizontal magnitude_access(magnitude->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal phase_access(phase->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_processed_per_iteration + 2, num_rows_read_per_iteration),
+                              magnitude_access,
+                              phase_access);
+
+    magnitude_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+    phase_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+void NEDerivativeMagnitudePhaseKernel<mag_type, phase_type>::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    Iterator in(_input, window);
+    Iterator magnitude(_magnitude, window);
+    Iterator phase(_phase, window);
+
+    const size_t stride = _input->info()->strides_in_bytes()[1];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        /* Load top, bottom, left and right data */
+        const uint8x16_t t_data = vld1q_u8(in.ptr() - stride);
+        const uint8x16_t b_data = vld1q_u8(in.ptr() + stride);
+        const uint8x16_t l_data = vld1q_u8(in.ptr() - 1);
+        const uint8x16_t r_data = vld1q_u8(in.ptr() + 1);
+
+        /* Apply the [-1 0 1] mask along the X direction */
+        const int16x8x2_t input1 =
+        {
+            {
+                vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(r_data))), vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(l_data)))),
+                vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(r_data))), vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(l_data))))
+            }
+        };
+
+        /* Apply the [-1 0 1]^T mask along the Y direction */
+        const int16x8x2_t input2 =
+        {
+            {
+                vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(b_data))), vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(t_data)))),
+                vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(b_data))), vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(t_data))))
+            }
+        };
+
+        /* Compute magnitude */
+        int16x8x2_t mag{ {} };
+
+        if(MagnitudeType::L2NORM == mag_type)
+        {
+            mag.val[0] = magnitude_l2(input1.val[0], input2.val[0]);
+            mag.val[1] = magnitude_l2(input1.val[1], input2.val[1]);
+        }
+        else
+        {
+            mag.val[0] = magnitude_l1(input1.val[0], input2.val[0]);
+            mag.val[1] = magnitude_l1(input1.val[1], input2.val[1]);
+        }
+
+        /* Store magnitude */
+        vst1q_s16(reinterpret_cast<int16_t *>(magnitude.ptr()), mag.val[0]);
+        vst1q_s16(reinterpret_cast<int16_t *>(magnitude.ptr()) + 8, mag.val[1]);
+
+        /* Compute phase */
+        uint8x8x2_t vphase{ {} };
+
+        if(PhaseType::SIGNED == phase_type)
+        {
+            vphase.val[0] = phase_signed(input1.val[0], input2.val[0]);
+            vphase.val[1] = phase_signed(input1.val[1], input2.val[1]);
+        }
+        else
+        {
+            vphase.val[0] = phase_unsigned(input1.val[0], input2.val[0]);
+            vphase.val[1] = phase_unsigned(input1.val[1], input2.val[1]);
+        }
+
+        /* Store phase */
+        vst1q_u8(phase.ptr(), vcombine_u8(vphase.val[0], vphase.val[1]));
+    },
+    in, magnitude, phase);
+}
+
+template class arm_compute::NEDerivativeMagnitudePhaseKernel<MagnitudeType::L1NORM, PhaseType::SIGNED>;
+template class arm_compute::NEDerivativeMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>;
+template class arm_compute::NEDerivativeMagnitudePhaseKernel<MagnitudeType::L1NORM, PhaseType::UNSIGNED>;
+template class arm_compute::NEDerivativeMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::UNSIGNED>;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017 ARM Limited.
+ * Copyright (c) 2017-2018 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,11 +32,77 @@
 #include "arm_compute/core/Window.h"
 #include "support/ToolchainSupport.h"
 
-#include <cfloat>
+#include <arm_neon.h>
 #include <cmath>
 
 using namespace arm_compute;
 
+namespace
+{
+template <typename T>
+void roi_pooling(const ITensor *input, const IROIArray *rois, ITensor *output, const ROIPoolingLayerInfo &pool_info, int roi_list_start, int roi_list_end)
+{
+    const int   width         = input->info()->dimension(Window::DimX);
+    const int   height        = input->info()->dimension(Window::DimY);
+    const int   fms           = input->info()->dimension(Window::DimZ);
+    const int   pooled_w      = pool_info.pooled_width();
+    const int   pooled_h      = pool_info.pooled_height();
+    const float spatial_scale = pool_info.spatial_scale();
+
+    for(int roi_indx = roi_list_start; roi_indx < roi_list_end; ++roi_indx)
+    {
+        const ROI &curr_roi = rois->at(roi_indx);
+
+        // Scale ROI
+        const int roi_batch    = curr_roi.batch_idx;
+        const int roi_anchor_x = support::cpp11::round(curr_roi.rect.x * spatial_scale);
+        const int roi_anchor_y = support::cpp11::round(curr_roi.rect.y * spatial_scale);
+        const int roi_width    = std::max(support::cpp11::round(curr_roi.rect.width * spatial_scale), 1.f);
+        const int roi_height   = std::max(support::cpp11::round(curr_roi.rect.height * spatial_scale), 1.f);
+
+        // Iterate through all feature maps
+        for(int fm = 0; fm < fms; ++fm)
+        {
+            // Iterate through all output pixels
+            for(int py = 0; py < pooled_h; ++py)
+            {
+                for(int px = 0; px < pooled_w; ++px)
+                {
+                    auto region_start_x = static_cast<int>(std::floor((static_cast<float>(px) / pooled_w) * roi_width));
+                    auto region_end_x   = static_cast<int>(std::floor((static_cast<float>(px + 1) / pooled_w) * roi_width));
+                    auto region_start_y = static_cast<int>(std::floor((static_cast<float>(py) / pooled_h) * roi_height));
+                    auto region_end_y   = static_cast<int>(std::floor((static_cast<float>(py + 1) / pooled_h) * roi_height));
+
+                    region_start_x = std::min(std::max(region_start_x + roi_anchor_x, 0), width);
+                    region_end_x   = std::min(std::max(region_end_x + roi_anchor_x, 0), width);
+                    region_start_y = std::min(std::max(region_start_y + roi_anchor_y, 0), height);
+                    region_end_y   = std::min(std::max(region_end_y + roi_anchor_y, 0), height);
+
+                    // Iterate through the pooling region
+                    if((region_end_x <= region_start_x) || (region_end_y <= region_start_y))
+                    {
+                        *reinterpret_cast<T *>(output->ptr_to_element(Coordinates(px, py, fm, roi_indx))) = static_cast<T>(0);
+                    }
+                    else
+                    {
+                        T curr_max = *reinterpret_cast<const T *>(input->ptr_to_element(Coordinates(region_start_x, region_start_y, fm, roi_batch)));
+                        for(int j = region_start_y; j < region_end_y; ++j)
+                        {
+                            for(int i = region_start_x; i < region_end_x; ++i)
+                            {
+                                const auto val = *reinterpret_cast<const T *>(input->ptr_to_element(Coordinates(i, j, fm, roi_batch)));
+                                curr_max       = std::max(val, curr_max);
+                            }
+                        }
+                        *reinterpret_cast<T *>(output->ptr_to_element(Coordinates(px, py, fm, roi_indx))) = curr_max;
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace
+
 NEROIPoolingLayerKernel::NEROIPoolingLayerKernel()
     : _input(nullptr), _rois(nullptr), _output(nullptr), _pool_info(0, 0, 0.f)
 {
@@ -45,7 +111,7 @@ NEROIPoolingLayerKernel::NEROIPoolingLayerKernel()
 void NEROIPoolingLayerKernel::configure(const ITensor *input, const IROIArray *rois, ITensor *output, const ROIPoolingLayerInfo &pool_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, rois, output);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON((pool_info.pooled_width() == 0) || (pool_info.pooled_height() == 0));
     ARM_COMPUTE_ERROR_ON(rois->num_values() == 0);
 
@@ -85,64 +151,20 @@ void NEROIPoolingLayerKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    const int   roi_list_start = window.x().start();
-    const int   roi_list_end   = window.x().end();
-    const int   width          = _input->info()->dimension(Window::DimX);
-    const int   height         = _input->info()->dimension(Window::DimY);
-    const int   fms            = _input->info()->dimension(Window::DimZ);
-    const int   pooled_w       = _pool_info.pooled_width();
-    const int   pooled_h       = _pool_info.pooled_height();
-    const float spatial_scale  = _pool_info.spatial_scale();
+    const int roi_list_start = window.x().start();
+    const int roi_list_end   = window.x().end();
 
-    for(int roi_indx = roi_list_start; roi_indx < roi_list_end; ++roi_indx)
+    switch(_input->info()->data_type())
     {
-        const ROI &curr_roi = _rois->at(roi_indx);
-
-        // Scale ROI
-        const int roi_batch    = curr_roi.batch_idx;
-        const int roi_anchor_x = support::cpp11::round(curr_roi.rect.x * spatial_scale);
-        const int roi_anchor_y = support::cpp11::round(curr_roi.rect.y * spatial_scale);
-        const int roi_width    = std::max(support::cpp11::round(curr_roi.rect.width * spatial_scale), 1.f);
-        const int roi_height   = std::max(support::cpp11::round(curr_roi.rect.height * spatial_scale), 1.f);
-
-        // Iterate through all feature maps
-        for(int fm = 0; fm < fms; ++fm)
-        {
-            // Iterate through all output pixels
-            for(int py = 0; py < pooled_h; ++py)
-            {
-                for(int px = 0; px < pooled_w; ++px)
-                {
-                    auto region_start_x = static_cast<int>(std::floor((static_cast<float>(px) / pooled_w) * roi_width));
-                    auto region_end_x   = static_cast<int>(std::floor((static_cast<float>(px + 1) / pooled_w) * roi_width));
-                    auto region_start_y = static_cast<int>(std::floor((static_cast<float>(py) / pooled_h) * roi_height));
-                    auto region_end_y   = static_cast<int>(std::floor((static_cast<float>(py + 1) / pooled_h) * roi_height));
-
-                    region_start_x = std::min(std::max(region_start_x + roi_anchor_x, 0), width);
-                    region_end_x   = std::min(std::max(region_end_x + roi_anchor_x, 0), width);
-                    region_start_y = std::min(std::max(region_start_y + roi_anchor_y, 0), height);
-                    region_end_y   = std::min(std::max(region_end_y + roi_anchor_y, 0), height);
-
-                    // Iterate through the pooling region
-                    if((region_end_x <= region_start_x) || (region_end_y <= region_start_y))
-                    {
-                        *reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(px, py, fm, roi_indx))) = 0;
-                    }
-                    else
-                    {
-                        float curr_max = -FLT_MAX;
-                        for(int j = region_start_y; j < region_end_y; ++j)
-                        {
-                            for(int i = region_start_x; i < region_end_x; ++i)
-                            {
-                                const auto val = *reinterpret_cast<const float *>(_input->ptr_to_element(Coordinates(i, j, fm, roi_batch)));
-                                curr_max       = std::max(val, curr_max);
-                            }
-                        }
-                        *reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(px, py, fm, roi_indx))) = curr_max;
-                    }
-                }
-            }
-        }
+        case DataType::F32:
+            roi_pooling<float>(_input, _rois, _output, _pool_info, roi_list_start, roi_list_end);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            roi_pooling<float16_t>(_input, _rois, _output, _pool_info, roi_list_start, roi_list_end);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
     }
 }
@@ -31,7 +31,9 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <arm_neon.h>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 
@@ -61,10 +63,85 @@ inline int32x4_t offset_nearest_interpolation(const float *mapx_ptr, const float
     return vmlaq_s32(x_s32, y_s32, stride);
 }
 
+inline void remap_nearest_16(const uint8_t *in_ptr, const float *mapx_ptr, const float *mapy_ptr, const float32x4_t &width, const float32x4_t &height, const int32x4_t &in_stride, uint8_t *out_ptr)
+{
+    const int32x4_t offset0 = offset_nearest_interpolation(mapx_ptr + 0, mapy_ptr + 0, width, height, in_stride);
+    const int32x4_t offset1 = offset_nearest_interpolation(mapx_ptr + 4, mapy_ptr + 4, width, height, in_stride);
+    const int32x4_t offset2 = offset_nearest_interpolation(mapx_ptr + 8, mapy_ptr + 8, width, height, in_stride);
+    const int32x4_t offset3 = offset_nearest_interpolation(mapx_ptr + 12, mapy_ptr + 12, width, height, in_stride);
+
+    uint8x16_t tmp = vdupq_n_u8(0);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset0, 0)], tmp, 0);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset0, 1)], tmp, 1);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset0, 2)], tmp, 2);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset0, 3)], tmp, 3);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset1, 0)], tmp, 4);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset1, 1)], tmp, 5);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset1, 2)], tmp, 6);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset1, 3)], tmp, 7);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset2, 0)], tmp, 8);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset2, 1)], tmp, 9);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset2, 2)], tmp, 10);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset2, 3)], tmp, 11);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset3, 0)], tmp, 12);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset3, 1)], tmp, 13);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset3, 2)], tmp, 14);
+    tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset3, 3)], tmp, 15);
+    vst1q_u8(out_ptr, tmp);
+}
+
+inline void remap_bilinear_16(const uint8_t *in_ptr, const float *mapx_ptr, const float *mapy_ptr, size_t width, size_t height, size_t in_stride, uint8_t *out_ptr)
+{
+    uint8x8_t tmp0 = vdup_n_u8(0);
+    tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[0], mapy_ptr[0]), tmp0, 0);
+    tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[1], mapy_ptr[1]), tmp0, 1);
+    tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[2], mapy_ptr[2]), tmp0, 2);
+    tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[3], mapy_ptr[3]), tmp0, 3);
+    tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[4], mapy_ptr[4]), tmp0, 4);
+    tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[5], mapy_ptr[5]), tmp0, 5);
+    tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[6], mapy_ptr[6]), tmp0, 6);
+    tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[7], mapy_ptr[7]), tmp0, 7);
+
+    uint8x8_t tmp1 = vdup_n_u8(0);
+    tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[8], mapy_ptr[8]), tmp1, 0);
+    tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[9], mapy_ptr[9]), tmp1, 1);
+    tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[10], mapy_ptr[10]), tmp1, 2);
+    tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[11], mapy_ptr[11]), tmp1, 3);
+    tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[12], mapy_ptr[12]), tmp1, 4);
+    tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[13], mapy_ptr[13]), tmp1, 5);
+    tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[14], mapy_ptr[14]), tmp1, 6);
+    tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[15], mapy_ptr[15]), tmp1, 7);
+
+    vst1q_u8(out_ptr, vcombine_u8(tmp0, tmp1));
+}
+
+/** Bilinearly interpolate a coordinate between four nodes of a sub-sampled map
+ *
+ * @param[in] row0 Upper row of map nodes
+ * @param[in] row1 Lower row of map nodes
+ * @param[in] x0   Index of the left nodes
+ * @param[in] x1   Index of the right nodes
+ * @param[in] wx   Horizontal weight of the right nodes
+ * @param[in] wy   Vertical weight of the lower row
+ *
+ * @return The interpolated coordinate, in the unit of the map nodes
+ */
+template <typename T>
+inline float interpolate_map(const T *row0, const T *row1, int x0, int x1, float wx, float wy)
+{
+    const float top    = row0[x0] + (row0[x1] - row0[x0]) * wx;
+    const float bottom = row1[x0] + (row1[x1] - row1[x0]) * wx;
+
+    return top + (bottom - top) * wy;
+}
+
+/** Tile of the output processed at once: the 16 pixels steps of the kernel over a few rows */
+constexpr int tile_width  = 64;
+constexpr int tile_height = 32;
 } // namespace
 
 NERemapKernel::NERemapKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _map_x(nullptr), _map_y(nullptr)
+    : _func(nullptr), _input(nullptr), _output(nullptr), _map_x(nullptr), _map_y(nullptr), _map_subsampling(1), _map_scale(1.f)
 {
 }
 
@@ -73,28 +150,65 @@ BorderSize NERemapKernel::border_size() const
     return BorderSize(1);
 }
 
-void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy)
+void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy, unsigned int map_subsampling)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_x, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_y, 1, DataType::F32);
-
-    _input  = input;
-    _output = output;
-    _map_x  = map_x;
-    _map_y  = map_y;
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_x, 1, DataType::F32, DataType::QS16);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(map_x, map_y);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_FIXED_POINT(map_x, map_y);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(map_x, map_y);
+    ARM_COMPUTE_ERROR_ON(map_subsampling == 0);
+    ARM_COMPUTE_ERROR_ON_MSG(map_x->info()->dimension(0) != DIV_CEIL(output->info()->dimension(0) - 1, map_subsampling) + 1, "Map width does not match the output and the sub-sampling factor");
+    ARM_COMPUTE_ERROR_ON_MSG(map_x->info()->dimension(1) != DIV_CEIL(output->info()->dimension(1) - 1, map_subsampling) + 1, "Map height does not match the output and the sub-sampling factor");
+
+    _input           = input;
+    _output          = output;
+    _map_x           = map_x;
+    _map_y           = map_y;
+    _map_subsampling = map_subsampling;
+    _map_scale       = 1.f;
+
+    // Dense floating point maps are read in place, any other map is expanded on the fly
+    const bool is_compressed = (map_x->info()->data_type() != DataType::F32) || (map_subsampling != 1);
+
+    if(map_x->info()->data_type() == DataType::QS16)
+    {
+        _map_scale = 1.f / (1 << map_x->info()->fixed_point_position());
+    }
 
     switch(policy)
     {
         case InterpolationPolicy::NEAREST_NEIGHBOR:
         {
-            _func = &NERemapKernel::remap_nearest;
+            if(!is_compressed)
+            {
+                _func = &NERemapKernel::remap_nearest;
+            }
+            else if(map_x->info()->data_type() == DataType::F32)
+            {
+                _func = &NERemapKernel::remap_compressed<InterpolationPolicy::NEAREST_NEIGHBOR, float>;
+            }
+            else
+            {
+                _func = &NERemapKernel::remap_compressed<InterpolationPolicy::NEAREST_NEIGHBOR, int16_t>;
+            }
             break;
         }
         case InterpolationPolicy::BILINEAR:
         {
-            _func = &NERemapKernel::remap_bilinear;
+            if(!is_compressed)
+            {
+                _func = &NERemapKernel::remap_bilinear;
+            }
+            else if(map_x->info()->data_type() == DataType::F32)
+            {
+                _func = &NERemapKernel::remap_compressed<InterpolationPolicy::BILINEAR, float>;
+            }
+            else
+            {
+                _func = &NERemapKernel::remap_compressed<InterpolationPolicy::BILINEAR, int16_t>;
+            }
             break;
         }
         default:
@@ -113,10 +227,19 @@ void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const
     AccessWindowStatic input_access(input->info(), -border_size().left, -border_size().top, access_right, input->info()->dimension(1) + border_size().bottom);
 
     AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
-    AccessWindowHorizontal mapx_access(map_x->info(), 0, 0, num_elems_processed_per_iteration);
-    AccessWindowHorizontal mapy_access(map_y->info(), 0, 0, num_elems_processed_per_iteration);
 
-    update_window_and_padding(win, input_access, mapx_access, mapy_access, output_access);
+    if(is_compressed)
+    {
+        // The nodes of the compressed maps are clamped to their extent: no padding is needed
+        update_window_and_padding(win, input_access, output_access);
+    }
+    else
+    {
+        AccessWindowHorizontal mapx_access(map_x->info(), 0, 0, num_elems_processed_per_iteration);
+        AccessWindowHorizontal mapy_access(map_y->info(), 0, 0, num_elems_processed_per_iteration);
+
+        update_window_and_padding(win, input_access, mapx_access, mapy_access, output_access);
+    }
 
     output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
 
@@ -142,33 +265,7 @@ void NERemapKernel::remap_nearest(const Window &window)
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const auto     mapx_ptr = reinterpret_cast<const float *>(mapx.ptr());
-        const auto     mapy_ptr = reinterpret_cast<const float *>(mapy.ptr());
-        const uint8_t *in_ptr   = in.ptr();
-
-        const int32x4_t offset0 = offset_nearest_interpolation(mapx_ptr + 0, mapy_ptr + 0, width, height, in_stride);
-        const int32x4_t offset1 = offset_nearest_interpolation(mapx_ptr + 4, mapy_ptr + 4, width, height, in_stride);
-        const int32x4_t offset2 = offset_nearest_interpolation(mapx_ptr + 8, mapy_ptr + 8, width, height, in_stride);
-        const int32x4_t offset3 = offset_nearest_interpolation(mapx_ptr + 12, mapy_ptr + 12, width, height, in_stride);
-
-        uint8x16_t tmp = vdupq_n_u8(0);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset0, 0)], tmp, 0);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset0, 1)], tmp, 1);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset0, 2)], tmp, 2);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset0, 3)], tmp, 3);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset1, 0)], tmp, 4);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset1, 1)], tmp, 5);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset1, 2)], tmp, 6);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset1, 3)], tmp, 7);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset2, 0)], tmp, 8);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset2, 1)], tmp, 9);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset2, 2)], tmp, 10);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset2, 3)], tmp, 11);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset3, 0)], tmp, 12);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset3, 1)], tmp, 13);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset3, 2)], tmp, 14);
-        tmp            = vsetq_lane_u8(in_ptr[vgetq_lane_s32(offset3, 3)], tmp, 15);
-        vst1q_u8(out.ptr(), tmp);
+        remap_nearest_16(in.ptr(), reinterpret_cast<const float *>(mapx.ptr()), reinterpret_cast<const float *>(mapy.ptr()), width, height, in_stride, out.ptr());
     },
     in, out, mapx, mapy);
 }
@@ -192,35 +289,100 @@ void NERemapKernel::remap_bilinear(const Window &window)
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const auto     mapx_ptr = reinterpret_cast<float *>(mapx.ptr());
-        const auto     mapy_ptr = reinterpret_cast<float *>(mapy.ptr());
-        const uint8_t *in_ptr   = in.ptr();
-
-        uint8x8_t tmp0 = vdup_n_u8(0);
-        tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[0], mapy_ptr[0]), tmp0, 0);
-        tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[1], mapy_ptr[1]), tmp0, 1);
-        tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[2], mapy_ptr[2]), tmp0, 2);
-        tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[3], mapy_ptr[3]), tmp0, 3);
-        tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[4], mapy_ptr[4]), tmp0, 4);
-        tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[5], mapy_ptr[5]), tmp0, 5);
-        tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[6], mapy_ptr[6]), tmp0, 6);
-        tmp0           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[7], mapy_ptr[7]), tmp0, 7);
-
-        uint8x8_t tmp1 = vdup_n_u8(0);
-        tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[8], mapy_ptr[8]), tmp1, 0);
-        tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[9], mapy_ptr[9]), tmp1, 1);
-        tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[10], mapy_ptr[10]), tmp1, 2);
-        tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[11], mapy_ptr[11]), tmp1, 3);
-        tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[12], mapy_ptr[12]), tmp1, 4);
-        tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[13], mapy_ptr[13]), tmp1, 5);
-        tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[14], mapy_ptr[14]), tmp1, 6);
-        tmp1           = vset_lane_u8(pixel_bilinear_c1_clamp(in_ptr, in_stride, width, height, mapx_ptr[15], mapy_ptr[15]), tmp1, 7);
-
-        vst1q_u8(out.ptr(), vcombine_u8(tmp0, tmp1));
+        remap_bilinear_16(in.ptr(), reinterpret_cast<const float *>(mapx.ptr()), reinterpret_cast<const float *>(mapy.ptr()), width, height, in_stride, out.ptr());
     },
     in, out, mapx, mapy);
 }
 
+template <InterpolationPolicy interpolation, typename T>
+void NERemapKernel::remap_compressed(const Window &window)
+{
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the precomputed offsets
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, window);
+
+    const size_t      width         = _input->info()->dimension(0);
+    const size_t      height        = _input->info()->dimension(1);
+    const size_t      in_stride     = _input->info()->strides_in_bytes()[1];
+    const float32x4_t width_f32     = vdupq_n_f32(static_cast<float>(width));
+    const float32x4_t height_f32    = vdupq_n_f32(static_cast<float>(height));
+    const int32x4_t   in_stride_s32 = vdupq_n_s32(static_cast<int32_t>(in_stride));
+
+    const int   subsampling = static_cast<int>(_map_subsampling);
+    const float inv_sub     = 1.f / subsampling;
+    const int   map_last_x  = static_cast<int>(_map_x->info()->dimension(0)) - 1;
+    const int   map_last_y  = static_cast<int>(_map_x->info()->dimension(1)) - 1;
+
+    float coords_x[16];
+    float coords_y[16];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int   gy0 = id.y() / subsampling;
+        const int   gy1 = std::min(gy0 + 1, map_last_y);
+        const float wy  = (id.y() - gy0 * subsampling) * inv_sub;
+
+        // Only the XY-plane of the maps is sub-sampled
+        Coordinates row0(id);
+        Coordinates row1(id);
+        row0.set(Window::DimX, 0);
+        row0.set(Window::DimY, gy0);
+        row1.set(Window::DimX, 0);
+        row1.set(Window::DimY, gy1);
+
+        const auto mapx_row0 = reinterpret_cast<const T *>(_map_x->ptr_to_element(row0));
+        const auto mapx_row1 = reinterpret_cast<const T *>(_map_x->ptr_to_element(row1));
+        const auto mapy_row0 = reinterpret_cast<const T *>(_map_y->ptr_to_element(row0));
+        const auto mapy_row1 = reinterpret_cast<const T *>(_map_y->ptr_to_element(row1));
+
+        // Expand the coordinates of the 16 pixels from the nodes of the map grid
+        int gx = id.x() / subsampling;
+        int fx = id.x() - gx * subsampling;
+
+        for(int k = 0; k < 16; ++k)
+        {
+            const int   gx0 = std::min(gx, map_last_x);
+            const int   gx1 = std::min(gx + 1, map_last_x);
+            const float wx  = fx * inv_sub;
+
+            coords_x[k] = interpolate_map(mapx_row0, mapx_row1, gx0, gx1, wx, wy) * _map_scale;
+            coords_y[k] = interpolate_map(mapy_row0, mapy_row1, gx0, gx1, wx, wy) * _map_scale;
+
+            if(++fx == subsampling)
+            {
+                fx = 0;
+                ++gx;
+            }
+        }
+
+        switch(interpolation)
+        {
+            case InterpolationPolicy::NEAREST_NEIGHBOR:
+            {
+                // The coordinates are fractional: floor them as the gather truncates towards zero
+                for(int k = 0; k < 16; ++k)
+                {
+                    coords_x[k] = std::floor(coords_x[k]);
+                    coords_y[k] = std::floor(coords_y[k]);
+                }
+                remap_nearest_16(in.ptr(), coords_x, coords_y, width_f32, height_f32, in_stride_s32, out.ptr());
+                break;
+            }
+            case InterpolationPolicy::BILINEAR:
+                remap_bilinear_16(in.ptr(), coords_x, coords_y, width, height, in_stride, out.ptr());
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported interpolation mode");
+        }
+    },
+    in, out);
+}
+
 void NERemapKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
@@ -228,5 +390,18 @@ void NERemapKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (this->*_func)(window);
+    // Walk the window in 2D tiles: for smooth maps the source footprint of a tile stays in the L1 cache
+    Window tile(window);
+
+    for(int y = window.y().start(); y < window.y().end(); y += tile_height)
+    {
+        tile.set(Window::DimY, Window::Dimension(y, std::min(y + tile_height, window.y().end()), window.y().step()));
+
+        for(int x = window.x().start(); x < window.x().end(); x += tile_width)
+        {
+            tile.set(Window::DimX, Window::Dimension(x, std::min(x + tile_width, window.x().end()), window.x().step()));
+
+            (this->*_func)(tile);
+        }
+    }
 }
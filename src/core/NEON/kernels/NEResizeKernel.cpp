@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEResizeKernel.h"
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <limits>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Number of fractional bits of the weights */
+constexpr int weight_bits = 11;
+
+/** Cubic convolution kernel (Keys, a = -0.5)
+ *
+ * @param[in] x Distance to the sample
+ *
+ * @return the weight of the sample
+ */
+inline float cubic_weight(float x)
+{
+    constexpr float a = -0.5f;
+
+    x = std::fabs(x);
+
+    if(x < 1.f)
+    {
+        return ((a + 2.f) * x - (a + 3.f)) * x * x + 1.f;
+    }
+    else if(x < 2.f)
+    {
+        return ((a * x - 5.f * a) * x + 8.f * a) * x - 4.f * a;
+    }
+
+    return 0.f;
+}
+} // namespace
+
+NEResizeKernel::NEResizeKernel()
+    : _input(nullptr), _output(nullptr), _num_channels(1), _table_x(), _table_y(), _x_offsets()
+{
+}
+
+void NEResizeKernel::compute_table(int src_size, int dst_size, InterpolationPolicy policy, SamplingPolicy sampling_policy, ResizeTable &table)
+{
+    const float scale  = static_cast<float>(src_size) / static_cast<float>(dst_size);
+    const bool  center = (sampling_policy == SamplingPolicy::CENTER);
+
+    switch(policy)
+    {
+        case InterpolationPolicy::NEAREST_NEIGHBOR:
+            table.num_taps = 1;
+            break;
+        case InterpolationPolicy::BILINEAR:
+            table.num_taps = 2;
+            break;
+        case InterpolationPolicy::BICUBIC:
+            table.num_taps = 4;
+            break;
+        case InterpolationPolicy::AREA:
+            table.num_taps = static_cast<unsigned int>(std::ceil(scale)) + 1;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Interpolation policy not supported");
+    }
+
+    table.start.resize(dst_size);
+    table.weights.resize(dst_size * table.num_taps);
+
+    std::vector<float> weights(table.num_taps);
+
+    for(int d = 0; d < dst_size; ++d)
+    {
+        std::fill(weights.begin(), weights.end(), 0.f);
+
+        switch(policy)
+        {
+            case InterpolationPolicy::NEAREST_NEIGHBOR:
+            {
+                const float src = center ? (d + 0.5f) * scale : d * scale;
+                table.start[d]  = static_cast<int32_t>(std::floor(src));
+                weights[0]      = 1.f;
+                break;
+            }
+            case InterpolationPolicy::BILINEAR:
+            {
+                const float src = center ? (d + 0.5f) * scale - 0.5f : d * scale;
+                const float i   = std::floor(src);
+                table.start[d]  = static_cast<int32_t>(i);
+                weights[0]      = 1.f - (src - i);
+                weights[1]      = src - i;
+                break;
+            }
+            case InterpolationPolicy::BICUBIC:
+            {
+                const float src = center ? (d + 0.5f) * scale - 0.5f : d * scale;
+                const float i   = std::floor(src);
+                table.start[d]  = static_cast<int32_t>(i) - 1;
+
+                for(unsigned int k = 0; k < table.num_taps; ++k)
+                {
+                    weights[k] = cubic_weight(src - (i - 1.f + k));
+                }
+                break;
+            }
+            case InterpolationPolicy::AREA:
+            {
+                // Average of the source pixels weighted by their overlap with the projection of the destination pixel
+                const float begin = d * scale;
+                const float end   = (d + 1) * scale;
+                table.start[d]    = static_cast<int32_t>(std::floor(begin));
+
+                for(unsigned int k = 0; k < table.num_taps; ++k)
+                {
+                    const float i = table.start[d] + static_cast<float>(k);
+                    weights[k]    = std::max(0.f, std::min(i + 1.f, end) - std::max(i, begin)) / scale;
+                }
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Interpolation policy not supported");
+        }
+
+        // Quantize the weights and make sure they sum to exactly one
+        int16_t     *fixed_weights = table.weights.data() + d * table.num_taps;
+        int          sum           = 0;
+        unsigned int largest       = 0;
+
+        for(unsigned int k = 0; k < table.num_taps; ++k)
+        {
+            fixed_weights[k] = static_cast<int16_t>(std::lround(weights[k] * (1 << weight_bits)));
+            sum += fixed_weights[k];
+            largest = (std::fabs(weights[k]) > std::fabs(weights[largest])) ? k : largest;
+        }
+
+        fixed_weights[largest] += (1 << weight_bits) - sum;
+    }
+}
+
+Status NEResizeKernel::validate(const ITensorInfo *input, const ITensorInfo *output, InterpolationPolicy policy, SamplingPolicy sampling_policy)
+{
+    ARM_COMPUTE_UNUSED(sampling_policy);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->num_channels() != 1 && input->num_channels() != 3 && input->num_channels() != 4, "Only U8, RGB888 and RGBA8888 are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() != output->num_channels());
+    ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) == 0 || output->dimension(1) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(policy != InterpolationPolicy::NEAREST_NEIGHBOR && policy != InterpolationPolicy::BILINEAR && policy != InterpolationPolicy::BICUBIC
+                                && policy != InterpolationPolicy::AREA);
+
+    for(size_t i = 2; i < Coordinates::num_max_dimensions; ++i)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(i) != output->dimension(i));
+    }
+
+    return Status{};
+}
+
+void NEResizeKernel::configure(const ITensor *input, ITensor *output, InterpolationPolicy policy, SamplingPolicy sampling_policy)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(input->info(), output->info(), policy, sampling_policy));
+
+    _input        = input;
+    _output       = output;
+    _num_channels = input->info()->num_channels();
+
+    const int input_width  = input->info()->dimension(0);
+    const int input_height = input->info()->dimension(1);
+    const int output_width = output->info()->dimension(0);
+
+    compute_table(input_width, output_width, policy, sampling_policy, _table_x);
+    compute_table(input_height, output->info()->dimension(1), policy, sampling_policy, _table_y);
+
+    // The horizontal taps are clamped once here, the vertical ones when the source row is selected
+    _x_offsets.resize(output_width * _table_x.num_taps);
+
+    for(int x = 0; x < output_width; ++x)
+    {
+        for(unsigned int k = 0; k < _table_x.num_taps; ++k)
+        {
+            const int src_x                       = std::min(std::max(_table_x.start[x] + static_cast<int>(k), 0), input_width - 1);
+            _x_offsets[x * _table_x.num_taps + k] = src_x * input->info()->element_size();
+        }
+    }
+
+    // Configure kernel window: the tables clamp all the accesses so no padding is needed
+    Window win = calculate_max_window(*output->info());
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEResizeKernel::horizontal_pass(const uint8_t *in, int x_start, int x_end, int32_t *line) const
+{
+    const unsigned int num_taps = _table_x.num_taps;
+
+    for(int x = x_start; x < x_end; ++x)
+    {
+        const int32_t *offsets = _x_offsets.data() + x * num_taps;
+        const int16_t *weights = _table_x.weights.data() + x * num_taps;
+
+        for(unsigned int c = 0; c < _num_channels; ++c)
+        {
+            int32_t sum = 0;
+
+            for(unsigned int k = 0; k < num_taps; ++k)
+            {
+                sum += weights[k] * in[offsets[k] + c];
+            }
+
+            *line++ = sum;
+        }
+    }
+}
+
+void NEResizeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const unsigned int num_lines    = _table_y.num_taps;
+    const int          input_height = _input->info()->dimension(1);
+    const int          x_start      = window.x().start();
+    const int          x_end        = window.x().end();
+    const int          line_size    = (x_end - x_start) * _num_channels;
+
+    // Horizontal pass of the source rows, source row r is stored in slot r % num_lines
+    std::vector<int32_t>         lines(num_lines * line_size);
+    std::vector<int>             line_rows(num_lines);
+    std::vector<const int32_t *> l(num_lines);
+    const uint8_t               *plane = nullptr;
+
+    // Handle X dimension manually
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator out(_output, win);
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        Coordinates plane_id(id);
+        plane_id.set(Window::DimX, 0);
+        plane_id.set(Window::DimY, 0);
+
+        // Lines of a previous plane cannot be reused
+        if(_input->ptr_to_element(plane_id) != plane)
+        {
+            std::fill(line_rows.begin(), line_rows.end(), std::numeric_limits<int>::min());
+            plane = _input->ptr_to_element(plane_id);
+        }
+
+        const int      start   = _table_y.start[id.y()];
+        const int16_t *weights = _table_y.weights.data() + id.y() * num_lines;
+
+        for(unsigned int k = 0; k < num_lines; ++k)
+        {
+            const int          row  = start + static_cast<int>(k);
+            const unsigned int slot = ((row % static_cast<int>(num_lines)) + num_lines) % num_lines;
+
+            if(line_rows[slot] != row)
+            {
+                const int src_y = std::min(std::max(row, 0), input_height - 1);
+                horizontal_pass(plane + src_y * _input->info()->strides_in_bytes()[1], x_start, x_end, lines.data() + slot * line_size);
+                line_rows[slot] = row;
+            }
+
+            l[k] = lines.data() + slot * line_size;
+        }
+
+        // Vertical pass
+        uint8_t *const dst = out.ptr() + x_start * _output->info()->element_size();
+
+        int i = 0;
+
+        for(; i <= line_size - 8; i += 8)
+        {
+            int32x4_t acc_low  = vdupq_n_s32(0);
+            int32x4_t acc_high = vdupq_n_s32(0);
+
+            for(unsigned int k = 0; k < num_lines; ++k)
+            {
+                const int32x4_t w = vdupq_n_s32(weights[k]);
+                acc_low           = vmlaq_s32(acc_low, vld1q_s32(l[k] + i), w);
+                acc_high          = vmlaq_s32(acc_high, vld1q_s32(l[k] + i + 4), w);
+            }
+
+            // Round, saturate and narrow down to U8
+            const uint16x8_t res = vcombine_u16(vqmovun_s32(vrshrq_n_s32(acc_low, 2 * weight_bits)), vqmovun_s32(vrshrq_n_s32(acc_high, 2 * weight_bits)));
+            vst1_u8(dst + i, vqmovn_u16(res));
+        }
+
+        // Left-over elements
+        for(; i < line_size; ++i)
+        {
+            int32_t acc = 0;
+
+            for(unsigned int k = 0; k < num_lines; ++k)
+            {
+                acc += weights[k] * l[k][i];
+            }
+
+            acc    = (acc + (1 << (2 * weight_bits - 1))) >> (2 * weight_bits);
+            dst[i] = static_cast<uint8_t>(std::min(std::max(acc, 0), 255));
+        }
+    },
+    out);
+}
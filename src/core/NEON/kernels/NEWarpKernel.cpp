@@ -32,16 +32,125 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
 #include <cstddef>
 
 using namespace arm_compute;
 
 namespace
 {
+/** Size of the output tiles. A square tile keeps the source footprint small whatever the rotation */
+constexpr int tile_width  = 32;
+constexpr int tile_height = 32;
+
+/** Margin, in pixels, kept from the edges of the valid region to absorb the fixed point rounding of the interior tiles */
+constexpr float interior_margin = 1.f / 256.f;
+
 inline uint8_t nearest_interpolation(const uint8_t *in_ptr, int x, int y, size_t stride)
 {
     return in_ptr[x + y * stride];
 }
+
+/** Convert a coordinate to Q16 fixed point */
+inline int32_t to_q16(double value)
+{
+    return static_cast<int32_t>(std::floor(value * 65536.0 + 0.5));
+}
+
+/** Compute a row of output pixels from their Q16 source coordinates
+ *
+ * @note All the coordinates must be within the valid region of the input: no border handling is done.
+ *
+ * @param[in]  in     Pointer to the first pixel of the input plane
+ * @param[in]  stride Stride of the input in bytes
+ * @param[in]  xq     Q16 X source coordinates
+ * @param[in]  yq     Q16 Y source coordinates
+ * @param[in]  n      Number of pixels to compute
+ * @param[out] out    Pointer to the first output pixel of the row
+ */
+template <InterpolationPolicy interpolation>
+inline void interpolate_row(const uint8_t *in, size_t stride, const int32_t *xq, const int32_t *yq, int n, uint8_t *out)
+{
+    int x = 0;
+
+    switch(interpolation)
+    {
+        case InterpolationPolicy::NEAREST_NEIGHBOR:
+            for(; x < n; ++x)
+            {
+                out[x] = in[(xq[x] >> 16) + (yq[x] >> 16) * stride];
+            }
+            break;
+        case InterpolationPolicy::BILINEAR:
+        {
+            const int32x4_t  in_stride = vdupq_n_s32(static_cast<int32_t>(stride));
+            const int32x4_t  frac_mask = vdupq_n_s32(0xFF);
+            const uint16x8_t one       = vdupq_n_u16(256);
+
+            // Blend 8 pixels at a time with Q8 weights: the horizontal pass fits in 16 bits
+            for(; x <= n - 8; x += 8)
+            {
+                int32_t    offsets[8];
+                uint16x4_t fx[2];
+                uint16x4_t fy[2];
+
+                for(int h = 0; h < 2; ++h)
+                {
+                    const int32x4_t x4 = vld1q_s32(xq + x + 4 * h);
+                    const int32x4_t y4 = vld1q_s32(yq + x + 4 * h);
+
+                    vst1q_s32(offsets + 4 * h, vmlaq_s32(vshrq_n_s32(x4, 16), vshrq_n_s32(y4, 16), in_stride));
+                    fx[h] = vmovn_u32(vreinterpretq_u32_s32(vandq_s32(vshrq_n_s32(x4, 8), frac_mask)));
+                    fy[h] = vmovn_u32(vreinterpretq_u32_s32(vandq_s32(vshrq_n_s32(y4, 8), frac_mask)));
+                }
+
+                uint8_t a00[8];
+                uint8_t a01[8];
+                uint8_t a10[8];
+                uint8_t a11[8];
+
+                for(int k = 0; k < 8; ++k)
+                {
+                    const uint8_t *ptr = in + offsets[k];
+                    a00[k]             = ptr[0];
+                    a01[k]             = ptr[1];
+                    a10[k]             = ptr[stride];
+                    a11[k]             = ptr[stride + 1];
+                }
+
+                const uint16x8_t wx1 = vcombine_u16(fx[0], fx[1]);
+                const uint16x8_t wy1 = vcombine_u16(fy[0], fy[1]);
+                const uint16x8_t wx0 = vsubq_u16(one, wx1);
+                const uint16x8_t wy0 = vsubq_u16(one, wy1);
+
+                const uint16x8_t top    = vmlaq_u16(vmulq_u16(vmovl_u8(vld1_u8(a00)), wx0), vmovl_u8(vld1_u8(a01)), wx1);
+                const uint16x8_t bottom = vmlaq_u16(vmulq_u16(vmovl_u8(vld1_u8(a10)), wx0), vmovl_u8(vld1_u8(a11)), wx1);
+
+                const uint32x4_t res_low  = vmlal_u16(vmull_u16(vget_low_u16(top), vget_low_u16(wy0)), vget_low_u16(bottom), vget_low_u16(wy1));
+                const uint32x4_t res_high = vmlal_u16(vmull_u16(vget_high_u16(top), vget_high_u16(wy0)), vget_high_u16(bottom), vget_high_u16(wy1));
+
+                vst1_u8(out + x, vmovn_u16(vcombine_u16(vshrn_n_u32(res_low, 16), vshrn_n_u32(res_high, 16))));
+            }
+
+            for(; x < n; ++x)
+            {
+                const uint8_t *ptr = in + (xq[x] >> 16) + (yq[x] >> 16) * stride;
+                const uint32_t wx1 = (xq[x] >> 8) & 0xFF;
+                const uint32_t wy1 = (yq[x] >> 8) & 0xFF;
+
+                const uint32_t top    = ptr[0] * (256 - wx1) + ptr[1] * wx1;
+                const uint32_t bottom = ptr[stride] * (256 - wx1) + ptr[stride + 1] * wx1;
+
+                out[x] = static_cast<uint8_t>((top * (256 - wy1) + bottom * wy1) >> 16);
+            }
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Interpolation not supported");
+    }
+}
 } // namespace
 
 INEWarpKernel::INEWarpKernel()
@@ -61,7 +170,43 @@ void INEWarpKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (this->*_func)(window);
+    // Walk the window in 2D tiles: the source footprint of a tile fits in the L1 cache, whereas a whole output row
+    // sweeps the source along an arbitrary line. The tiles read the same coordinates as the row-wise functions.
+    Window tile(window);
+
+    for(int y = window.y().start(); y < window.y().end(); y += tile_height)
+    {
+        tile.set(Window::DimY, Window::Dimension(y, std::min(y + tile_height, window.y().end()), window.y().step()));
+
+        for(int x = window.x().start(); x < window.x().end(); x += tile_width)
+        {
+            tile.set(Window::DimX, Window::Dimension(x, std::min(x + tile_width, window.x().end()), window.x().step()));
+
+            if(is_interior(tile))
+            {
+                warp_interior(tile);
+            }
+            else
+            {
+                (this->*_func)(tile);
+            }
+        }
+    }
+}
+
+bool INEWarpKernel::is_inside(float x, float y) const
+{
+    const ValidRegion &valid_region = _input->info()->valid_region();
+
+    const float min_x = valid_region.anchor[0] + interior_margin;
+    const float max_x = valid_region.anchor[0] + static_cast<int>(valid_region.shape[0]) - interior_margin;
+    const float min_y = valid_region.anchor[1] + interior_margin;
+    const float max_y = valid_region.anchor[1] + static_cast<int>(valid_region.shape[1]) - interior_margin;
+
+    // Q16 coordinates must fit in 32 bits
+    constexpr float max_q16 = 32767.f;
+
+    return (min_x <= x) && (x < std::min(max_x, max_q16)) && (min_y <= y) && (y < std::min(max_y, max_q16));
 }
 
 void INEWarpKernel::configure(const ITensor *input, ITensor *output, const float *matrix, BorderMode border_mode, uint8_t constant_border_value)
@@ -432,6 +577,85 @@ void NEWarpAffineKernel<interpolation>::warp_replicate(const Window &window)
     in, out);
 }
 
+template <InterpolationPolicy interpolation>
+bool NEWarpAffineKernel<interpolation>::is_interior(const Window &tile) const
+{
+    const float M00 = _matrix[0];
+    const float M10 = _matrix[1];
+    const float M01 = _matrix[0 + 1 * 2];
+    const float M11 = _matrix[1 + 1 * 2];
+    const float M02 = _matrix[0 + 2 * 2];
+    const float M12 = _matrix[1 + 2 * 2];
+
+    // The source of the tile is the parallelogram spanned by the source of its corners
+    for(const int y : { tile.y().start(), tile.y().end() - 1 })
+    {
+        for(const int x : { tile.x().start(), tile.x().end() - 1 })
+        {
+            if(!is_inside(M00 * x + M01 * y + M02, M10 * x + M11 * y + M12))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <InterpolationPolicy interpolation>
+void NEWarpAffineKernel<interpolation>::warp_interior(const Window &tile)
+{
+    // Only iterate over the planes: the rows of the tile are walked below
+    Window win_planes(tile);
+    win_planes.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win_planes.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator in(_input, win_planes);
+    Iterator out(_output, win_planes);
+
+    const size_t in_stride  = _input->info()->strides_in_bytes()[1];
+    const size_t out_stride = _output->info()->strides_in_bytes()[1];
+    const int    x_start    = tile.x().start();
+    const int    width      = tile.x().end() - x_start;
+
+    const float M00 = _matrix[0];
+    const float M10 = _matrix[1];
+    const float M01 = _matrix[0 + 1 * 2];
+    const float M11 = _matrix[1 + 1 * 2];
+    const float M02 = _matrix[0 + 2 * 2];
+    const float M12 = _matrix[1 + 2 * 2];
+
+    const int32_t   lane_index[4] = { 0, 1, 2, 3 };
+    const int32_t   dxq           = to_q16(M00);
+    const int32_t   dyq           = to_q16(M10);
+    const int32x4_t step_x        = vdupq_n_s32(4 * dxq);
+    const int32x4_t step_y        = vdupq_n_s32(4 * dyq);
+
+    int32_t xq[tile_width];
+    int32_t yq[tile_width];
+
+    execute_window_loop(win_planes, [&](const Coordinates &)
+    {
+        for(int y = tile.y().start(); y < tile.y().end(); ++y)
+        {
+            // Anchor every row on its exact coordinates and step along it in Q16 fixed point
+            int32x4_t vx = vmlaq_n_s32(vdupq_n_s32(to_q16(static_cast<double>(M00) * x_start + static_cast<double>(M01) * y + M02)), vld1q_s32(lane_index), dxq);
+            int32x4_t vy = vmlaq_n_s32(vdupq_n_s32(to_q16(static_cast<double>(M10) * x_start + static_cast<double>(M11) * y + M12)), vld1q_s32(lane_index), dyq);
+
+            for(int x = 0; x < width; x += 4)
+            {
+                vst1q_s32(xq + x, vx);
+                vst1q_s32(yq + x, vy);
+                vx = vaddq_s32(vx, step_x);
+                vy = vaddq_s32(vy, step_y);
+            }
+
+            interpolate_row<interpolation>(in.ptr(), in_stride, xq, yq, width, out.ptr() + x_start + y * out_stride);
+        }
+    },
+    in, out);
+}
+
 template <InterpolationPolicy interpolation>
 void NEWarpPerspectiveKernel<interpolation>::warp_undefined(const Window &window)
 {
@@ -799,6 +1023,101 @@ void NEWarpPerspectiveKernel<interpolation>::warp_replicate(const Window &window
     in, out);
 }
 
+template <InterpolationPolicy interpolation>
+bool NEWarpPerspectiveKernel<interpolation>::is_interior(const Window &tile) const
+{
+    const float M00 = _matrix[0];
+    const float M10 = _matrix[1];
+    const float M20 = _matrix[2];
+    const float M01 = _matrix[0 + 1 * 3];
+    const float M11 = _matrix[1 + 1 * 3];
+    const float M21 = _matrix[2 + 1 * 3];
+    const float M02 = _matrix[0 + 2 * 3];
+    const float M12 = _matrix[1 + 2 * 3];
+    const float M22 = _matrix[2 + 2 * 3];
+
+    // As long as z0 keeps the same sign over the tile, its source is the convex quadrilateral spanned by the source of its corners
+    for(const int y : { tile.y().start(), tile.y().end() - 1 })
+    {
+        for(const int x : { tile.x().start(), tile.x().end() - 1 })
+        {
+            const float z0 = M20 * x + M21 * y + M22;
+
+            if(z0 <= 0.f || !is_inside((M00 * x + M01 * y + M02) / z0, (M10 * x + M11 * y + M12) / z0))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <InterpolationPolicy interpolation>
+void NEWarpPerspectiveKernel<interpolation>::warp_interior(const Window &tile)
+{
+    // Only iterate over the planes: the rows of the tile are walked below
+    Window win_planes(tile);
+    win_planes.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win_planes.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator in(_input, win_planes);
+    Iterator out(_output, win_planes);
+
+    const size_t in_stride  = _input->info()->strides_in_bytes()[1];
+    const size_t out_stride = _output->info()->strides_in_bytes()[1];
+    const int    x_start    = tile.x().start();
+    const int    width      = tile.x().end() - x_start;
+
+    const float M00 = _matrix[0];
+    const float M10 = _matrix[1];
+    const float M20 = _matrix[2];
+    const float M01 = _matrix[0 + 1 * 3];
+    const float M11 = _matrix[1 + 1 * 3];
+    const float M21 = _matrix[2 + 1 * 3];
+    const float M02 = _matrix[0 + 2 * 3];
+    const float M12 = _matrix[1 + 2 * 3];
+    const float M22 = _matrix[2 + 2 * 3];
+
+    const float       lane_index[4] = { 0.f, 1.f, 2.f, 3.f };
+    const float32x4_t step_x        = vdupq_n_f32(4.f * M00);
+    const float32x4_t step_y        = vdupq_n_f32(4.f * M10);
+    const float32x4_t step_z        = vdupq_n_f32(4.f * M20);
+    const float32x4_t q16           = vdupq_n_f32(65536.f);
+
+    int32_t xq[tile_width];
+    int32_t yq[tile_width];
+
+    execute_window_loop(win_planes, [&](const Coordinates &)
+    {
+        for(int y = tile.y().start(); y < tile.y().end(); ++y)
+        {
+            float32x4_t x0 = vmlaq_n_f32(vdupq_n_f32(M00 * x_start + M01 * y + M02), vld1q_f32(lane_index), M00);
+            float32x4_t y0 = vmlaq_n_f32(vdupq_n_f32(M10 * x_start + M11 * y + M12), vld1q_f32(lane_index), M10);
+            float32x4_t z0 = vmlaq_n_f32(vdupq_n_f32(M20 * x_start + M21 * y + M22), vld1q_f32(lane_index), M20);
+
+            for(int x = 0; x < width; x += 4)
+            {
+                // 1 / z0 with two Newton-Raphson iterations
+                float32x4_t inv_z0 = vrecpeq_f32(z0);
+                inv_z0             = vmulq_f32(vrecpsq_f32(z0, inv_z0), inv_z0);
+                inv_z0             = vmulq_f32(vrecpsq_f32(z0, inv_z0), inv_z0);
+
+                // The coordinates are positive: the conversion to Q16 floors them
+                vst1q_s32(xq + x, vcvtq_s32_f32(vmulq_f32(vmulq_f32(x0, inv_z0), q16)));
+                vst1q_s32(yq + x, vcvtq_s32_f32(vmulq_f32(vmulq_f32(y0, inv_z0), q16)));
+
+                x0 = vaddq_f32(x0, step_x);
+                y0 = vaddq_f32(y0, step_y);
+                z0 = vaddq_f32(z0, step_z);
+            }
+
+            interpolate_row<interpolation>(in.ptr(), in_stride, xq, yq, width, out.ptr() + x_start + y * out_stride);
+        }
+    },
+    in, out);
+}
+
 template class arm_compute::NEWarpAffineKernel<InterpolationPolicy::NEAREST_NEIGHBOR>;
 template class arm_compute::NEWarpAffineKernel<InterpolationPolicy::BILINEAR>;
 template class arm_compute::NEWarpPerspectiveKernel<InterpolationPolicy::NEAREST_NEIGHBOR>;
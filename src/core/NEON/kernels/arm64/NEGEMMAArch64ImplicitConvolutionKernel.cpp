@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/arm64/NEGEMMAArch64ImplicitConvolutionKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "support/ToolchainSupport.h"
+
+namespace arm_compute
+{
+#include "arm_compute/core/NEON/kernels/assembly/gemm_interleaved.hpp"
+#include "arm_compute/core/NEON/kernels/assembly/kernels/a64_sgemm_12x8.hpp"
+} // namespace arm_compute
+
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+namespace arm_compute
+{
+NEGEMMAArch64ImplicitConvolutionKernel::NEGEMMAArch64ImplicitConvolutionKernel()
+    : _input(nullptr), _weights(nullptr), _output(nullptr), _workspace(nullptr), _kernel_dims(), _conv_info(), _conv_w(0), _has_bias(false), _num_groups(1)
+{
+}
+
+size_t NEGEMMAArch64ImplicitConvolutionKernel::get_workspace_size(const CPUInfo &ci, unsigned int M, unsigned int N, unsigned int K, unsigned int num_threads)
+{
+    GemmInterleaved<sgemm_12x8, float, float> gemm(&ci, M, N, K, false, false);
+    constexpr size_t alignment = 4096;
+    return (gemm.get_working_size() + alignment - 1) * num_threads;
+}
+
+void NEGEMMAArch64ImplicitConvolutionKernel::configure(const ITensor *input, const ITensor *weights, ITensor *output, ITensor *workspace, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                                       bool has_bias, unsigned int num_groups)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_ERROR_ON((input->info()->dimension(2) % num_groups) != 0);
+    ARM_COMPUTE_ERROR_ON((output->info()->dimension(0) % num_groups) != 0);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(1) != kernel_dims.width * kernel_dims.height * (input->info()->dimension(2) / num_groups) + (has_bias ? 1 : 0));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(0) != output->info()->dimension(0));
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), kernel_dims.width, kernel_dims.height, conv_info);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != conv_w * conv_h);
+
+    _input       = input;
+    _weights     = weights;
+    _output      = output;
+    _workspace   = workspace;
+    _kernel_dims = kernel_dims;
+    _conv_info   = conv_info;
+    _conv_w      = conv_w;
+    _has_bias    = has_bias;
+    _num_groups  = num_groups;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info());
+
+    AccessWindowRectangle output_access(output->info(), 0, 0, 12, 8);
+
+    const int weights_access_end = ceil_to_multiple(weights->info()->tensor_shape().x(), 12);
+
+    // The input is gathered with explicit bounds checks, so it does not need any padding
+    update_window_and_padding(win,
+                              AccessWindowStatic(weights->info(), 0, 0, weights_access_end, weights->info()->tensor_shape().y()),
+                              output_access);
+
+    INEKernel::configure(win);
+}
+
+void NEGEMMAArch64ImplicitConvolutionKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const ITensorInfo &in_info = *_input->info();
+
+    const int ldb = _weights->info()->strides_in_bytes().y() / sizeof(float);
+    const int ldc = _output->info()->strides_in_bytes().y() / sizeof(float);
+
+    const auto weights_ptr = reinterpret_cast<const float *>(_weights->buffer() + _weights->info()->offset_first_element_in_bytes());
+
+    const int M = std::min(_output->info()->tensor_shape().y(), static_cast<size_t>(window.y().end())) - window.y().start();
+    const int N = _output->info()->tensor_shape().x() / _num_groups;
+    const int K = _weights->info()->tensor_shape().y();
+
+    Im2ColParams<float> im2col{};
+    im2col.stride_x      = in_info.strides_in_bytes().x() / sizeof(float);
+    im2col.stride_y      = in_info.strides_in_bytes().y() / sizeof(float);
+    im2col.stride_z      = in_info.strides_in_bytes().z() / sizeof(float);
+    im2col.input_w       = in_info.dimension(0);
+    im2col.input_h       = in_info.dimension(1);
+    im2col.input_c       = in_info.dimension(2) / _num_groups;
+    im2col.kernel_w      = _kernel_dims.width;
+    im2col.kernel_h      = _kernel_dims.height;
+    im2col.conv_stride_x = _conv_info.stride().first;
+    im2col.conv_stride_y = _conv_info.stride().second;
+    im2col.pad_left      = _conv_info.pad_left();
+    im2col.pad_top       = _conv_info.pad_top();
+    im2col.conv_w        = _conv_w;
+    im2col.row_offset    = window.y().start();
+    im2col.has_bias      = _has_bias;
+
+    // Only iterate over batches
+    Window win(window);
+    win.set(0, Window::Dimension(0, 1, 1));
+    win.set(1, Window::Dimension(0, 1, 1));
+
+    Iterator out(_output, window);
+
+    GemmInterleaved<sgemm_12x8, float, float> gemm(&info.cpu_info, M, N, K, false, false);
+    constexpr size_t alignment      = 4096;
+    const size_t     offset         = (gemm.get_working_size() + alignment - 1) * info.thread_id;
+    void            *workspace      = _workspace->buffer() + offset;
+    size_t           workspace_size = _workspace->info()->total_size();
+
+    if(support::cpp11::align(alignment, gemm.get_working_size(), workspace, workspace_size) == nullptr)
+    {
+        ARM_COMPUTE_ERROR("Not enough space to align buffer!");
+    }
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        // The GEMM output keeps the batches in the fourth dimension, as does the input volume
+        const float *batch_ptr = reinterpret_cast<const float *>(_input->buffer() + in_info.offset_first_element_in_bytes() + id[3] * in_info.strides_in_bytes()[3]);
+        auto         out_ptr   = reinterpret_cast<float *>(out.ptr());
+
+        // All the groups are computed by the same thread, each one on its own slice of input channels and output columns
+        for(unsigned int g = 0; g < _num_groups; ++g)
+        {
+            im2col.input = batch_ptr + g * im2col.input_c * im2col.stride_z;
+
+            gemm.execute_im2col(im2col, weights_ptr + g * N, ldb,
+                                out_ptr + g * N, ldc,
+                                1.f, 0.f, workspace);
+        }
+    },
+    out);
+}
+} // namespace arm_compute
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/convolution/depthwise/impl_fp16_fp16.hpp"
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+namespace depthwise
+{
+using Conv = DepthwiseConvolution<2, 2, 3, 3, 1, 1, float16_t, float16_t>;
+using ConvImpl = DepthwiseConvolutionImpl<2, 2, 3, 3, 1, 1, float16_t, float16_t>;
+
+template <>
+const Conv::TileFn Conv::tile_fns
+  [max_in_pad_top]
+  [max_in_pad_left]
+  [max_in_pad_bottom]
+  [max_in_pad_right]
+  [max_out_pad_bottom]
+  [max_out_pad_right] = {
+  {  // Input pad top = 0
+    {  // Input pad left = 0
+      {  // Input pad bottom = 0
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 0, 0, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 0, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 0, 0, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 0, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 0, 1, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 0, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 0, 1, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 0, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 0, 2, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 0, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 0, 2, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 0, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 0
+      {  // Input pad bottom = 1
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 1, 0, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 1, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 1, 0, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 1, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 1, 1, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 1, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 1, 1, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 1, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 1, 2, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 1, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 1, 2, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 1, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 1
+      {  // Input pad bottom = 2
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 2, 0, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 2, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 2, 0, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 2, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 2, 1, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 2, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 2, 1, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 2, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 0, 2, 2, 0, 0>,
+            ConvImpl::template process_tile<0, 0, 2, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 0, 2, 2, 1, 0>,
+            ConvImpl::template process_tile<0, 0, 2, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 2
+    },  // Input pad left = 0
+    {  // Input pad left = 1
+      {  // Input pad bottom = 0
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 0, 0, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 0, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 0, 0, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 0, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 0, 1, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 0, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 0, 1, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 0, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 0, 2, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 0, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 0, 2, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 0, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 0
+      {  // Input pad bottom = 1
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 1, 0, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 1, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 1, 0, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 1, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 1, 1, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 1, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 1, 1, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 1, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 1, 2, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 1, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 1, 2, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 1, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 1
+      {  // Input pad bottom = 2
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 2, 0, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 2, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 2, 0, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 2, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 2, 1, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 2, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 2, 1, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 2, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<0, 1, 2, 2, 0, 0>,
+            ConvImpl::template process_tile<0, 1, 2, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<0, 1, 2, 2, 1, 0>,
+            ConvImpl::template process_tile<0, 1, 2, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 2
+    },  // Input pad left = 1
+  },  // Input pad top = 0
+  {  // Input pad top = 1
+    {  // Input pad left = 0
+      {  // Input pad bottom = 0
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 0, 0, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 0, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 0, 0, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 0, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 0, 1, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 0, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 0, 1, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 0, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 0, 2, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 0, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 0, 2, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 0, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 0
+      {  // Input pad bottom = 1
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 1, 0, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 1, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 1, 0, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 1, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 1, 1, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 1, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 1, 1, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 1, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 1, 2, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 1, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 1, 2, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 1, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 1
+      {  // Input pad bottom = 2
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 2, 0, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 2, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 2, 0, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 2, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 2, 1, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 2, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 2, 1, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 2, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 0, 2, 2, 0, 0>,
+            ConvImpl::template process_tile<1, 0, 2, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 0, 2, 2, 1, 0>,
+            ConvImpl::template process_tile<1, 0, 2, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 2
+    },  // Input pad left = 0
+    {  // Input pad left = 1
+      {  // Input pad bottom = 0
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 0, 0, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 0, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 0, 0, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 0, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 0, 1, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 0, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 0, 1, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 0, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 0, 2, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 0, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 0, 2, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 0, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 0
+      {  // Input pad bottom = 1
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 1, 0, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 1, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 1, 0, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 1, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 1, 1, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 1, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 1, 1, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 1, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 1, 2, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 1, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 1, 2, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 1, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 1
+      {  // Input pad bottom = 2
+        {  // Input pad right = 0
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 2, 0, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 2, 0, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 2, 0, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 2, 0, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 0
+        {  // Input pad right = 1
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 2, 1, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 2, 1, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 2, 1, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 2, 1, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 1
+        {  // Input pad right = 2
+          {  // Output pad bottom = 0
+            ConvImpl::template process_tile<1, 1, 2, 2, 0, 0>,
+            ConvImpl::template process_tile<1, 1, 2, 2, 0, 1>,
+          },  // Output pad bottom = 0
+          {  // Output pad bottom = 1
+            ConvImpl::template process_tile<1, 1, 2, 2, 1, 0>,
+            ConvImpl::template process_tile<1, 1, 2, 2, 1, 1>,
+          },  // Output pad bottom = 1
+        },  // Input pad right = 2
+      },  // Input pad bottom = 2
+    },  // Input pad left = 1
+  },  // Input pad top = 1
+};
+
+
+template class DepthwiseConvolution<2, 2, 3, 3, 1, 1, float16_t, float16_t>;
+}  // namespace depthwise
+#endif  // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -220,6 +220,33 @@ size_t TensorInfo::init_auto_padding(const HOGInfo &hog_info, unsigned int width
     return init_auto_padding(TensorShape(num_blocks_per_img.width, num_blocks_per_img.height), num_channels, DataType::F32);
 }
 
+void TensorInfo::init_with_row_stride(const TensorShape &tensor_shape, Format format, size_t row_stride_in_bytes)
+{
+    const size_t   num_channels = num_channels_from_format(format);
+    const DataType type         = data_type_from_format(format);
+
+    init_with_row_stride(tensor_shape, num_channels, type, row_stride_in_bytes);
+
+    _format = format;
+}
+
+void TensorInfo::init_with_row_stride(const TensorShape &tensor_shape, size_t num_channels, DataType data_type, size_t row_stride_in_bytes, int fixed_point_position)
+{
+    init(tensor_shape, num_channels, data_type, fixed_point_position);
+
+    const size_t row_size = _tensor_shape[0] * element_size();
+
+    ARM_COMPUTE_ERROR_ON(row_stride_in_bytes < row_size);
+
+    // Expose the whole elements between the end of a row and the beginning of the next one as right padding
+    _padding = PaddingSize(0, (row_stride_in_bytes - row_size) / element_size(), 0, 0);
+
+    // The row stride itself does not have to be a multiple of the element size
+    _strides_in_bytes              = compute_strides(*this, element_size(), row_stride_in_bytes);
+    _offset_first_element_in_bytes = 0;
+    _total_size                    = _tensor_shape.total_size_upper(1) * row_stride_in_bytes;
+}
+
 bool TensorInfo::auto_padding()
 {
     ARM_COMPUTE_ERROR_ON(!_is_resizable);
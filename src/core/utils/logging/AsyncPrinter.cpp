@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/utils/logging/AsyncPrinter.h"
+
+#include "arm_compute/core/Error.h"
+#include "support/ToolchainSupport.h"
+
+#include <chrono>
+#include <cstring>
+
+using namespace arm_compute::logging;
+
+#ifndef NO_MULTI_THREADING
+namespace
+{
+/** Maximum time the background thread sleeps before checking the buffer again, bounds the latency of a missed wake up */
+constexpr std::chrono::milliseconds max_sleep_time(50);
+
+size_t next_power_of_two(size_t value)
+{
+    size_t power = 1;
+    while(power < value)
+    {
+        power <<= 1;
+    }
+    return power;
+}
+} // namespace
+
+AsyncPrinter::AsyncPrinter(std::shared_ptr<Printer> printer, size_t capacity, size_t record_size)
+    : _printer(std::move(printer)), _dropped(0), _truncated(0), _capacity(next_power_of_two(capacity)), _record_size(record_size), _sequences(), _lengths(), _records(), _enqueue_pos(0),
+      _dequeue_pos(0), _printed_pos(0), _idle(false), _stop(false), _mtx(), _work_cv(), _flush_cv(), _thread()
+{
+    ARM_COMPUTE_ERROR_ON(_printer == nullptr);
+    ARM_COMPUTE_ERROR_ON(capacity == 0);
+    ARM_COMPUTE_ERROR_ON(record_size == 0);
+
+    _sequences = support::cpp14::make_unique<std::atomic<size_t>[]>(_capacity);
+    _lengths   = support::cpp14::make_unique<size_t[]>(_capacity);
+    _records   = support::cpp14::make_unique<char[]>(_capacity * _record_size);
+
+    // A slot is free for the producer at position pos when its sequence is pos,
+    // and ready for the consumer when its sequence is pos + 1
+    for(size_t i = 0; i < _capacity; ++i)
+    {
+        _sequences[i].store(i, std::memory_order_relaxed);
+    }
+
+    _thread = std::thread(&AsyncPrinter::worker_thread, this);
+}
+
+AsyncPrinter::~AsyncPrinter()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _work_cv.notify_one();
+    _thread.join();
+}
+
+void AsyncPrinter::print(const std::string &msg)
+{
+    // Reserve a slot
+    size_t pos  = _enqueue_pos.load(std::memory_order_relaxed);
+    size_t slot = 0;
+    while(true)
+    {
+        slot                      = pos & (_capacity - 1);
+        const size_t         seq  = _sequences[slot].load(std::memory_order_acquire);
+        const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - pos);
+
+        if(diff == 0)
+        {
+            if(_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {
+            // The buffer is full: drop the message rather than blocking the caller
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            // Another producer reserved the slot first
+            pos = _enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    size_t length = msg.size();
+    if(length > _record_size)
+    {
+        length = _record_size;
+        _truncated.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::memcpy(_records.get() + slot * _record_size, msg.data(), length);
+    _lengths[slot] = length;
+
+    // Publish the record
+    _sequences[slot].store(pos + 1, std::memory_order_release);
+
+    // Wake up the background thread if it's sleeping.
+    // The notification is sent without holding the mutex, if it's missed the background thread wakes up after max_sleep_time anyway.
+    if(_idle.load(std::memory_order_relaxed) && _idle.exchange(false))
+    {
+        _work_cv.notify_one();
+    }
+}
+
+void AsyncPrinter::flush()
+{
+    const size_t target = _enqueue_pos.load(std::memory_order_acquire);
+
+    std::unique_lock<std::mutex> lock(_mtx);
+    _idle.store(false);
+    _work_cv.notify_one();
+    _flush_cv.wait(lock, [&] { return _printed_pos.load(std::memory_order_acquire) >= target; });
+}
+
+bool AsyncPrinter::pop(std::string &msg)
+{
+    const size_t pos  = _dequeue_pos.load(std::memory_order_relaxed);
+    const size_t slot = pos & (_capacity - 1);
+
+    if(_sequences[slot].load(std::memory_order_acquire) != pos + 1)
+    {
+        return false;
+    }
+
+    msg.assign(_records.get() + slot * _record_size, _lengths[slot]);
+
+    // Release the slot for the producer which will write at pos + capacity
+    _sequences[slot].store(pos + _capacity, std::memory_order_release);
+    _dequeue_pos.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+void AsyncPrinter::worker_thread()
+{
+    std::string msg;
+    uint64_t    reported_drops = 0;
+
+    while(true)
+    {
+        bool stop = false;
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            stop = _stop;
+        }
+
+        while(pop(msg))
+        {
+            print_internal(msg);
+        }
+
+        const uint64_t drops = _dropped.load(std::memory_order_relaxed);
+        if(drops != reported_drops)
+        {
+            print_internal("[AsyncPrinter] " + support::cpp11::to_string(drops - reported_drops) + " message(s) dropped");
+            reported_drops = drops;
+        }
+
+        {
+            // Update under the mutex so a thread in flush() can't miss the notification.
+            // _dequeue_pos can't be used by flush() as it is incremented before the message is printed.
+            std::lock_guard<std::mutex> lock(_mtx);
+            _printed_pos.store(_dequeue_pos.load(std::memory_order_relaxed), std::memory_order_release);
+        }
+        _flush_cv.notify_all();
+
+        // Everything queued before the destructor was called has been printed
+        if(stop)
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(_mtx);
+        _idle.store(true);
+        const size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        if(_sequences[pos & (_capacity - 1)].load(std::memory_order_acquire) != pos + 1)
+        {
+            _work_cv.wait_for(lock, max_sleep_time, [&] { return !_idle.load() || _stop; });
+        }
+        _idle.store(false);
+    }
+}
+#else  /* NO_MULTI_THREADING */
+AsyncPrinter::AsyncPrinter(std::shared_ptr<Printer> printer, size_t capacity, size_t record_size)
+    : _printer(std::move(printer)), _dropped(0), _truncated(0)
+{
+    ARM_COMPUTE_UNUSED(capacity);
+    ARM_COMPUTE_UNUSED(record_size);
+    ARM_COMPUTE_ERROR_ON(_printer == nullptr);
+}
+
+AsyncPrinter::~AsyncPrinter() = default;
+
+void AsyncPrinter::print(const std::string &msg)
+{
+    print_internal(msg);
+}
+
+void AsyncPrinter::flush()
+{
+}
+#endif /* NO_MULTI_THREADING */
+
+uint64_t AsyncPrinter::dropped() const
+{
+    return _dropped.load(std::memory_order_relaxed);
+}
+
+uint64_t AsyncPrinter::truncated() const
+{
+    return _truncated.load(std::memory_order_relaxed);
+}
+
+void AsyncPrinter::print_internal(const std::string &msg)
+{
+    try
+    {
+        _printer->print(msg);
+    }
+    catch(...)
+    {
+        // The background thread has no one to report the error to: the message is lost
+    }
+}
@@ -25,6 +25,7 @@
 
 #include "arm_compute/graph/CL/CLMap.h"
 #include "arm_compute/graph/CL/CLUnmap.h"
+#include "arm_compute/graph/GraphProfiler.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/ITensorObject.h"
 #include "arm_compute/graph/Tensor.h"
@@ -45,6 +46,23 @@ bool file_exists(const std::string &filename)
     return file.good();
 }
 
+/** Waits for the OpenCL commands enqueued by a profiled stage to complete */
+void sync_cl()
+{
+    arm_compute::CLScheduler::get().sync();
+}
+
+/** Size in bytes of the input and output tensors of a stage (Counted once if the stage runs in-place) */
+size_t stage_bytes(const ITensorObject *input, const ITensorObject *output)
+{
+    size_t bytes = input->tensor()->info()->total_size();
+    if(output != input)
+    {
+        bytes += output->tensor()->info()->total_size();
+    }
+    return bytes;
+}
+
 } // namespace
 struct Stage
 {
@@ -61,6 +79,14 @@ public:
      * @param _next_hint Device execution hint
      */
     void configure(GraphHints _next_hints);
+    /** Appends a stage to the pipeline and registers it to the profiler
+     *
+     * @param[in] input    Input tensor of the stage
+     * @param[in] output   Output tensor of the stage
+     * @param[in] function Function to run
+     * @param[in] name     Name of the stage
+     */
+    void add_stage(ITensorObject *input, ITensorObject *output, std::unique_ptr<arm_compute::IFunction> function, const char *name);
 
     GraphContext                                _ctx{};
     std::vector<Stage>                          _pipeline{};
@@ -74,6 +100,8 @@ public:
     ITensorObject                              *_current_output{ nullptr };
     bool                                        _info_enabled{ false };
     CLTuner                                     _tuner{};
+    GraphProfiler                               _profiler{};
+    bool                                        _profiling_enabled{ false };
 
 private:
     ITensorObject *_current_input{ nullptr };
@@ -117,9 +145,24 @@ void Graph::run()
             return;
         }
 
-        for(auto &stage : _pimpl->_pipeline)
+        if(_pimpl->_profiling_enabled)
         {
-            stage._function->run();
+            // Make sure the OpenCL stages are complete before stopping their timer
+            void (*sync)() = opencl_is_available() ? &sync_cl : nullptr;
+
+            _pimpl->_profiler.start();
+            for(unsigned int i = 0; i < _pimpl->_pipeline.size(); ++i)
+            {
+                _pimpl->_profiler.run_stage(i, *_pimpl->_pipeline[i]._function, sync);
+            }
+            _pimpl->_profiler.stop();
+        }
+        else
+        {
+            for(auto &stage : _pimpl->_pipeline)
+            {
+                stage._function->run();
+            }
         }
 
         if((_pimpl->_graph_output->has_accessor() && !_pimpl->_graph_output->call_accessor())
@@ -183,16 +226,16 @@ void Graph::Private::configure(GraphHints _next_hints)
         if(_previous_hints.target_hint() == TargetHint::NEON)
         {
             ARM_COMPUTE_ERROR_ON(_current_hints.target_hint() == TargetHint::NEON);
-            _pipeline.push_back({ _current_input, _current_input, arm_compute::support::cpp14::make_unique<CLUnmap>(_current_input) });
+            add_stage(_current_input, _current_input, arm_compute::support::cpp14::make_unique<CLUnmap>(_current_input), "CLUnmap");
         }
         if(_current_hints.target_hint() == TargetHint::NEON)
         {
             ARM_COMPUTE_ERROR_ON(_previous_hints.target_hint() == TargetHint::NEON);
-            _pipeline.push_back({ _current_input, _current_input, arm_compute::support::cpp14::make_unique<CLMap>(_current_input, true) });
+            add_stage(_current_input, _current_input, arm_compute::support::cpp14::make_unique<CLMap>(_current_input, true), "CLMap");
         }
     }
 
-    _pipeline.push_back({ _current_input, _current_output, std::move(func) });
+    add_stage(_current_input, _current_output, std::move(func), _current_node->name());
 
     _current_input  = _current_output;
     _current_output = nullptr;
@@ -200,6 +243,12 @@ void Graph::Private::configure(GraphHints _next_hints)
     std::swap(_current_hints, _next_hints);
 }
 
+void Graph::Private::add_stage(ITensorObject *input, ITensorObject *output, std::unique_ptr<arm_compute::IFunction> function, const char *name)
+{
+    _pipeline.push_back({ input, output, std::move(function) });
+    _profiler.add_stage(name, stage_bytes(input, output));
+}
+
 void Graph::add_node(std::unique_ptr<INode> node)
 {
     ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_graph_input == nullptr, "The graph's input must be set before the first node is added");
@@ -283,6 +332,16 @@ GraphHints &Graph::hints()
     return _pimpl->_next_hints;
 }
 
+void Graph::set_profiling_enabled(bool enabled)
+{
+    _pimpl->_profiling_enabled = enabled;
+}
+
+GraphProfiler &Graph::profiler()
+{
+    return _pimpl->_profiler;
+}
+
 Graph &arm_compute::graph::operator<<(Graph &graph, TensorInfo &&info)
 {
     graph.set_temp(std::move(info));
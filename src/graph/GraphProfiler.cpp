@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphProfiler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+using namespace arm_compute;
+using namespace arm_compute::graph;
+
+namespace
+{
+/** Kernel forwarding all the calls to another kernel and timing the workloads executed by each thread */
+class ProfiledKernel final : public ICPPKernel
+{
+public:
+    ProfiledKernel(ICPPKernel &kernel, const GraphProfiler &profiler, GraphProfiler::KernelMeasurement &measurement)
+        : _kernel(kernel), _profiler(profiler), _measurement(measurement)
+    {
+        IKernel::configure(kernel.window());
+    }
+
+    const char *name() const override
+    {
+        return _kernel.name();
+    }
+
+    bool is_parallelisable() const override
+    {
+        return _kernel.is_parallelisable();
+    }
+
+    BorderSize border_size() const override
+    {
+        return _kernel.border_size();
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        const GraphProfiler::Clock::time_point start = GraphProfiler::Clock::now();
+        _kernel.run(window, info);
+        const GraphProfiler::Clock::time_point end = GraphProfiler::Clock::now();
+
+        // Each thread only ever writes to its own entry
+        ARM_COMPUTE_ERROR_ON(static_cast<size_t>(info.thread_id) >= _measurement.threads.size());
+        GraphProfiler::ThreadMeasurement &thread = _measurement.threads[info.thread_id];
+        if(thread.start_us < 0.0)
+        {
+            thread.start_us = _profiler.to_us(start);
+        }
+        thread.duration_us += std::chrono::duration<double, std::micro>(end - start).count();
+    }
+
+private:
+    ICPPKernel                       &_kernel;
+    const GraphProfiler              &_profiler;
+    GraphProfiler::KernelMeasurement &_measurement;
+};
+
+/** Scheduler forwarding the kernels to the real scheduler and recording their execution in the profiler */
+class Interceptor final : public IScheduler
+{
+public:
+    Interceptor(GraphProfiler &profiler, IScheduler &real_scheduler)
+        : _profiler(profiler), _real_scheduler(real_scheduler)
+    {
+    }
+
+    void set_num_threads(unsigned int num_threads) override
+    {
+        _real_scheduler.set_num_threads(num_threads);
+    }
+
+    unsigned int num_threads() const override
+    {
+        return _real_scheduler.num_threads();
+    }
+
+    void schedule(ICPPKernel *kernel, unsigned int split_dimension) override
+    {
+        ARM_COMPUTE_ERROR_ON(kernel == nullptr);
+
+        GraphProfiler::KernelMeasurement measurement;
+        measurement.name = kernel->name();
+        measurement.threads.resize(std::max(1u, _real_scheduler.num_threads()));
+
+        ProfiledKernel profiled_kernel(*kernel, _profiler, measurement);
+
+        const GraphProfiler::Clock::time_point start = GraphProfiler::Clock::now();
+        _real_scheduler.schedule(&profiled_kernel, split_dimension);
+        const GraphProfiler::Clock::time_point end = GraphProfiler::Clock::now();
+
+        measurement.start_us    = _profiler.to_us(start);
+        measurement.duration_us = std::chrono::duration<double, std::micro>(end - start).count();
+        _profiler.add_kernel(std::move(measurement));
+    }
+
+    void set_counters_enabled(bool enable) override
+    {
+        _real_scheduler.set_counters_enabled(enable);
+    }
+
+    bool counters_enabled() const override
+    {
+        return _real_scheduler.counters_enabled();
+    }
+
+    SchedulerCounters counters() const override
+    {
+        return _real_scheduler.counters();
+    }
+
+    void reset_counters() override
+    {
+        _real_scheduler.reset_counters();
+    }
+
+private:
+    GraphProfiler &_profiler;
+    IScheduler    &_real_scheduler;
+};
+
+/** Time the threads spent running a kernel and time the caller spent waiting for the busiest thread to be dispatched and joined */
+struct KernelStats
+{
+    double busy_us{ 0.0 };
+    double capacity_us{ 0.0 };
+    double wait_us{ 0.0 };
+};
+
+KernelStats kernel_stats(const GraphProfiler::KernelMeasurement &kernel)
+{
+    KernelStats stats;
+    double      max_busy_us = 0.0;
+    for(const auto &thread : kernel.threads)
+    {
+        stats.busy_us += thread.duration_us;
+        max_busy_us = std::max(max_busy_us, thread.duration_us);
+    }
+    stats.capacity_us = kernel.duration_us * kernel.threads.size();
+    stats.wait_us     = std::max(0.0, kernel.duration_us - max_busy_us);
+    return stats;
+}
+
+std::string json_escape(const std::string &str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for(const char c : str)
+    {
+        if(c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+void write_event(std::ostream &os, bool &first, const std::string &name, const char *category, int tid, double ts, double dur, const std::string &args)
+{
+    os << (first ? "\n" : ",\n");
+    os << R"(  {"name":")" << json_escape(name) << R"(","cat":")" << category << R"(","ph":"X","pid":0,"tid":)" << tid
+       << R"(,"ts":)" << ts << R"(,"dur":)" << dur << R"(,"args":{)" << args << "}}";
+    first = false;
+}
+} // namespace
+
+GraphProfiler::GraphProfiler()
+    : _stages(), _measurements(), _current(nullptr), _origin(Clock::now()), _interceptor(nullptr), _real_scheduler(nullptr), _real_scheduler_type()
+{
+}
+
+GraphProfiler::~GraphProfiler()
+{
+    if(_real_scheduler != nullptr)
+    {
+        stop();
+    }
+}
+
+unsigned int GraphProfiler::add_stage(std::string name, size_t bytes)
+{
+    StageInfo info;
+    info.name  = std::move(name);
+    info.bytes = bytes;
+    _stages.push_back(std::move(info));
+    return _stages.size() - 1;
+}
+
+void GraphProfiler::start()
+{
+    ARM_COMPUTE_ERROR_ON(_real_scheduler != nullptr);
+    _real_scheduler_type = Scheduler::get_type();
+    //Note: We can't currently replace a custom scheduler
+    if(_real_scheduler_type != Scheduler::Type::CUSTOM)
+    {
+        _real_scheduler = &Scheduler::get();
+        _interceptor    = std::make_shared<Interceptor>(*this, *_real_scheduler);
+        Scheduler::set(_interceptor);
+    }
+}
+
+void GraphProfiler::stop()
+{
+    // Restore real scheduler
+    if(_real_scheduler != nullptr)
+    {
+        Scheduler::set(_real_scheduler_type);
+        _real_scheduler = nullptr;
+        _interceptor    = nullptr;
+    }
+}
+
+void GraphProfiler::run_stage(unsigned int stage, IFunction &function, void (*sync)())
+{
+    ARM_COMPUTE_ERROR_ON(stage >= _stages.size());
+
+    StageMeasurement measurement;
+    measurement.stage = stage;
+    _measurements.push_back(std::move(measurement));
+    _current = &_measurements.back();
+
+    const Clock::time_point start = Clock::now();
+    function.run();
+    if(sync != nullptr)
+    {
+        sync();
+    }
+    const Clock::time_point end = Clock::now();
+
+    _current->start_us    = to_us(start);
+    _current->duration_us = std::chrono::duration<double, std::micro>(end - start).count();
+    _current              = nullptr;
+}
+
+void GraphProfiler::clear()
+{
+    _measurements.clear();
+    _origin = Clock::now();
+}
+
+const std::vector<GraphProfiler::StageInfo> &GraphProfiler::stages() const
+{
+    return _stages;
+}
+
+const std::vector<GraphProfiler::StageMeasurement> &GraphProfiler::measurements() const
+{
+    return _measurements;
+}
+
+void GraphProfiler::add_kernel(KernelMeasurement &&kernel)
+{
+    // Kernels scheduled outside of a stage (e.g. by an accessor) are not attributed to any layer
+    if(_current != nullptr)
+    {
+        _current->kernels.push_back(std::move(kernel));
+    }
+}
+
+double GraphProfiler::to_us(Clock::time_point time) const
+{
+    return std::chrono::duration<double, std::micro>(time - _origin).count();
+}
+
+void GraphProfiler::print_summary(std::ostream &os) const
+{
+    struct Summary
+    {
+        unsigned int runs{ 0 };
+        size_t       kernels{ 0 };
+        double       total_us{ 0.0 };
+        KernelStats  stats{};
+    };
+    std::vector<Summary> summaries(_stages.size());
+    double               total_us = 0.0;
+
+    for(const auto &measurement : _measurements)
+    {
+        Summary &summary = summaries[measurement.stage];
+        summary.runs++;
+        summary.kernels += measurement.kernels.size();
+        summary.total_us += measurement.duration_us;
+        total_us += measurement.duration_us;
+        for(const auto &kernel : measurement.kernels)
+        {
+            const KernelStats stats = kernel_stats(kernel);
+            summary.stats.busy_us += stats.busy_us;
+            summary.stats.capacity_us += stats.capacity_us;
+            summary.stats.wait_us += stats.wait_us;
+        }
+    }
+
+    const std::ios::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(3);
+    os << std::left << std::setw(6) << "Stage" << std::setw(28) << "Layer" << std::right
+       << std::setw(6) << "Runs" << std::setw(12) << "Avg (ms)" << std::setw(10) << "Time (%)" << std::setw(9) << "Kernels"
+       << std::setw(10) << "Util (%)" << std::setw(12) << "Wait (ms)" << std::setw(12) << "Size (MB)" << std::setw(10) << "GB/s" << "\n";
+
+    for(size_t i = 0; i < _stages.size(); ++i)
+    {
+        const Summary &summary = summaries[i];
+        if(summary.runs == 0)
+        {
+            continue;
+        }
+        const double avg_us      = summary.total_us / summary.runs;
+        const double share       = total_us > 0.0 ? 100.0 * summary.total_us / total_us : 0.0;
+        const double utilisation = summary.stats.capacity_us > 0.0 ? 100.0 * summary.stats.busy_us / summary.stats.capacity_us : 0.0;
+        const double bandwidth   = avg_us > 0.0 ? _stages[i].bytes / (avg_us * 1000.0) : 0.0;
+
+        os << std::left << std::setw(6) << i << std::setw(28) << _stages[i].name << std::right
+           << std::setw(6) << summary.runs << std::setw(12) << avg_us / 1000.0 << std::setw(10) << share
+           << std::setw(9) << summary.kernels / summary.runs << std::setw(10) << utilisation
+           << std::setw(12) << summary.stats.wait_us / summary.runs / 1000.0
+           << std::setw(12) << _stages[i].bytes / (1024.0 * 1024.0) << std::setw(10) << bandwidth << "\n";
+    }
+    os << "Total: " << total_us / 1000.0 << " ms\n";
+    os.flags(flags);
+}
+
+void GraphProfiler::export_chrome_trace(std::ostream &os) const
+{
+    const std::ios::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(3);
+    os << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+    bool   first       = true;
+    size_t max_threads = 0;
+    for(const auto &measurement : _measurements)
+    {
+        const StageInfo &info = _stages[measurement.stage];
+        const std::string stage_args = R"("stage":)" + support::cpp11::to_string(measurement.stage) + R"(,"bytes":)" + support::cpp11::to_string(info.bytes);
+        write_event(os, first, info.name, "stage", 0, measurement.start_us, measurement.duration_us, stage_args);
+
+        for(const auto &kernel : measurement.kernels)
+        {
+            const KernelStats stats       = kernel_stats(kernel);
+            const double      utilisation = stats.capacity_us > 0.0 ? stats.busy_us / stats.capacity_us : 0.0;
+            const std::string kernel_args = stage_args + R"(,"layer":")" + json_escape(info.name) + R"(","utilisation":)" + support::cpp11::to_string(utilisation)
+                                            + R"(,"wait_us":)" + support::cpp11::to_string(stats.wait_us);
+            write_event(os, first, kernel.name, "kernel", 0, kernel.start_us, kernel.duration_us, kernel_args);
+
+            for(size_t t = 0; t < kernel.threads.size(); ++t)
+            {
+                if(kernel.threads[t].start_us >= 0.0)
+                {
+                    write_event(os, first, kernel.name, "workload", t + 1, kernel.threads[t].start_us, kernel.threads[t].duration_us, R"("thread":)" + support::cpp11::to_string(t));
+                }
+            }
+            max_threads = std::max(max_threads, kernel.threads.size());
+        }
+    }
+
+    // Name the tracks
+    os << (first ? "\n" : ",\n") << R"(  {"name":"thread_name","ph":"M","pid":0,"tid":0,"args":{"name":"Graph"}})";
+    for(size_t t = 0; t < max_threads; ++t)
+    {
+        os << ",\n" << R"(  {"name":"thread_name","ph":"M","pid":0,"tid":)" << t + 1 << R"(,"args":{"name":"Thread )" << t << R"("}})";
+    }
+    os << "\n]}\n";
+    os.flags(flags);
+}
+
+void GraphProfiler::save_chrome_trace(const std::string &filename) const
+{
+    std::ofstream file(filename);
+    if(!file.good())
+    {
+        ARM_COMPUTE_ERROR("Failed to create %s", filename.c_str());
+    }
+    export_chrome_trace(file);
+}
@@ -147,6 +147,12 @@ void Tensor::allocate()
 
 void Tensor::allocate_and_fill_if_needed()
 {
+    // Let the accessor provide the backing memory if it can
+    if(_accessor != nullptr && _accessor->import_tensor(*_tensor))
+    {
+        return;
+    }
+
     allocate();
     if(_accessor != nullptr)
     {
@@ -29,6 +29,7 @@
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGroupedConvolutionLayer.h"
 #include "support/ToolchainSupport.h"
 #include "utils/GraphTypePrinter.h"
 #include "utils/TypePrinter.h"
@@ -286,6 +287,15 @@ std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_grouped_co
     ARM_COMPUTE_ERROR_ON_MSG((weights_shape[3] % _num_groups) != 0, "Number of kernels not multiple of the number of groups!");
     ARM_COMPUTE_ERROR_ON_MSG((biases_shape.x() % _num_groups) != 0, "Biases not multiple of the number of groups!");
 
+    // NEON computes all the groups in a single function, sharing the weights reshape
+    if(_target_hint == TargetHint::NEON)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Instantiating NEGroupedConvolutionLayer");
+        auto conv = arm_compute::support::cpp14::make_unique<arm_compute::NEGroupedConvolutionLayer>();
+        conv->configure(input, _weights.tensor(), _biases.tensor(), output, _conv_info, _num_groups);
+        return std::move(conv);
+    }
+
     // Create a grouped convolution function
     auto grouped_conv = arm_compute::support::cpp14::make_unique<GroupedConvolutionFunction>();
 
@@ -53,8 +53,13 @@ public:
     /** Request the worker thread to start executing the given kernel
      * This function will return as soon as the kernel has been sent to the worker thread.
      * wait() needs to be called to ensure the execution is complete.
+     *
+     * @param[in] kernel   Kernel to run, nullptr to make the thread exit.
+     * @param[in] window   Window to run the kernel on.
+     * @param[in] info     Information about the thread.
+     * @param[in] counters (Optional) Counters to record the wake-up latency and busy time into, nullptr to not record anything.
      */
-    void start(ICPPKernel *kernel, const Window &window, const ThreadInfo &info);
+    void start(ICPPKernel *kernel, const Window &window, const ThreadInfo &info, SchedulerCounterStorage *counters = nullptr);
 
     /** Wait for the current kernel execution to complete. */
     void wait();
@@ -63,15 +68,17 @@ public:
     void worker_thread();
 
 private:
-    std::thread             _thread;
-    ICPPKernel             *_kernel{ nullptr };
-    Window                  _window;
-    ThreadInfo              _info;
-    std::mutex              _m;
-    std::condition_variable _cv;
-    bool                    _wait_for_work{ false };
-    bool                    _job_complete{ true };
-    std::exception_ptr      _current_exception;
+    std::thread                                _thread;
+    ICPPKernel                                *_kernel{ nullptr };
+    Window                                     _window;
+    ThreadInfo                                 _info;
+    SchedulerCounterStorage                   *_counters{ nullptr };
+    SchedulerCounterStorage::clock::time_point _start_time{};
+    std::mutex                                 _m;
+    std::condition_variable                    _cv;
+    bool                                       _wait_for_work{ false };
+    bool                                       _job_complete{ true };
+    std::exception_ptr                         _current_exception;
 };
 
 Thread::Thread()
@@ -90,11 +97,17 @@ Thread::~Thread()
     }
 }
 
-void Thread::start(ICPPKernel *kernel, const Window &window, const ThreadInfo &info)
+void Thread::start(ICPPKernel *kernel, const Window &window, const ThreadInfo &info, SchedulerCounterStorage *counters)
 {
-    _kernel = kernel;
-    _window = window;
-    _info   = info;
+    _kernel   = kernel;
+    _window   = window;
+    _info     = info;
+    _counters = counters;
+
+    if(_counters != nullptr)
+    {
+        _start_time = SchedulerCounterStorage::clock::now();
+    }
 
     {
         std::lock_guard<std::mutex> lock(_m);
@@ -133,6 +146,13 @@ void Thread::worker_thread()
             return;
         }
 
+        SchedulerCounterStorage::clock::time_point run_start{};
+        if(_counters != nullptr)
+        {
+            run_start = SchedulerCounterStorage::clock::now();
+            _counters->record_wakeup(_info.thread_id, SchedulerCounterStorage::elapsed(_start_time, run_start));
+        }
+
         try
         {
             _window.validate();
@@ -143,6 +163,11 @@ void Thread::worker_thread()
             _current_exception = std::current_exception();
         }
 
+        if(_counters != nullptr)
+        {
+            _counters->record_window(_info.thread_id, SchedulerCounterStorage::elapsed(run_start, SchedulerCounterStorage::clock::now()));
+        }
+
         _job_complete = true;
         lock.unlock();
         _cv.notify_one();
@@ -159,12 +184,14 @@ CPPScheduler::CPPScheduler()
     : _num_threads(num_threads_hint()),
       _threads(_num_threads - 1)
 {
+    _counters.resize(_num_threads);
 }
 
 void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
     _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
     _threads.resize(_num_threads - 1);
+    _counters.resize(_num_threads);
 }
 
 unsigned int CPPScheduler::num_threads() const
@@ -189,9 +216,20 @@ void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
         return;
     }
 
+    SchedulerCounterStorage *counters = active_counters();
+    const auto               start    = counters != nullptr ? SchedulerCounterStorage::clock::now() : SchedulerCounterStorage::clock::time_point();
+
     if(!kernel->is_parallelisable() || info.num_threads == 1)
     {
         kernel->run(max_window, info);
+
+        if(counters != nullptr)
+        {
+            const uint64_t busy_time = SchedulerCounterStorage::elapsed(start, SchedulerCounterStorage::clock::now());
+            // The calling thread ran the whole window as thread 0: no worker is running, so the slot isn't shared
+            counters->record_window(0, busy_time);
+            counters->record_serial_kernel(busy_time);
+        }
     }
     else
     {
@@ -202,13 +240,16 @@ void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
         {
             Window win     = max_window.split_window(split_dimension, t, info.num_threads);
             info.thread_id = t;
-            thread_it->start(kernel, win, info);
+            thread_it->start(kernel, win, info, counters);
         }
 
         // Run last part on main thread
         Window win     = max_window.split_window(split_dimension, t, info.num_threads);
         info.thread_id = t;
+
+        const auto run_start = counters != nullptr ? SchedulerCounterStorage::clock::now() : SchedulerCounterStorage::clock::time_point();
         kernel->run(win, info);
+        const auto run_end = counters != nullptr ? SchedulerCounterStorage::clock::now() : SchedulerCounterStorage::clock::time_point();
 
         try
         {
@@ -221,6 +262,14 @@ void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
         {
             std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
         }
+
+        if(counters != nullptr)
+        {
+            const auto end = SchedulerCounterStorage::clock::now();
+            counters->record_window(t, SchedulerCounterStorage::elapsed(run_start, run_end));
+            counters->record_parallel_kernel(info.num_threads, SchedulerCounterStorage::elapsed(start, end), SchedulerCounterStorage::elapsed(start, run_start),
+                                             SchedulerCounterStorage::elapsed(run_end, end));
+        }
     }
     /** [Scheduler example] */
 }
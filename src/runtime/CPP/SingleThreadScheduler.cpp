@@ -35,6 +35,11 @@ SingleThreadScheduler &SingleThreadScheduler::get()
     return scheduler;
 }
 
+SingleThreadScheduler::SingleThreadScheduler()
+{
+    _counters.resize(1);
+}
+
 void SingleThreadScheduler::set_num_threads(unsigned int num_threads)
 {
     ARM_COMPUTE_UNUSED(num_threads);
@@ -46,7 +51,19 @@ void SingleThreadScheduler::schedule(ICPPKernel *kernel, unsigned int split_dime
     ARM_COMPUTE_UNUSED(split_dimension);
     ThreadInfo info;
     info.cpu_info = cpu_info();
+
+    SchedulerCounterStorage *counters = active_counters();
+    if(counters == nullptr)
+    {
+        kernel->run(kernel->window(), info);
+        return;
+    }
+
+    const auto start = SchedulerCounterStorage::clock::now();
     kernel->run(kernel->window(), info);
+    const uint64_t busy_time = SchedulerCounterStorage::elapsed(start, SchedulerCounterStorage::clock::now());
+    counters->record_window(0, busy_time);
+    counters->record_serial_kernel(busy_time);
 }
 
 unsigned int SingleThreadScheduler::num_threads() const
@@ -225,4 +225,29 @@ unsigned int IScheduler::num_threads_hint() const
 {
     return _num_threads_hint;
 }
+
+void IScheduler::set_counters_enabled(bool enable)
+{
+    _counters_enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool IScheduler::counters_enabled() const
+{
+    return _counters_enabled.load(std::memory_order_relaxed);
+}
+
+SchedulerCounters IScheduler::counters() const
+{
+    return _counters.snapshot();
+}
+
+void IScheduler::reset_counters()
+{
+    _counters.reset();
+}
+
+SchedulerCounterStorage *IScheduler::active_counters()
+{
+    return _counters_enabled.load(std::memory_order_relaxed) ? &_counters : nullptr;
+}
 } // namespace arm_compute
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEBatchedGEMM.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+namespace arm_compute
+{
+namespace
+{
+template <typename T>
+std::vector<const ITensorInfo *> tensor_infos(const std::vector<T *> &tensors)
+{
+    std::vector<const ITensorInfo *> infos;
+    infos.reserve(tensors.size());
+
+    for(auto t : tensors)
+    {
+        infos.push_back((t != nullptr) ? t->info() : nullptr);
+    }
+
+    return infos;
+}
+} // namespace
+
+NEBatchedGEMM::NEBatchedGEMM(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _pack_b_kernel(), _mm_kernel(), _workspace(), _packed_b(), _split_dimension(Window::DimY), _pack_b(false), _is_first_run(true),
+      _reshape_b_only_on_first_run(false)
+{
+}
+
+void NEBatchedGEMM::configure_workspace(unsigned int M, unsigned int N, unsigned int K, unsigned int num_batches)
+{
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+
+    // Many small problems are better spread across the threads one problem each than split row-wise
+    _split_dimension = (num_batches >= num_threads) ? Window::DimZ : Window::DimY;
+
+    const size_t workspace_size = NEGEMMAssemblyBatchedKernel::get_workspace_size(NEScheduler::get().cpu_info(), M, N, K, num_threads);
+    _workspace.allocator()->init(TensorInfo(TensorShape{ workspace_size }, 1, DataType::U8));
+    _memory_group.manage(&_workspace);
+}
+
+void NEBatchedGEMM::configure_packed_b(const ITensor *b, const GEMMInfo &gemm_info)
+{
+    _pack_b                      = true;
+    _reshape_b_only_on_first_run = gemm_info.reshape_b_only_on_first_run();
+
+    const size_t packed_b_size = NEGEMMAssemblyBatchedPackBKernel::get_packed_b_size(NEScheduler::get().cpu_info(), b->info()->dimension(0), b->info()->dimension(1));
+    _packed_b.allocator()->init(TensorInfo(TensorShape{ packed_b_size }, 1, DataType::U8));
+
+    // When B is only packed on the first run the panels must persist across the runs
+    if(!_reshape_b_only_on_first_run)
+    {
+        _memory_group.manage(&_packed_b);
+    }
+
+    _pack_b_kernel.configure(b, &_packed_b);
+}
+
+void NEBatchedGEMM::configure(const ITensor *a, const ITensor *b, ITensor *d, float alpha, float beta, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(NEBatchedGEMM::validate(a->info(), b->info(), d->info()));
+
+    configure_workspace(d->info()->dimension(1), d->info()->dimension(0), a->info()->dimension(0), d->info()->dimension(2));
+
+    // A matrix B shared by the batch is interleaved once instead of once per problem and thread
+    _pack_b = false;
+    if(b->info()->dimension(2) == 1)
+    {
+        configure_packed_b(b, gemm_info);
+    }
+
+    _mm_kernel.configure(a, b, d, &_workspace, alpha, beta, _pack_b ? &_packed_b : nullptr);
+
+    _workspace.allocator()->allocate();
+    if(_pack_b)
+    {
+        _packed_b.allocator()->allocate();
+    }
+}
+
+void NEBatchedGEMM::configure(const std::vector<const ITensor *> &a, const std::vector<const ITensor *> &b, const std::vector<ITensor *> &d, float alpha, float beta, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_THROW_ON(NEBatchedGEMM::validate(tensor_infos(a), tensor_infos(b), tensor_infos(d)));
+
+    configure_workspace(d[0]->info()->dimension(1), d[0]->info()->dimension(0), a[0]->info()->dimension(0), d.size());
+
+    // A matrix B shared by the batch is interleaved once instead of once per problem and thread
+    _pack_b = false;
+    if(b.size() == 1)
+    {
+        configure_packed_b(b[0], gemm_info);
+    }
+
+    _mm_kernel.configure(a, b, d, &_workspace, alpha, beta, _pack_b ? &_packed_b : nullptr);
+
+    _workspace.allocator()->allocate();
+    if(_pack_b)
+    {
+        _packed_b.allocator()->allocate();
+    }
+}
+
+Status NEBatchedGEMM::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyBatchedKernel::validate(a, b, d));
+    return Status{};
+}
+
+Status NEBatchedGEMM::validate(const std::vector<const ITensorInfo *> &a, const std::vector<const ITensorInfo *> &b, const std::vector<const ITensorInfo *> &d)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyBatchedKernel::validate(a, b, d));
+    return Status{};
+}
+
+void NEBatchedGEMM::run()
+{
+    _memory_group.acquire();
+
+    if(_pack_b && (_is_first_run || !_reshape_b_only_on_first_run))
+    {
+        NEScheduler::get().schedule(&_pack_b_kernel, Window::DimY);
+    }
+    _is_first_run = false;
+
+    NEScheduler::get().schedule(&_mm_kernel, _split_dimension);
+
+    _memory_group.release();
+}
+} // namespace arm_compute
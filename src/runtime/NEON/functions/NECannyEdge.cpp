@@ -47,6 +47,7 @@ NECannyEdge::NECannyEdge(std::shared_ptr<IMemoryManager> memory_manager) // NOLI
       _gradient(),
       _non_max_suppr(),
       _edge_trace(),
+      _border_input(),
       _border_mag_gradient(),
       _border_edge_trace(),
       _gx(),
@@ -86,64 +87,79 @@ void NECannyEdge::configure(ITensor *input, ITensor *output, int32_t upper_thr,
         magnitude_info.init(shape, Format::U32);
     }
 
-    _gx.allocator()->init(gradient_info);
-    _gy.allocator()->init(gradient_info);
     _magnitude.allocator()->init(magnitude_info);
 
     TensorInfo info(shape, Format::U8);
     _phase.allocator()->init(info);
     _nonmax.allocator()->init(info);
 
-    // Manage intermediate buffers
-    _memory_group.manage(&_gx);
-    _memory_group.manage(&_gy);
-
-    // Configure/Init sobelNxN
-    if(gradient_size == 3)
-    {
-        auto k = arm_compute::support::cpp14::make_unique<NESobel3x3>();
-        k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
-        _sobel = std::move(k);
-    }
-    else if(gradient_size == 5)
-    {
-        auto k = arm_compute::support::cpp14::make_unique<NESobel5x5>();
-        k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
-        _sobel = std::move(k);
-    }
-    else if(gradient_size == 7)
+    if(gradient_size == 3 && !use_fp16)
     {
-        auto k = arm_compute::support::cpp14::make_unique<NESobel7x7>();
-        k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
-        _sobel = std::move(k);
-    }
-    else
-    {
-        ARM_COMPUTE_ERROR("Gradient size not supported\n");
-    }
+        // Compute the Sobel gradients, magnitude and phase in one pass: Gx and Gy are never stored
+        _memory_group.manage(&_magnitude);
+        _memory_group.manage(&_phase);
 
-    // Manage intermediate buffers
-    _memory_group.manage(&_magnitude);
-    _memory_group.manage(&_phase);
-
-    // Configure gradient
-    if(use_fp16)
-    {
-        auto k = arm_compute::support::cpp14::make_unique<NEGradientFP16Kernel>();
-        k->configure(&_gx, &_gy, &_magnitude, &_phase, norm_type);
+        auto k = arm_compute::support::cpp14::make_unique<NESobel3x3GradientKernel>();
+        k->configure(input, &_magnitude, &_phase, norm_type, border_mode == BorderMode::UNDEFINED);
+        _border_input.configure(input, k->border_size(), border_mode, PixelValue(constant_border_value));
         _gradient = std::move(k);
     }
     else
     {
-        auto k = arm_compute::support::cpp14::make_unique<NEGradientKernel>();
-        k->configure(&_gx, &_gy, &_magnitude, &_phase, norm_type);
-        _gradient = std::move(k);
+        _gx.allocator()->init(gradient_info);
+        _gy.allocator()->init(gradient_info);
+
+        // Manage intermediate buffers
+        _memory_group.manage(&_gx);
+        _memory_group.manage(&_gy);
+
+        // Configure/Init sobelNxN
+        if(gradient_size == 3)
+        {
+            auto k = arm_compute::support::cpp14::make_unique<NESobel3x3>();
+            k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
+            _sobel = std::move(k);
+        }
+        else if(gradient_size == 5)
+        {
+            auto k = arm_compute::support::cpp14::make_unique<NESobel5x5>();
+            k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
+            _sobel = std::move(k);
+        }
+        else if(gradient_size == 7)
+        {
+            auto k = arm_compute::support::cpp14::make_unique<NESobel7x7>();
+            k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
+            _sobel = std::move(k);
+        }
+        else
+        {
+            ARM_COMPUTE_ERROR("Gradient size not supported\n");
+        }
+
+        // Manage intermediate buffers
+        _memory_group.manage(&_magnitude);
+        _memory_group.manage(&_phase);
+
+        // Configure gradient
+        if(use_fp16)
+        {
+            auto k = arm_compute::support::cpp14::make_unique<NEGradientFP16Kernel>();
+            k->configure(&_gx, &_gy, &_magnitude, &_phase, norm_type);
+            _gradient = std::move(k);
+        }
+        else
+        {
+            auto k = arm_compute::support::cpp14::make_unique<NEGradientKernel>();
+            k->configure(&_gx, &_gy, &_magnitude, &_phase, norm_type);
+            _gradient = std::move(k);
+        }
+
+        // Allocate intermediate tensors
+        _gx.allocator()->allocate();
+        _gy.allocator()->allocate();
     }
 
-    // Allocate intermediate tensors
-    _gx.allocator()->allocate();
-    _gy.allocator()->allocate();
-
     // Manage intermediate buffers
     _memory_group.manage(&_nonmax);
 
@@ -170,13 +186,21 @@ void NECannyEdge::configure(ITensor *input, ITensor *output, int32_t upper_thr,
 
 void NECannyEdge::run()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_sobel == nullptr, "Unconfigured function");
+    ARM_COMPUTE_ERROR_ON_MSG(_gradient == nullptr, "Unconfigured function");
     ARM_COMPUTE_ERROR_ON(_output == nullptr);
 
     _memory_group.acquire();
 
-    // Run sobelNxN
-    _sobel->run();
+    if(_sobel != nullptr)
+    {
+        // Run sobelNxN
+        _sobel->run();
+    }
+    else
+    {
+        // Fill border before the fused 3x3 gradient
+        NEScheduler::get().schedule(&_border_input, Window::DimZ);
+    }
 
     // Fill border before non-maxima suppression. Nop for border mode undefined.
     NEScheduler::get().schedule(&_border_mag_gradient, Window::DimZ);
@@ -28,11 +28,15 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
 
 using namespace arm_compute;
 
 NEEqualizeHistogram::NEEqualizeHistogram()
-    : _histogram_kernel(), _cd_histogram_kernel(), _map_histogram_kernel(), _hist(nr_bins, 0, max_range), _cum_dist(nr_bins, 0, max_range), _cd_lut(nr_bins, DataType::U8)
+    : _histogram_kernel(), _reduction_kernel(), _cd_histogram_kernel(), _map_histogram_kernel(), _hist(nr_bins, 0, max_range), _cum_dist(nr_bins, 0, max_range), _cd_lut(nr_bins, DataType::U8),
+      _local_hist(), _local_hist_size(0)
 {
 }
 
@@ -43,16 +47,26 @@ void NEEqualizeHistogram::configure(const IImage *input, IImage *output)
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
 
+    // Allocate space for threads local histograms
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    _local_hist_size               = NEHistogramKernel::local_hist_stride(nr_bins) * num_threads;
+    _local_hist                    = arm_compute::support::cpp14::make_unique<uint32_t[]>(_local_hist_size);
+
     // Configure kernels
-    _histogram_kernel.configure(input, &_hist);
+    _histogram_kernel.configure(input, &_hist, _local_hist.get());
+    _reduction_kernel.configure(_local_hist.get(), num_threads, &_hist);
     _cd_histogram_kernel.configure(input, &_hist, &_cum_dist, &_cd_lut);
     _map_histogram_kernel.configure(input, &_cd_lut, output);
 }
 
 void NEEqualizeHistogram::run()
 {
+    // Clear the threads local histograms
+    std::fill_n(_local_hist.get(), _local_hist_size, 0);
+
     // Calculate histogram of input.
     NEScheduler::get().schedule(&_histogram_kernel, Window::DimY);
+    NEScheduler::get().schedule(&_reduction_kernel, Window::DimX);
 
     // Calculate cumulative distribution of histogram and create LUT.
     NEScheduler::get().schedule(&_cd_histogram_kernel, Window::DimY);
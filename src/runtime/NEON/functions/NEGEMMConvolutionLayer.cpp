@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
 
 #include "arm_compute/core/NEON/kernels/arm32/NEGEMMAArch32Kernel.h"
+#include "arm_compute/core/NEON/kernels/arm64/NEGEMMAArch64ImplicitConvolutionKernel.h"
 #include "arm_compute/core/NEON/kernels/arm64/NEGEMMAArch64Kernel.h"
 #include "arm_compute/core/NEON/kernels/arm64/NEGEMMAArch64NativeKernel.h"
 #include "arm_compute/core/PixelValue.h"
@@ -226,9 +227,9 @@ Status validate_and_initialize_values(const ITensorInfo *input, const ITensorInf
 } // namespace
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _memory_group(memory_manager), _input_im2col_kernel(), _input_interleave_kernel(), _reshape_weights(), _mm_kernel(), _mm_optimised_kernel(nullptr), _mm_gemmlowp(memory_manager),
+    : _memory_group(memory_manager), _input_im2col_kernel(), _input_interleave_kernel(), _reshape_weights(), _mm_kernel(), _mm_optimised_kernel(nullptr), _mm_implicit_kernel(nullptr), _mm_gemmlowp(memory_manager),
       _gemmlowp_output_stage(), _output_col2im_kernel(), _input_im2col_reshaped(), _input_interleaved_reshaped(), _weights_reshaped(), _gemm_output(), _tmp_output(), _workspace(), _append_bias(false),
-      _is_fully_connected_convolution(false), _are_weights_reshaped(false), _is_quantized(false), _is_interleaved(false)
+      _is_fully_connected_convolution(false), _are_weights_reshaped(false), _is_quantized(false), _is_interleaved(false), _is_implicit_gemm(false)
 {
 }
 
@@ -370,12 +371,21 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     const unsigned int mat_input_cols = mat_weights_rows;
     const unsigned int mat_input_rows = conv_w * conv_h;
 
+#if defined(__aarch64__)
+    // The interleaved assembly GEMM can gather the im2col patches itself while packing its A panels,
+    // in which case the im2col matrix (kernel_width * kernel_height times the size of the input) is never allocated
+    _is_implicit_gemm = (_mm_optimised_kernel != nullptr) && !_is_fully_connected_convolution && ((mat_weights_cols > 128) || (mat_weights_rows > 128));
+#endif /* defined(__aarch64__) */
+
     TensorShape shape_im2col(input->info()->tensor_shape());
     shape_im2col.set(0, mat_input_cols);
     shape_im2col.set(1, mat_input_rows);
     shape_im2col.set(2, 1);
-    _input_im2col_reshaped.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col));
-    _memory_group.manage(&_input_im2col_reshaped);
+    if(!_is_implicit_gemm)
+    {
+        _input_im2col_reshaped.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col));
+        _memory_group.manage(&_input_im2col_reshaped);
+    }
 
     // Create tensor (interleave) to prepare input tensor for GEMM
     if(!_is_fully_connected_convolution && _mm_optimised_kernel == nullptr)
@@ -388,7 +398,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     }
 
     // Create GEMM output tensor
-    TensorShape shape_gemm(_input_im2col_reshaped.info()->tensor_shape());
+    TensorShape shape_gemm(shape_im2col);
     shape_gemm.set(0, mat_weights_cols);
     shape_gemm.set(1, mat_input_rows);
     const DataType gemm_data_type = _is_quantized ? DataType::S32 : dt;
@@ -400,7 +410,10 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 
     // Configure kernels
     // Configure im2col
-    _input_im2col_kernel.configure(input, &_input_im2col_reshaped, Size2D(kernel_width, kernel_height), conv_info, _append_bias);
+    if(!_is_implicit_gemm)
+    {
+        _input_im2col_kernel.configure(input, &_input_im2col_reshaped, Size2D(kernel_width, kernel_height), conv_info, _append_bias);
+    }
 
     // Configure matrix multiply
     if(_mm_optimised_kernel != nullptr)
@@ -409,7 +422,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 
         const int M = _gemm_output.info()->tensor_shape().y();
         const int N = _gemm_output.info()->tensor_shape().x();
-        const int K = _input_im2col_reshaped.info()->tensor_shape().x();
+        const int K = shape_im2col.x();
 
 #if defined(__aarch64__)
         if((N <= 128) && (K <= 128))
@@ -423,7 +436,18 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         }
 
         // Configure matrix multiplication kernel
-        _mm_optimised_kernel->configure(&_input_im2col_reshaped, weights, &_gemm_output, &_workspace);
+        if(_is_implicit_gemm)
+        {
+#if defined(__aarch64__)
+            auto k = support::cpp14::make_unique<NEGEMMAArch64ImplicitConvolutionKernel>();
+            k->configure(input, weights, &_gemm_output, &_workspace, Size2D(kernel_width, kernel_height), conv_info, _append_bias);
+            _mm_implicit_kernel = std::move(k);
+#endif /* defined(__aarch64__) */
+        }
+        else
+        {
+            _mm_optimised_kernel->configure(&_input_im2col_reshaped, weights, &_gemm_output, &_workspace);
+        }
 
         _workspace.allocator()->allocate();
     }
@@ -445,7 +469,10 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         }
     }
 
-    _input_im2col_reshaped.allocator()->allocate();
+    if(!_is_implicit_gemm)
+    {
+        _input_im2col_reshaped.allocator()->allocate();
+    }
 
     // Configure output stage for quantized case
     if(_is_quantized)
@@ -612,10 +639,18 @@ void NEGEMMConvolutionLayer::run()
     _memory_group.acquire();
 
     // Run input reshaping
-    NEScheduler::get().schedule(&_input_im2col_kernel, Window::DimY);
+    if(!_is_implicit_gemm)
+    {
+        NEScheduler::get().schedule(&_input_im2col_kernel, Window::DimY);
+    }
 
     // Runs matrix multiply on reshaped matrices
-    if(_mm_optimised_kernel != nullptr)
+    if(_is_implicit_gemm)
+    {
+        // Gathers the input patches while packing the GEMM panels
+        NEScheduler::get().schedule(_mm_implicit_kernel.get(), Window::DimY);
+    }
+    else if(_mm_optimised_kernel != nullptr)
     {
         NEScheduler::get().schedule(_mm_optimised_kernel.get(), Window::DimY);
     }
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGroupedConvolutionLayer.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/arm64/NEGEMMAArch64ImplicitConvolutionKernel.h"
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <tuple>
+
+namespace arm_compute
+{
+namespace
+{
+/** Checks if all the groups can be computed by a single @ref NEGEMMAArch64ImplicitConvolutionKernel */
+bool is_single_kernel_execution_possible(const ITensorInfo *input)
+{
+#if defined(__aarch64__)
+    return NEScheduler::get().cpu_info().CPU >= CPUTarget::ARMV8 && input->data_type() == DataType::F32;
+#else  /* defined(__aarch64__) */
+    ARM_COMPUTE_UNUSED(input);
+    return false;
+#endif /* defined(__aarch64__) */
+}
+
+TensorShape compute_output_shape(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info)
+{
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->dimension(0), input->dimension(1), weights->dimension(0), weights->dimension(1), conv_info);
+
+    TensorShape output_shape(input->tensor_shape());
+    output_shape.set(0, conv_w);
+    output_shape.set(1, conv_h);
+    output_shape.set(2, weights->dimension(3));
+    return output_shape;
+}
+} // namespace
+
+NEGroupedConvolutionLayer::NEGroupedConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _weights_reshape_kernel(), _mm_kernel(nullptr), _output_col2im_kernel(), _sub_tensors(), _convolutions(), _weights_reshaped(), _gemm_output(),
+      _workspace(), _are_weights_reshaped(false)
+{
+}
+
+void NEGroupedConvolutionLayer::configure(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int num_groups)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(compute_output_shape(input->info(), weights->info(), conv_info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(NEGroupedConvolutionLayer::validate(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, num_groups));
+
+    _are_weights_reshaped = false;
+
+    if(is_single_kernel_execution_possible(input->info()))
+    {
+#if defined(__aarch64__)
+        const bool         has_bias      = (biases != nullptr);
+        const unsigned int kernel_width  = weights->info()->dimension(0);
+        const unsigned int kernel_height = weights->info()->dimension(1);
+        const unsigned int conv_w        = output->info()->dimension(0);
+        const unsigned int conv_h        = output->info()->dimension(1);
+        const unsigned int num_kernels   = weights->info()->dimension(3);
+
+        // The weights of all the groups are reshaped at once: group g owns the columns [g * OFM / num_groups, (g + 1) * OFM / num_groups)
+        const unsigned int mat_weights_rows = kernel_width * kernel_height * weights->info()->dimension(2) + (has_bias ? 1 : 0);
+        _weights_reshaped.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(TensorShape(num_kernels, mat_weights_rows)));
+        _weights_reshape_kernel.configure(weights, biases, &_weights_reshaped);
+
+        // GEMM output of all the groups, one row per output point
+        TensorShape shape_gemm(input->info()->tensor_shape());
+        shape_gemm.set(0, num_kernels);
+        shape_gemm.set(1, conv_w * conv_h);
+        shape_gemm.set(2, 1);
+        _gemm_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_gemm));
+        _memory_group.manage(&_gemm_output);
+
+        const size_t workspace_size = NEGEMMAArch64ImplicitConvolutionKernel::get_workspace_size(NEScheduler::get().cpu_info(), conv_w * conv_h, num_kernels / num_groups, mat_weights_rows,
+                                                                                                 NEScheduler::get().num_threads());
+        _workspace.allocator()->init(TensorInfo(TensorShape{ workspace_size }, 1, DataType::U8));
+        _memory_group.manage(&_workspace);
+
+        auto k = support::cpp14::make_unique<NEGEMMAArch64ImplicitConvolutionKernel>();
+        k->configure(input, &_weights_reshaped, &_gemm_output, &_workspace, Size2D(kernel_width, kernel_height), conv_info, has_bias, num_groups);
+        _mm_kernel = std::move(k);
+
+        _output_col2im_kernel.configure(&_gemm_output, output, Size2D(conv_w, conv_h));
+
+        _weights_reshaped.allocator()->allocate();
+        _workspace.allocator()->allocate();
+        _gemm_output.allocator()->allocate();
+#endif /* defined(__aarch64__) */
+    }
+    else
+    {
+        TensorShape input_shape   = input->info()->tensor_shape();
+        TensorShape output_shape  = output->info()->tensor_shape();
+        TensorShape weights_shape = weights->info()->tensor_shape();
+        TensorShape biases_shape  = (biases != nullptr) ? biases->info()->tensor_shape() : TensorShape();
+
+        const unsigned int input_split   = input_shape.z() / num_groups;
+        const unsigned int output_split  = output_shape.z() / num_groups;
+        const unsigned int weights_split = weights_shape[3] / num_groups;
+
+        input_shape.set(2, input_split);
+        output_shape.set(2, output_split);
+        weights_shape.set(3, weights_split);
+        biases_shape.set(0, weights_split);
+
+        // The sub-tensors must not be relocated once the convolutions point to them
+        _sub_tensors.reserve(4 * num_groups);
+
+        for(unsigned int i = 0; i < num_groups; ++i)
+        {
+            _sub_tensors.emplace_back(input, input_shape, Coordinates(0, 0, input_split * i));
+            ITensor *group_input = &_sub_tensors.back();
+            _sub_tensors.emplace_back(weights, weights_shape, Coordinates(0, 0, 0, weights_split * i));
+            ITensor *group_weights = &_sub_tensors.back();
+            _sub_tensors.emplace_back(output, output_shape, Coordinates(0, 0, output_split * i));
+            ITensor *group_output = &_sub_tensors.back();
+            ITensor *group_biases = nullptr;
+            if(biases != nullptr)
+            {
+                _sub_tensors.emplace_back(biases, biases_shape, Coordinates(weights_split * i));
+                group_biases = &_sub_tensors.back();
+            }
+
+            auto conv = support::cpp14::make_unique<NEGEMMConvolutionLayer>();
+            conv->configure(group_input, group_weights, group_biases, group_output, conv_info);
+            _convolutions.emplace_back(std::move(conv));
+        }
+    }
+}
+
+Status NEGroupedConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                           unsigned int num_groups)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QASYMM8, DataType::QS16, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((input->dimension(2) % num_groups) != 0, "Input depth not multiple of the number of groups!");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((weights->dimension(3) % num_groups) != 0, "Number of kernels not multiple of the number of groups!");
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(2) * num_groups != input->dimension(2));
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(3));
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+    }
+
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(input, weights, conv_info));
+    }
+
+    if(!is_single_kernel_execution_possible(input))
+    {
+        // Validate the convolution of a single group, all the groups share the same shapes
+        TensorShape input_shape  = input->tensor_shape();
+        TensorShape output_shape = compute_output_shape(input, weights, conv_info);
+        input_shape.set(2, input->dimension(2) / num_groups);
+        output_shape.set(2, output_shape.z() / num_groups);
+
+        TensorShape weights_shape = weights->tensor_shape();
+        weights_shape.set(3, weights->dimension(3) / num_groups);
+
+        const TensorInfo                   group_input   = input->clone()->set_is_resizable(true).set_tensor_shape(input_shape);
+        const TensorInfo                   group_weights = weights->clone()->set_is_resizable(true).set_tensor_shape(weights_shape);
+        const TensorInfo                   group_output  = input->clone()->set_is_resizable(true).set_tensor_shape(output_shape);
+        std::unique_ptr<ITensorInfo>       group_biases  = nullptr;
+        if(biases != nullptr)
+        {
+            group_biases = biases->clone();
+            group_biases->set_is_resizable(true).set_tensor_shape(TensorShape(weights_shape[3]));
+        }
+
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConvolutionLayer::validate(&group_input, &group_weights, group_biases.get(), &group_output, conv_info));
+    }
+
+    return Status{};
+}
+
+void NEGroupedConvolutionLayer::run()
+{
+    if(_mm_kernel == nullptr)
+    {
+        for(auto &conv : _convolutions)
+        {
+            conv->run();
+        }
+        return;
+    }
+
+    // Run weights reshaping (Runs once for every configure)
+    if(!_are_weights_reshaped)
+    {
+        _are_weights_reshaped = true;
+        NEScheduler::get().schedule(&_weights_reshape_kernel, 3);
+    }
+
+    _memory_group.acquire();
+
+    // All the groups are computed in a single scheduled kernel
+    NEScheduler::get().schedule(_mm_kernel.get(), Window::DimY);
+
+    // Reshape output matrix
+    NEScheduler::get().schedule(&_output_col2im_kernel, Window::DimY);
+
+    _memory_group.release();
+}
+} // namespace arm_compute
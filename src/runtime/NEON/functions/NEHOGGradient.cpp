@@ -32,10 +32,8 @@ using namespace arm_compute;
 
 NEHOGGradient::NEHOGGradient(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
     : _memory_group(std::move(memory_manager)),
-      _derivative(),
-      _mag_phase(nullptr),
-      _gx(),
-      _gy()
+      _border_handler(),
+      _mag_phase(nullptr)
 {
 }
 
@@ -45,47 +43,33 @@ void NEHOGGradient::configure(ITensor *input, ITensor *output_magnitude, ITensor
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_magnitude, 1, DataType::S16);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_phase, 1, DataType::U8);
 
-    const TensorShape &shape_img = input->info()->tensor_shape();
+    const bool border_undefined = border_mode == BorderMode::UNDEFINED;
 
-    // Allocate image memory
-    TensorInfo info(shape_img, Format::S16);
-    _gx.allocator()->init(info);
-    _gy.allocator()->init(info);
-
-    // Manage intermediate buffers
-    _memory_group.manage(&_gx);
-    _memory_group.manage(&_gy);
-
-    // Initialise derivate kernel
-    _derivative.configure(input, &_gx, &_gy, border_mode, constant_border_value);
-
-    // Initialise magnitude/phase kernel
+    // Initialise the fused derivative and magnitude/phase kernel
     if(PhaseType::UNSIGNED == phase_type)
     {
-        auto k = arm_compute::support::cpp14::make_unique<NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::UNSIGNED>>();
-        k->configure(&_gx, &_gy, output_magnitude, output_phase);
+        auto k = arm_compute::support::cpp14::make_unique<NEDerivativeMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::UNSIGNED>>();
+        k->configure(input, output_magnitude, output_phase, border_undefined);
         _mag_phase = std::move(k);
     }
     else
     {
-        auto k = arm_compute::support::cpp14::make_unique<NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>>();
-        k->configure(&_gx, &_gy, output_magnitude, output_phase);
+        auto k = arm_compute::support::cpp14::make_unique<NEDerivativeMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>>();
+        k->configure(input, output_magnitude, output_phase, border_undefined);
         _mag_phase = std::move(k);
     }
 
-    // Allocate intermediate tensors
-    _gx.allocator()->allocate();
-    _gy.allocator()->allocate();
+    _border_handler.configure(input, _mag_phase->border_size(), border_mode, PixelValue(constant_border_value));
 }
 
 void NEHOGGradient::run()
 {
     _memory_group.acquire();
 
-    // Run derivative
-    _derivative.run();
+    // Fill border
+    NEScheduler::get().schedule(&_border_handler, Window::DimZ);
 
-    // Run magnitude/phase kernel
+    // Run derivative and magnitude/phase kernel
     NEScheduler::get().schedule(_mag_phase.get(), Window::DimY);
 
     _memory_group.release();
@@ -120,15 +120,45 @@ void NEHOGMultiDetection::configure(ITensor *input, const IMultiHOG *multi_hog,
         input_hog_detect.push_back(input_block_norm.size() - 1);
     }
 
+    /* Group the HOG data-objects evaluated by the same NEHOGDetectorKernel
+     *
+     * Consecutive HOG data-objects reading the same normalized HOG space with the same detection window size and stride are scored in a single pass,
+     * up to NEHOGDetectorKernel::max_num_models at a time
+     */
+    std::vector<std::pair<size_t, size_t>> detect_groups; // First HOG data-object and number of HOG data-objects of each group
+
+    for(size_t i = 0; i < num_models; ++i)
+    {
+        if(!detect_groups.empty())
+        {
+            const size_t first      = detect_groups.back().first;
+            const size_t group_size = detect_groups.back().second;
+
+            const Size2D &cur_window   = multi_hog->model(i)->info()->detection_window_size();
+            const Size2D &first_window = multi_hog->model(first)->info()->detection_window_size();
+            const Size2D &cur_stride   = detection_window_strides->at(i);
+            const Size2D &first_stride = detection_window_strides->at(first);
+
+            if((group_size < NEHOGDetectorKernel::max_num_models) && (input_hog_detect[i] == input_hog_detect[first]) && (cur_window.width == first_window.width)
+               && (cur_window.height == first_window.height) && (cur_stride.width == first_stride.width) && (cur_stride.height == first_stride.height))
+            {
+                ++detect_groups.back().second;
+                continue;
+            }
+        }
+
+        detect_groups.emplace_back(i, 1);
+    }
+
     _detection_windows      = detection_windows;
     _non_maxima_suppression = non_maxima_suppression;
     _num_orient_bin_kernel  = input_orient_bin.size(); // Number of NEHOGOrientationBinningKernel kernels to compute
     _num_block_norm_kernel  = input_block_norm.size(); // Number of NEHOGBlockNormalizationKernel kernels to compute
-    _num_hog_detect_kernel  = input_hog_detect.size(); // Number of NEHOGDetector functions to compute
+    _num_hog_detect_kernel  = detect_groups.size();    // Number of NEHOGDetectorKernel kernels to compute
 
     _orient_bin_kernel = arm_compute::support::cpp14::make_unique<NEHOGOrientationBinningKernel[]>(_num_orient_bin_kernel);
     _block_norm_kernel = arm_compute::support::cpp14::make_unique<NEHOGBlockNormalizationKernel[]>(_num_block_norm_kernel);
-    _hog_detect_kernel = arm_compute::support::cpp14::make_unique<NEHOGDetector[]>(_num_hog_detect_kernel);
+    _hog_detect_kernel = arm_compute::support::cpp14::make_unique<NEHOGDetectorKernel[]>(_num_hog_detect_kernel);
     _non_maxima_kernel = arm_compute::support::cpp14::make_unique<CPPDetectionWindowNonMaximaSuppressionKernel>();
     _hog_space         = arm_compute::support::cpp14::make_unique<Tensor[]>(_num_orient_bin_kernel);
     _hog_norm_space    = arm_compute::support::cpp14::make_unique<Tensor[]>(_num_block_norm_kernel);
@@ -206,9 +236,19 @@ void NEHOGMultiDetection::configure(ITensor *input, const IMultiHOG *multi_hog,
     // Configure HOG detector kernel
     for(size_t i = 0; i < _num_hog_detect_kernel; ++i)
     {
-        const size_t idx_block_norm = input_hog_detect[i];
+        const size_t first          = detect_groups[i].first;
+        const size_t idx_block_norm = input_hog_detect[first];
+
+        std::vector<const IHOG *> hogs;
+        std::vector<uint16_t>     idx_classes;
+
+        for(size_t j = first; j < first + detect_groups[i].second; ++j)
+        {
+            hogs.push_back(multi_hog->model(j));
+            idx_classes.push_back(j);
+        }
 
-        _hog_detect_kernel[i].configure(_hog_norm_space.get() + idx_block_norm, multi_hog->model(i), detection_windows, detection_window_strides->at(i), threshold, i);
+        _hog_detect_kernel[i].configure(_hog_norm_space.get() + idx_block_norm, hogs, detection_windows, detection_window_strides->at(first), threshold, idx_classes);
     }
 
     // Configure non maxima suppression kernel
@@ -248,7 +288,7 @@ void NEHOGMultiDetection::run()
     // Run HOG detector kernel
     for(size_t i = 0; i < _num_hog_detect_kernel; ++i)
     {
-        _hog_detect_kernel[i].run();
+        NEScheduler::get().schedule(_hog_detect_kernel.get() + i, Window::DimY);
     }
 
     // Run non-maxima suppression kernel if enabled
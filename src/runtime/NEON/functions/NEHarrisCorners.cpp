@@ -47,6 +47,7 @@ NEHarrisCorners::NEHarrisCorners(std::shared_ptr<IMemoryManager> memory_manager)
       _harris_score(),
       _non_max_suppr(),
       _candidates(),
+      _sort_candidates(),
       _sort_euclidean(),
       _border_gx(),
       _border_gy(),
@@ -207,8 +208,12 @@ void NEHarrisCorners::configure(IImage *input, float threshold, float min_dist,
     // Allocate once all the configure methods have been called
     _nonmax.allocator()->allocate();
 
+    // Sort the candidates in one run per thread, the runs are merged by the euclidean distance kernel
+    const unsigned int num_sorted_runs = NEScheduler::get().num_threads();
+    _sort_candidates.configure(_corners_list.get(), &_num_corner_candidates, num_sorted_runs);
+
     // Init euclidean distance
-    _sort_euclidean.configure(_corners_list.get(), corners, &_num_corner_candidates, min_dist);
+    _sort_euclidean.configure(_corners_list.get(), corners, &_num_corner_candidates, min_dist, num_sorted_runs);
 }
 
 void NEHarrisCorners::run()
@@ -237,6 +242,7 @@ void NEHarrisCorners::run()
     NEScheduler::get().schedule(&_candidates, Window::DimY);
 
     // Run sort & euclidean distance
+    NEScheduler::get().schedule(&_sort_candidates, Window::DimX);
     NEScheduler::get().schedule(&_sort_euclidean, Window::DimY);
 
     _memory_group.release();
@@ -31,10 +31,12 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
+
 using namespace arm_compute;
 
 NEHistogram::NEHistogram()
-    : _histogram_kernel(), _local_hist(), _window_lut(arm_compute::support::cpp14::make_unique<uint32_t[]>(window_lut_default_size)), _local_hist_size(0)
+    : _histogram_kernel(), _reduction_kernel(), _local_hist(), _window_lut(arm_compute::support::cpp14::make_unique<uint32_t[]>(window_lut_default_size)), _local_hist_size(0)
 {
 }
 
@@ -44,15 +46,23 @@ void NEHistogram::configure(const IImage *input, IDistribution1D *output)
     ARM_COMPUTE_ERROR_ON(nullptr == output);
 
     // Allocate space for threads local histograms
-    _local_hist_size = output->num_bins() * NEScheduler::get().num_threads();
-    _local_hist      = arm_compute::support::cpp14::make_unique<uint32_t[]>(_local_hist_size);
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    _local_hist_size               = NEHistogramKernel::local_hist_stride(output->num_bins()) * num_threads;
+    _local_hist                    = arm_compute::support::cpp14::make_unique<uint32_t[]>(_local_hist_size);
 
-    // Configure kernel
+    // Configure kernels
     _histogram_kernel.configure(input, output, _local_hist.get(), _window_lut.get());
+    _reduction_kernel.configure(_local_hist.get(), num_threads, output);
 }
 
 void NEHistogram::run()
 {
-    // Calculate histogram of input.
+    // Clear the threads local histograms
+    std::fill_n(_local_hist.get(), _local_hist_size, 0);
+
+    // Calculate the local histograms of input.
     NEScheduler::get().schedule(&_histogram_kernel, Window::DimY);
+
+    // Sum the local histograms
+    NEScheduler::get().schedule(&_reduction_kernel, Window::DimX);
 }
@@ -48,7 +48,10 @@ NEOpticalFlow::NEOpticalFlow(std::shared_ptr<IMemoryManager> memory_manager) //
       _old_points(nullptr),
       _new_points_internal(),
       _old_points_internal(),
-      _num_levels(0)
+      _num_levels(0),
+      _is_streaming(false),
+      _pyramids{ { nullptr, nullptr } },
+      _old_index(0)
 {
 }
 
@@ -71,6 +74,9 @@ void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyr
     _old_points           = old_points;
     _new_points           = new_points;
     _new_points_estimates = new_points_estimates;
+    _is_streaming         = false;
+    _pyramids             = { { old_pyramid, new_pyramid } };
+    _old_index            = 0;
 
     const float pyr_scale = old_pyramid->info()->scale();
 
@@ -85,51 +91,130 @@ void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyr
 
     for(unsigned int i = 0; i < _num_levels; ++i)
     {
-        // Get images from the ith level of old and right pyramid
-        IImage *old_ith_input = old_pyramid->get_pyramid_level(i);
-        IImage *new_ith_input = new_pyramid->get_pyramid_level(i);
+        init_gradients(i, old_pyramid->get_pyramid_level(i));
+        configure_level(i, old_pyramid->get_pyramid_level(i), new_pyramid->get_pyramid_level(i), i, old_points, new_points_estimates, new_points,
+                        termination, epsilon, num_iterations, window_dimension, use_initial_estimate, border_mode, constant_border_value, pyr_scale);
 
-        // Get width and height of images
-        const unsigned int width_ith  = old_ith_input->info()->dimension(0);
-        const unsigned int height_ith = new_ith_input->info()->dimension(1);
+        // Manage intermediate buffers
+        _memory_group.manage(_scharr_gx.get() + i);
+        _memory_group.manage(_scharr_gy.get() + i);
+
+        _scharr_gx[i].allocator()->allocate();
+        _scharr_gy[i].allocator()->allocate();
+    }
+}
+
+void NEOpticalFlow::configure_streaming(const Pyramid *pyramid_a, const Pyramid *pyramid_b, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
+                                        IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
+                                        bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value)
+{
+    ARM_COMPUTE_ERROR_ON(nullptr == pyramid_a);
+    ARM_COMPUTE_ERROR_ON(nullptr == pyramid_b);
+    ARM_COMPUTE_ERROR_ON(nullptr == old_points);
+    ARM_COMPUTE_ERROR_ON(nullptr == new_points_estimates);
+    ARM_COMPUTE_ERROR_ON(nullptr == new_points);
+    ARM_COMPUTE_ERROR_ON(pyramid_a->info()->num_levels() != pyramid_b->info()->num_levels());
+    ARM_COMPUTE_ERROR_ON(0 == pyramid_a->info()->num_levels());
+    ARM_COMPUTE_ERROR_ON(pyramid_a->info()->width() != pyramid_b->info()->width());
+    ARM_COMPUTE_ERROR_ON(pyramid_a->info()->height() != pyramid_b->info()->height());
+    ARM_COMPUTE_ERROR_ON(use_initial_estimate && old_points->num_values() != new_points_estimates->num_values());
+
+    _num_levels           = pyramid_a->info()->num_levels();
+    _old_points           = old_points;
+    _new_points           = new_points;
+    _new_points_estimates = new_points_estimates;
+    _is_streaming         = true;
+    _pyramids             = { { pyramid_a, pyramid_b } };
+    _old_index            = 0;
+
+    const float pyr_scale = pyramid_a->info()->scale();
+
+    // Each pyramid of the pair gets its own Scharr functions and trackers, using it as old frame.
+    // Only one frame is tracked at a time, so both share the gradient tensors.
+    _func_scharr    = arm_compute::support::cpp14::make_unique<NEScharr3x3[]>(2 * _num_levels);
+    _kernel_tracker = arm_compute::support::cpp14::make_unique<NELKTrackerKernel[]>(2 * _num_levels);
+    _scharr_gx      = arm_compute::support::cpp14::make_unique<Tensor[]>(_num_levels);
+    _scharr_gy      = arm_compute::support::cpp14::make_unique<Tensor[]>(_num_levels);
+
+    _old_points_internal = LKInternalKeypointArray(old_points->num_values());
+    _new_points_internal = LKInternalKeypointArray(old_points->num_values());
+    _new_points->resize(old_points->num_values());
 
-        TensorInfo tensor_info(TensorShape(width_ith, height_ith), Format::S16);
+    for(unsigned int i = 0; i < _num_levels; ++i)
+    {
+        init_gradients(i, pyramid_a->get_pyramid_level(i));
 
-        _scharr_gx[i].allocator()->init(tensor_info);
-        _scharr_gy[i].allocator()->init(tensor_info);
+        for(unsigned int p = 0; p < 2; ++p)
+        {
+            configure_level(p * _num_levels + i, _pyramids[p]->get_pyramid_level(i), _pyramids[1 - p]->get_pyramid_level(i), i, old_points, new_points_estimates, new_points,
+                            termination, epsilon, num_iterations, window_dimension, use_initial_estimate, border_mode, constant_border_value, pyr_scale);
+        }
 
         // Manage intermediate buffers
         _memory_group.manage(_scharr_gx.get() + i);
         _memory_group.manage(_scharr_gy.get() + i);
 
-        // Init Scharr kernel
-        _func_scharr[i].configure(old_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i, border_mode, constant_border_value);
-
-        // Init Lucas-Kanade kernel
-        _kernel_tracker[i].configure(old_ith_input, new_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i,
-                                     old_points, new_points_estimates, new_points,
-                                     &_old_points_internal, &_new_points_internal,
-                                     termination, use_initial_estimate, epsilon, num_iterations, window_dimension,
-                                     i, _num_levels, pyr_scale);
-
         _scharr_gx[i].allocator()->allocate();
         _scharr_gy[i].allocator()->allocate();
     }
 }
 
+void NEOpticalFlow::init_gradients(unsigned int level, const IImage *input)
+{
+    TensorInfo tensor_info(TensorShape(input->info()->dimension(0), input->info()->dimension(1)), Format::S16);
+
+    _scharr_gx[level].allocator()->init(tensor_info);
+    _scharr_gy[level].allocator()->init(tensor_info);
+}
+
+void NEOpticalFlow::configure_level(unsigned int idx, IImage *old_input, IImage *new_input, unsigned int level, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
+                                    IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
+                                    bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value, float pyr_scale)
+{
+    // Init Scharr kernel
+    _func_scharr[idx].configure(old_input, _scharr_gx.get() + level, _scharr_gy.get() + level, border_mode, constant_border_value);
+
+    // Init Lucas-Kanade kernel
+    _kernel_tracker[idx].configure(old_input, new_input, _scharr_gx.get() + level, _scharr_gy.get() + level,
+                                   old_points, new_points_estimates, new_points,
+                                   &_old_points_internal, &_new_points_internal,
+                                   termination, use_initial_estimate, epsilon, num_iterations, window_dimension,
+                                   level, _num_levels, pyr_scale);
+}
+
+void NEOpticalFlow::next_frame()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_streaming, "Function not configured for streaming");
+
+    _old_index = 1 - _old_index;
+}
+
+const Pyramid *NEOpticalFlow::old_pyramid() const
+{
+    return _pyramids[_old_index];
+}
+
+const Pyramid *NEOpticalFlow::new_pyramid() const
+{
+    return _pyramids[1 - _old_index];
+}
+
 void NEOpticalFlow::run()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_num_levels == 0, "Unconfigured function");
 
+    // In streaming mode, use the functions configured with the current old pyramid
+    const unsigned int offset = _old_index * _num_levels;
+
     _memory_group.acquire();
 
     for(unsigned int level = _num_levels; level > 0; --level)
     {
         // Run Scharr kernel
-        _func_scharr[level - 1].run();
+        _func_scharr[offset + level - 1].run();
 
         // Run Lucas-Kanade kernel
-        NEScheduler::get().schedule(_kernel_tracker.get() + level - 1, Window::DimX);
+        NEScheduler::get().schedule(_kernel_tracker.get() + offset + level - 1, Window::DimX);
     }
 
     _memory_group.release();
@@ -41,6 +41,7 @@ OMPScheduler &OMPScheduler::get()
 OMPScheduler::OMPScheduler() // NOLINT
     : _num_threads(omp_get_max_threads())
 {
+    _counters.resize(_num_threads);
 }
 
 unsigned int OMPScheduler::num_threads() const
@@ -52,6 +53,7 @@ void OMPScheduler::set_num_threads(unsigned int num_threads)
 {
     const unsigned int num_cores = omp_get_max_threads();
     _num_threads                 = (num_threads == 0) ? num_cores : num_threads;
+    _counters.resize(_num_threads);
 }
 
 void OMPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
@@ -65,18 +67,60 @@ void OMPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
     const unsigned int num_iterations = max_window.num_iterations(split_dimension);
     info.num_threads                  = std::min(num_iterations, _num_threads);
 
+    SchedulerCounterStorage *counters = active_counters();
+    const auto               start    = counters != nullptr ? SchedulerCounterStorage::clock::now() : SchedulerCounterStorage::clock::time_point();
+
     if(!kernel->is_parallelisable() || info.num_threads == 1)
     {
         kernel->run(max_window, info);
+
+        if(counters != nullptr)
+        {
+            const uint64_t busy_time = SchedulerCounterStorage::elapsed(start, SchedulerCounterStorage::clock::now());
+            counters->record_window(0, busy_time);
+            counters->record_serial_kernel(busy_time);
+        }
     }
     else
     {
+        // Written by the master thread only
+        SchedulerCounterStorage::clock::time_point master_start{};
+        SchedulerCounterStorage::clock::time_point master_end{};
+
         #pragma omp parallel firstprivate(info) num_threads(info.num_threads)
         {
             const int tid  = omp_get_thread_num();
             Window win     = max_window.split_window(split_dimension, tid, info.num_threads);
             info.thread_id = tid;
-            kernel->run(win, info);
+
+            if(counters == nullptr)
+            {
+                kernel->run(win, info);
+            }
+            else
+            {
+                const auto run_start = SchedulerCounterStorage::clock::now();
+                kernel->run(win, info);
+                const auto run_end = SchedulerCounterStorage::clock::now();
+
+                counters->record_window(tid, SchedulerCounterStorage::elapsed(run_start, run_end));
+                if(tid == 0)
+                {
+                    master_start = run_start;
+                    master_end   = run_end;
+                }
+                else
+                {
+                    counters->record_wakeup(tid, SchedulerCounterStorage::elapsed(start, run_start));
+                }
+            }
+        }
+
+        if(counters != nullptr)
+        {
+            const auto end = SchedulerCounterStorage::clock::now();
+            counters->record_parallel_kernel(info.num_threads, SchedulerCounterStorage::elapsed(start, end), SchedulerCounterStorage::elapsed(start, master_start),
+                                             SchedulerCounterStorage::elapsed(master_end, end));
         }
     }
 }
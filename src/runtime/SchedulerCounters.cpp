@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SchedulerCounters.h"
+
+#include "arm_compute/core/Error.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace
+{
+int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(SchedulerCounterStorage::clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+SchedulerCounterStorage::SchedulerCounterStorage()
+    : _kernels(0), _serial_kernels(0), _windows(0), _schedule_time(0), _dispatch_time(0), _wait_time(0), _reset_time(now()), _slots(), _num_slots(0)
+{
+}
+
+void SchedulerCounterStorage::resize(unsigned int num_threads)
+{
+    _slots     = support::cpp14::make_unique<ThreadSlot[]>(num_threads);
+    _num_slots = num_threads;
+    reset();
+}
+
+void SchedulerCounterStorage::reset()
+{
+    _kernels.store(0, std::memory_order_relaxed);
+    _serial_kernels.store(0, std::memory_order_relaxed);
+    _windows.store(0, std::memory_order_relaxed);
+    _schedule_time.store(0, std::memory_order_relaxed);
+    _dispatch_time.store(0, std::memory_order_relaxed);
+    _wait_time.store(0, std::memory_order_relaxed);
+
+    for(unsigned int i = 0; i < _num_slots; ++i)
+    {
+        ThreadSlot &slot = _slots[i];
+        slot.windows.store(0, std::memory_order_relaxed);
+        slot.busy_time.store(0, std::memory_order_relaxed);
+        slot.wakeups.store(0, std::memory_order_relaxed);
+        slot.wakeup_latency.store(0, std::memory_order_relaxed);
+        slot.max_wakeup_latency.store(0, std::memory_order_relaxed);
+    }
+
+    _reset_time.store(now(), std::memory_order_relaxed);
+}
+
+SchedulerCounters SchedulerCounterStorage::snapshot() const
+{
+    SchedulerCounters counters;
+    counters.kernels        = _kernels.load(std::memory_order_relaxed);
+    counters.serial_kernels = _serial_kernels.load(std::memory_order_relaxed);
+    counters.windows        = _windows.load(std::memory_order_relaxed);
+    counters.schedule_time  = _schedule_time.load(std::memory_order_relaxed);
+    counters.dispatch_time  = _dispatch_time.load(std::memory_order_relaxed);
+    counters.wait_time      = _wait_time.load(std::memory_order_relaxed);
+    counters.elapsed_time   = static_cast<uint64_t>(std::max<int64_t>(0, now() - _reset_time.load(std::memory_order_relaxed)));
+
+    counters.threads.resize(_num_slots);
+    for(unsigned int i = 0; i < _num_slots; ++i)
+    {
+        const ThreadSlot &slot = _slots[i];
+
+        counters.threads[i].windows            = slot.windows.load(std::memory_order_relaxed);
+        counters.threads[i].busy_time          = slot.busy_time.load(std::memory_order_relaxed);
+        counters.threads[i].wakeups            = slot.wakeups.load(std::memory_order_relaxed);
+        counters.threads[i].wakeup_latency     = slot.wakeup_latency.load(std::memory_order_relaxed);
+        counters.threads[i].max_wakeup_latency = slot.max_wakeup_latency.load(std::memory_order_relaxed);
+    }
+
+    return counters;
+}
+
+void SchedulerCounterStorage::record_serial_kernel(uint64_t schedule_time)
+{
+    _kernels.fetch_add(1, std::memory_order_relaxed);
+    _serial_kernels.fetch_add(1, std::memory_order_relaxed);
+    _windows.fetch_add(1, std::memory_order_relaxed);
+    _schedule_time.fetch_add(schedule_time, std::memory_order_relaxed);
+}
+
+void SchedulerCounterStorage::record_parallel_kernel(unsigned int num_windows, uint64_t schedule_time, uint64_t dispatch_time, uint64_t wait_time)
+{
+    _kernels.fetch_add(1, std::memory_order_relaxed);
+    _windows.fetch_add(num_windows, std::memory_order_relaxed);
+    _schedule_time.fetch_add(schedule_time, std::memory_order_relaxed);
+    _dispatch_time.fetch_add(dispatch_time, std::memory_order_relaxed);
+    _wait_time.fetch_add(wait_time, std::memory_order_relaxed);
+}
+
+void SchedulerCounterStorage::record_window(unsigned int thread_id, uint64_t busy_time)
+{
+    ARM_COMPUTE_ERROR_ON(thread_id >= _num_slots);
+
+    ThreadSlot &slot = _slots[thread_id];
+    slot.windows.fetch_add(1, std::memory_order_relaxed);
+    slot.busy_time.fetch_add(busy_time, std::memory_order_relaxed);
+}
+
+void SchedulerCounterStorage::record_wakeup(unsigned int thread_id, uint64_t latency)
+{
+    ARM_COMPUTE_ERROR_ON(thread_id >= _num_slots);
+
+    ThreadSlot &slot = _slots[thread_id];
+    slot.wakeups.fetch_add(1, std::memory_order_relaxed);
+    slot.wakeup_latency.fetch_add(latency, std::memory_order_relaxed);
+
+    // Only the owning thread writes to its slot, so a plain load / store is enough to keep the maximum
+    if(latency > slot.max_wakeup_latency.load(std::memory_order_relaxed))
+    {
+        slot.max_wakeup_latency.store(latency, std::memory_order_relaxed);
+    }
+}
+} // namespace arm_compute
@@ -30,6 +30,7 @@
 #include "support/ToolchainSupport.h"
 
 #include <cstddef>
+#include <cstdint>
 
 using namespace arm_compute;
 
@@ -162,6 +163,18 @@ arm_compute::Status TensorAllocator::import_memory(Memory memory)
     return Status{};
 }
 
+arm_compute::Status TensorAllocator::import_memory(void *memory, size_t size)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(memory == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_memory.buffer() != nullptr, "The tensor already has backing memory");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info().total_size() == 0, "The tensor info must be initialised before importing memory");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(size < info().total_size(), "The memory is smaller than the tensor");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((reinterpret_cast<uintptr_t>(memory) % info().element_size()) != 0, "The memory is not aligned to the element size");
+
+    return import_memory(Memory(static_cast<uint8_t *>(memory)));
+}
+
 void TensorAllocator::set_associated_memory_group(MemoryGroup *associated_memory_group)
 {
     ARM_COMPUTE_ERROR_ON(associated_memory_group == nullptr);
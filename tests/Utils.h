@@ -676,6 +676,18 @@ inline void sync_tensor_if_necessary(TensorType &tensor)
     }
 #endif /* ARM_COMPUTE_GC */
 }
+
+/** Number of bytes of the elements of a tensor, padding excluded.
+ *
+ * @param[in] tensor Tensor.
+ *
+ * @return Size of the elements in bytes.
+ */
+template <typename TensorType>
+inline uint64_t num_bytes(const TensorType &tensor)
+{
+    return static_cast<uint64_t>(tensor.info()->tensor_shape().total_size()) * tensor.info()->element_size();
+}
 } // namespace test
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_TEST_UTILS_H__ */
@@ -75,6 +75,14 @@ REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV4WinogradLayer, NEWinogradLay
 REGISTER_FIXTURE_DATA_TEST_CASE(SqueezeNetWinogradLayer, NEWinogradLayerFixture, framework::DatasetMode::ALL,
                                 framework::dataset::combine(framework::dataset::combine(datasets::SqueezeNetWinogradLayerDataset(), framework::dataset::make("DataType", DataType::F32)),
                                                             framework::dataset::make("Batches", 1)));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16WinogradLayer, NEWinogradLayerFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(datasets::VGG16WinogradLayerDataset(), framework::dataset::make("DataType", DataType::F32)),
+                                                            framework::dataset::make("Batches", 1)));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(YOLOV2WinogradLayer, NEWinogradLayerFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(datasets::YOLOV2WinogradLayerDataset(), framework::dataset::make("DataType", DataType::F32)),
+                                                            framework::dataset::make("Batches", 1)));
 #endif /* __aarch64__ */
 
 REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::ALL,
@@ -143,6 +151,15 @@ REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV4WinogradLayer, NEWinogradLay
 REGISTER_FIXTURE_DATA_TEST_CASE(SqueezeNetWinogradLayer, NEWinogradLayerFixture, framework::DatasetMode::NIGHTLY,
                                 framework::dataset::combine(framework::dataset::combine(datasets::SqueezeNetWinogradLayerDataset(), framework::dataset::make("DataType", DataType::F32)),
                                                             framework::dataset::make("Batches", { 4, 8 })));
+
+// 8 batches use about 2GB of memory which is too much for most devices!
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16WinogradLayer, NEWinogradLayerFixture, framework::DatasetMode::NIGHTLY,
+                                framework::dataset::combine(framework::dataset::combine(datasets::VGG16WinogradLayerDataset(), framework::dataset::make("DataType", DataType::F32)),
+                                                            framework::dataset::make("Batches", { 2 })));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(YOLOV2WinogradLayer, NEWinogradLayerFixture, framework::DatasetMode::NIGHTLY,
+                                framework::dataset::combine(framework::dataset::combine(datasets::YOLOV2WinogradLayerDataset(), framework::dataset::make("DataType", DataType::F32)),
+                                                            framework::dataset::make("Batches", { 4, 8 })));
 #endif /* __aarch64__ */
 
 TEST_SUITE_END()
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
+#include "arm_compute/runtime/Pyramid.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/GaussianPyramidFixture.h"
+#include "tests/datasets/BorderModeDataset.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto num_levels = framework::dataset::make("NumLevels", { 2, 4 });
+} // namespace
+
+using NEGaussianPyramidHalfFixture = GaussianPyramidFixture<Tensor, NEGaussianPyramidHalf, Accessor, Pyramid>;
+using NEGaussianPyramidOrbFixture  = GaussianPyramidFixture<Tensor, NEGaussianPyramidOrb, Accessor, Pyramid>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(GaussianPyramid)
+
+TEST_SUITE(Half)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEGaussianPyramidHalfFixture, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallImageShapes(), datasets::BorderModes()), num_levels),
+                                                                                                           framework::dataset::make("Scale", { SCALE_PYRAMID_HALF })));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEGaussianPyramidHalfFixture, framework::DatasetMode::NIGHTLY, combine(combine(combine(datasets::LargeImageShapes(), datasets::BorderModes()), num_levels),
+                                                                                                         framework::dataset::make("Scale", { SCALE_PYRAMID_HALF })));
+TEST_SUITE_END() // Half
+
+TEST_SUITE(Orb)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEGaussianPyramidOrbFixture, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallImageShapes(), datasets::BorderModes()), num_levels),
+                                                                                                          framework::dataset::make("Scale", { SCALE_PYRAMID_ORB })));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEGaussianPyramidOrbFixture, framework::DatasetMode::NIGHTLY, combine(combine(combine(datasets::LargeImageShapes(), datasets::BorderModes()), num_levels),
+                                                                                                        framework::dataset::make("Scale", { SCALE_PYRAMID_ORB })));
+TEST_SUITE_END() // Orb
+TEST_SUITE_END() // GaussianPyramid
+TEST_SUITE_END() // NEON
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Distribution1D.h"
+#include "arm_compute/runtime/NEON/functions/NEHistogram.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/HistogramFixture.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+// Full U8 range with one bin per value, and a coarse histogram over a sub-range
+const auto histogram_configs = zip(zip(framework::dataset::make("NumBins", { 256, 16 }),
+                                       framework::dataset::make("Offset", { 0, 16 })),
+                                   framework::dataset::make("Range", { 256, 224 }));
+} // namespace
+
+using NEHistogramFixture = HistogramFixture<Tensor, NEHistogram, Accessor, Distribution1D>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(Histogram)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEHistogramFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallImageShapes(), histogram_configs));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEHistogramFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LargeImageShapes(), histogram_configs));
+TEST_SUITE_END() // Histogram
+TEST_SUITE_END() // NEON
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -70,6 +70,14 @@ public:
         sync_tensor_if_necessary<TensorType>(dst);
     }
 
+    framework::Workload workload() const
+    {
+        framework::Workload workload;
+        workload.flops = src.info()->tensor_shape().total_size();
+        workload.bytes = num_bytes(src) + num_bytes(dst);
+        return workload;
+    }
+
     void teardown()
     {
         src.allocator()->free();
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_COLOR_CONVERT_FIXTURE
+#define ARM_COMPUTE_TEST_COLOR_CONVERT_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture converting an image between two formats, each of which can be single or multi planar */
+template <typename TensorType, typename MultiImageType, typename Function, typename Accessor>
+class ColorConvertFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, Format src_format, Format dst_format)
+    {
+        src_is_multi_planar = num_planes_from_format(src_format) > 1;
+        dst_is_multi_planar = num_planes_from_format(dst_format) > 1;
+
+        // Create images
+        if(src_is_multi_planar)
+        {
+            src_multi.init(shape.x(), shape.y(), src_format);
+        }
+        else
+        {
+            src = create_tensor<TensorType>(shape, src_format);
+        }
+
+        if(dst_is_multi_planar)
+        {
+            dst_multi.init(shape.x(), shape.y(), dst_format);
+        }
+        else
+        {
+            dst = create_tensor<TensorType>(shape, dst_format);
+        }
+
+        // Create and configure function
+        if(src_is_multi_planar && dst_is_multi_planar)
+        {
+            color_convert_func.configure(&src_multi, &dst_multi);
+        }
+        else if(src_is_multi_planar)
+        {
+            color_convert_func.configure(&src_multi, &dst);
+        }
+        else if(dst_is_multi_planar)
+        {
+            color_convert_func.configure(&src, &dst_multi);
+        }
+        else
+        {
+            color_convert_func.configure(&src, &dst);
+        }
+
+        // Allocate images
+        if(src_is_multi_planar)
+        {
+            src_multi.allocate();
+        }
+        else
+        {
+            src.allocator()->allocate();
+        }
+
+        if(dst_is_multi_planar)
+        {
+            dst_multi.allocate();
+        }
+        else
+        {
+            dst.allocator()->allocate();
+        }
+    }
+
+    void run()
+    {
+        color_convert_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+    }
+
+    void teardown()
+    {
+        if(!src_is_multi_planar)
+        {
+            src.allocator()->free();
+        }
+
+        if(!dst_is_multi_planar)
+        {
+            dst.allocator()->free();
+        }
+    }
+
+private:
+    TensorType     src{};
+    TensorType     dst{};
+    MultiImageType src_multi{};
+    MultiImageType dst_multi{};
+    bool           src_is_multi_planar{ false };
+    bool           dst_is_multi_planar{ false };
+    Function       color_convert_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_COLOR_CONVERT_FIXTURE */
@@ -74,6 +74,16 @@ public:
         sync_tensor_if_necessary<TensorType>(dst);
     }
 
+    framework::Workload workload() const
+    {
+        // One multiply-accumulate per weight of the channel for each output element
+        const TensorShape  &weights_shape = weights.info()->tensor_shape();
+        framework::Workload workload;
+        workload.flops = 2 * static_cast<uint64_t>(weights_shape[0] * weights_shape[1]) * dst.info()->tensor_shape().total_size();
+        workload.bytes = num_bytes(src) + num_bytes(weights) + num_bytes(biases) + num_bytes(dst);
+        return workload;
+    }
+
     void teardown()
     {
         src.allocator()->free();
@@ -74,6 +74,16 @@ public:
         sync_tensor_if_necessary<TensorType>(dst);
     }
 
+    framework::Workload workload() const
+    {
+        // The batches are along the second dimension of the output
+        const uint64_t      num_inputs = src.info()->tensor_shape().total_size() / dst.info()->dimension(1);
+        framework::Workload workload;
+        workload.flops = 2 * num_inputs * dst.info()->tensor_shape().total_size();
+        workload.bytes = num_bytes(src) + num_bytes(weights) + num_bytes(biases) + num_bytes(dst);
+        return workload;
+    }
+
     void teardown()
     {
         src.allocator()->free();
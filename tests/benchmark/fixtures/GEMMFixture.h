@@ -71,6 +71,14 @@ public:
         sync_tensor_if_necessary<TensorType>(dst);
     }
 
+    framework::Workload workload() const
+    {
+        framework::Workload workload;
+        workload.flops = 2 * static_cast<uint64_t>(a.info()->dimension(0)) * dst.info()->tensor_shape().total_size();
+        workload.bytes = num_bytes(a) + num_bytes(b) + num_bytes(c) + num_bytes(dst);
+        return workload;
+    }
+
     void teardown()
     {
         a.allocator()->free();
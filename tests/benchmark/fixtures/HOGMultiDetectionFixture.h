@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_HOG_MULTI_DETECTION_FIXTURE
+#define ARM_COMPUTE_TEST_HOG_MULTI_DETECTION_FIXTURE
+
+#include "arm_compute/core/HOGInfo.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "support/ToolchainSupport.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture detecting objects with several HOG models sharing the same cell size
+ *
+ * The models use the cell, block and bins of the given HOG info with detection windows of decreasing size,
+ * which lets the function compute the HOG descriptor once and run one detector per model.
+ */
+template <typename TensorType, typename Function, typename Accessor, typename HOGType, typename MultiHOGType, typename DetectionWindowArrayType, typename Size2DArrayType>
+class HOGMultiDetectionFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(std::string image, HOGInfo hog_info, Format format, BorderMode border_mode, bool non_maxima_suppression)
+    {
+        // Detection windows of the models, in descending order of size
+        const std::vector<Size2D> windows{ hog_info.detection_window_size(), Size2D(48U, 96U), Size2D(32U, 64U) };
+
+        // Load the image (cached by the library if loaded before)
+        const RawTensor &raw = library->get(image, format);
+
+        // Create the HOG models with random weights
+        std::mt19937                          generator(library->seed());
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+        multi_hog      = support::cpp14::make_unique<MultiHOGType>(windows.size());
+        window_strides = Size2DArrayType(windows.size());
+        for(size_t i = 0; i < windows.size(); ++i)
+        {
+            const HOGInfo model_info(hog_info.cell_size(), hog_info.block_size(), windows[i], hog_info.block_stride(), hog_info.num_bins(),
+                                     hog_info.normalization_type(), hog_info.l2_hyst_threshold(), hog_info.phase_type());
+
+            auto *model = static_cast<HOGType *>(multi_hog->model(i));
+            model->init(model_info);
+            std::generate_n(model->descriptor(), model_info.descriptor_size(), [&]()
+            {
+                return distribution(generator);
+            });
+
+            window_strides.push_back(hog_info.block_stride());
+        }
+
+        // Create tensors
+        src = create_tensor<TensorType>(raw.shape(), format);
+
+        // Create and configure function
+        hog_multi_detection_func.configure(&src, multi_hog.get(), &detection_windows, &window_strides, border_mode, 0, 0.f, non_maxima_suppression);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+
+        // Copy image data to tensor
+        library->fill(Accessor(src), raw);
+    }
+
+    void run()
+    {
+        hog_multi_detection_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+    }
+
+private:
+    static constexpr size_t max_num_detection_windows = 1000;
+
+    TensorType                    src{};
+    std::unique_ptr<MultiHOGType> multi_hog{};
+    DetectionWindowArrayType      detection_windows{ max_num_detection_windows };
+    Size2DArrayType               window_strides{};
+    Function                      hog_multi_detection_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_HOG_MULTI_DETECTION_FIXTURE */
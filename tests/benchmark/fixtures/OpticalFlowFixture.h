@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_OPTICAL_FLOW_FIXTURE
+#define ARM_COMPUTE_TEST_OPTICAL_FLOW_FIXTURE
+
+#include "arm_compute/core/PyramidInfo.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture tracking a grid of key points between two pyramids built from the same image
+ *
+ * The initial estimates are shifted by a few pixels so that every key point goes through the iterations of the Lucas-Kanade tracker.
+ */
+template <typename TensorType, typename Function, typename Accessor, typename ArrayType, typename PyramidType, typename PyramidFunction>
+class OpticalFlowFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(std::string image, size_t num_levels, size_t window_dimension, unsigned int num_iterations, BorderMode border_mode)
+    {
+        constexpr int grid_step = 16;
+        constexpr int shift     = 2;
+
+        // Load the image (cached by the library if loaded before)
+        const RawTensor &raw = library->get(image, Format::U8);
+
+        // Create tensors
+        src = create_tensor<TensorType>(raw.shape(), Format::U8);
+
+        const PyramidInfo pyramid_info(num_levels, SCALE_PYRAMID_HALF, raw.shape(), Format::U8);
+        old_pyramid.init(pyramid_info);
+        new_pyramid.init(pyramid_info);
+
+        // Create key points on a regular grid, away from the borders
+        const int border     = static_cast<int>(window_dimension) + shift;
+        const int num_points = ((raw.shape().x() - 2 * border) / grid_step + 1) * ((raw.shape().y() - 2 * border) / grid_step + 1);
+
+        old_points           = ArrayType(num_points);
+        new_points_estimates = ArrayType(num_points);
+        new_points           = ArrayType(num_points);
+
+        for(int y = border; y <= static_cast<int>(raw.shape().y()) - border; y += grid_step)
+        {
+            for(int x = border; x <= static_cast<int>(raw.shape().x()) - border; x += grid_step)
+            {
+                KeyPoint point;
+                point.x               = x;
+                point.y               = y;
+                point.tracking_status = 1;
+                old_points.push_back(point);
+
+                point.x += shift;
+                point.y += shift;
+                new_points_estimates.push_back(point);
+            }
+        }
+
+        // Create and configure functions
+        old_pyramid_func.configure(&src, &old_pyramid, border_mode, 0);
+        new_pyramid_func.configure(&src, &new_pyramid, border_mode, 0);
+        optical_flow_func.configure(&old_pyramid, &new_pyramid, &old_points, &new_points_estimates, &new_points,
+                                    Termination::TERM_CRITERIA_BOTH, 0.01f, num_iterations, window_dimension, true, border_mode, 0);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        old_pyramid.allocate();
+        new_pyramid.allocate();
+
+        // Copy image data to tensor and build the pyramids
+        library->fill(Accessor(src), raw);
+        old_pyramid_func.run();
+        new_pyramid_func.run();
+    }
+
+    void run()
+    {
+        optical_flow_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+    }
+
+private:
+    TensorType      src{};
+    PyramidType     old_pyramid{};
+    PyramidType     new_pyramid{};
+    ArrayType       old_points{};
+    ArrayType       new_points_estimates{};
+    ArrayType       new_points{};
+    PyramidFunction old_pyramid_func{};
+    PyramidFunction new_pyramid_func{};
+    Function        optical_flow_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_OPTICAL_FLOW_FIXTURE */
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#define BENCHMARK_EXAMPLES
+#include "utils/Utils.cpp"
+
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/DatasetModes.h"
+#include "tests/framework/Framework.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/TestCase.h"
+#include "tests/framework/command_line/CommandLineOptions.h"
+#include "tests/framework/command_line/CommandLineParser.h"
+#include "tests/framework/command_line/CommonOptions.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/instruments/Instruments.h"
+#include "tests/framework/printers/Printers.h"
+
+#ifdef ARM_COMPUTE_CL
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#endif /* ARM_COMPUTE_CL */
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace arm_compute
+{
+namespace utils
+{
+namespace
+{
+ExampleFactory      g_example_factory = nullptr;
+std::vector<char *> g_example_argv{};
+
+/** Benchmark case running an example with a given number of threads
+ *
+ * A new instance of the example is configured for every case because NEON
+ * functions may size their workspace according to the number of threads.
+ */
+class ExampleTest : public framework::DataTestCase<std::tuple<int>>
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data Number of threads to use
+     */
+    explicit ExampleTest(std::tuple<int> data)
+        : DataTestCase{ std::move(data) }, _example()
+    {
+    }
+    void do_setup() override
+    {
+        Scheduler::get().set_num_threads(std::get<0>(_data));
+
+        _example = g_example_factory();
+        _example->do_setup(g_example_argv.size(), g_example_argv.data());
+    }
+    void do_run() override
+    {
+        _example->do_run();
+    }
+    void do_sync() override
+    {
+#ifdef ARM_COMPUTE_CL
+        if(opencl_is_available())
+        {
+            CLScheduler::get().sync();
+        }
+#endif /* ARM_COMPUTE_CL */
+    }
+    void do_teardown() override
+    {
+        _example->do_teardown();
+        _example.reset();
+    }
+
+private:
+    std::unique_ptr<Example> _example;
+};
+} // namespace
+
+int run_example(int argc, char **argv, ExampleFactory factory)
+{
+    framework::CommandLineParser parser;
+    framework::CommonOptions     options(parser);
+
+    auto thread_counts = parser.add_option<framework::ListOption<int>>("thread-counts");
+    thread_counts->set_help("List of thread counts to run the example with (Defaults to the value of --threads)");
+    auto example_args = parser.add_option<framework::ListOption<std::string>>("example_args");
+    example_args->set_help("Arguments to pass to the example separated by commas, e.g. --example_args=0,path_to_data (Defaults to NEON with random weights)");
+
+    parser.parse(argc, argv);
+
+    if(options.help->is_set() && options.help->value())
+    {
+        parser.print_help(argv[0]);
+        return 0;
+    }
+
+    if(!parser.validate())
+    {
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<framework::Printer>> printers = options.create_printers();
+
+    std::vector<int> threads = thread_counts->value();
+    if(threads.empty())
+    {
+        threads.push_back(options.threads->value());
+    }
+
+    // Keep the arguments alive for the whole run as the examples parse them during their setup
+    std::vector<std::string> args = example_args->value();
+    g_example_factory             = factory;
+    g_example_argv.clear();
+    g_example_argv.push_back(argv[0]);
+    for(auto &arg : args)
+    {
+        g_example_argv.push_back(&arg[0]);
+    }
+
+    if(options.log_level->value() > framework::LogLevel::NONE)
+    {
+        for(auto &p : printers)
+        {
+            p->print_global_header();
+        }
+    }
+
+    if(options.log_level->value() >= framework::LogLevel::CONFIG)
+    {
+        for(auto &p : printers)
+        {
+            p->print_entry("Version", build_information());
+            p->print_entry("Example", argv[0]);
+            p->print_entry("Iterations", support::cpp11::to_string(options.iterations->value()));
+            p->print_entry("Warmup iterations", support::cpp11::to_string(options.warmup->value()));
+            if(options.confidence_target->value() > 0.0)
+            {
+                p->print_entry("Confidence target", framework::arithmetic_to_string(options.confidence_target->value(), 2) + " %");
+                p->print_entry("Max iterations", support::cpp11::to_string(options.max_iterations->value()));
+            }
+            if(options.outlier_threshold->value() > 0.0)
+            {
+                p->print_entry("Outlier threshold", framework::arithmetic_to_string(options.outlier_threshold->value(), 2) + " MAD");
+            }
+        }
+    }
+
+    framework::Framework &framework = framework::Framework::get();
+
+    {
+        using ExampleRegistrar = framework::detail::TestCaseRegistrar<ExampleTest>;
+
+        framework::detail::TestSuiteRegistrar suite("Examples");
+        ExampleRegistrar                      test_case(argv[0], framework::DatasetMode::ALL, framework::TestCaseFactory::Status::ACTIVE, framework::dataset::make("Threads", std::move(threads)));
+        framework::detail::TestSuiteRegistrar suite_end;
+    }
+
+    framework.init(options.instruments->value(), options.iterations->value(), framework::DatasetMode::ALL, "", "", options.log_level->value());
+    for(auto &p : printers)
+    {
+        framework.add_printer(p.get());
+    }
+    framework.set_throw_errors(options.throw_errors->value());
+    framework.set_num_warmup_iterations(options.warmup->value());
+    framework.set_adaptive_iterations(options.confidence_target->value() / 100.0, options.max_iterations->value());
+    framework.set_outlier_threshold(options.outlier_threshold->value());
+
+    const bool success = framework.run();
+
+    if(options.log_level->value() > framework::LogLevel::NONE)
+    {
+        for(auto &p : printers)
+        {
+            p->print_global_footer();
+        }
+    }
+
+    return (success ? 0 : 1);
+}
+} // namespace utils
+} // namespace arm_compute
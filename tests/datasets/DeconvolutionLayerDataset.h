@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_DECONVOLUTION_LAYER_DATASET
+#define ARM_COMPUTE_TEST_DECONVOLUTION_LAYER_DATASET
+
+#include "tests/datasets/ConvolutionLayerDataset.h"
+
+#include "utils/TypePrinter.h"
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace datasets
+{
+/** Upsampling layers of FCN-8s (Semantic segmentation, 21 classes) */
+class FCN8sDeconvolutionLayerDataset final : public ConvolutionLayerDataset
+{
+public:
+    FCN8sDeconvolutionLayerDataset()
+    {
+        // upscore2
+        add_config(TensorShape(16U, 16U, 21U), TensorShape(4U, 4U, 21U, 21U), TensorShape(21U), TensorShape(32U, 32U, 21U), PadStrideInfo(2, 2, 2, 2, DimensionRoundingType::CEIL));
+        // upscore_pool4
+        add_config(TensorShape(32U, 32U, 21U), TensorShape(4U, 4U, 21U, 21U), TensorShape(21U), TensorShape(64U, 64U, 21U), PadStrideInfo(2, 2, 2, 2, DimensionRoundingType::CEIL));
+        // upscore8
+        add_config(TensorShape(64U, 64U, 21U), TensorShape(16U, 16U, 21U, 21U), TensorShape(21U), TensorShape(512U, 512U, 21U), PadStrideInfo(8, 8, 11, 11, DimensionRoundingType::CEIL));
+    }
+};
+
+/** Decoder layers upsampling feature maps by a factor of 2, as found in encoder-decoder networks (e.g. DCGAN, U-Net) */
+class Upsample2xDeconvolutionLayerDataset final : public ConvolutionLayerDataset
+{
+public:
+    Upsample2xDeconvolutionLayerDataset()
+    {
+        add_config(TensorShape(4U, 4U, 1024U), TensorShape(4U, 4U, 1024U, 512U), TensorShape(512U), TensorShape(8U, 8U, 512U), PadStrideInfo(2, 2, 2, 2, DimensionRoundingType::CEIL));
+        add_config(TensorShape(8U, 8U, 512U), TensorShape(4U, 4U, 512U, 256U), TensorShape(256U), TensorShape(16U, 16U, 256U), PadStrideInfo(2, 2, 2, 2, DimensionRoundingType::CEIL));
+        add_config(TensorShape(16U, 16U, 256U), TensorShape(4U, 4U, 256U, 128U), TensorShape(128U), TensorShape(32U, 32U, 128U), PadStrideInfo(2, 2, 2, 2, DimensionRoundingType::CEIL));
+        add_config(TensorShape(32U, 32U, 128U), TensorShape(4U, 4U, 128U, 64U), TensorShape(64U), TensorShape(64U, 64U, 64U), PadStrideInfo(2, 2, 2, 2, DimensionRoundingType::CEIL));
+        add_config(TensorShape(64U, 64U, 64U), TensorShape(4U, 4U, 64U, 3U), TensorShape(3U), TensorShape(128U, 128U, 3U), PadStrideInfo(2, 2, 2, 2, DimensionRoundingType::CEIL));
+    }
+};
+} // namespace datasets
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_DECONVOLUTION_LAYER_DATASET */
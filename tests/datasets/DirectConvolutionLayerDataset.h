@@ -53,6 +53,21 @@ public:
         add_config(TensorShape(13U, 13U, 384U), TensorShape(3U, 3U, 384U, 5U), TensorShape(5U), TensorShape(12U, 12U, 5U), PadStrideInfo(1, 1, 1, 0, 1, 0, DimensionRoundingType::FLOOR));
     }
 };
+
+/** Kernel shapes and strides served by the generic NxM direct convolution: 7x7 stems, factorised 1xN/Nx1 kernels and strides larger than 3. */
+class DirectConvolutionLayerNxMDataset final : public ConvolutionLayerDataset
+{
+public:
+    DirectConvolutionLayerNxMDataset()
+    {
+        add_config(TensorShape(32U, 32U, 3U), TensorShape(7U, 7U, 3U, 4U), TensorShape(4U), TensorShape(16U, 16U, 4U), PadStrideInfo(2, 2, 3, 3));
+        add_config(TensorShape(17U, 17U, 8U), TensorShape(1U, 7U, 8U, 4U), TensorShape(4U), TensorShape(17U, 17U, 4U), PadStrideInfo(1, 1, 0, 3));
+        add_config(TensorShape(17U, 17U, 8U), TensorShape(7U, 1U, 8U, 4U), TensorShape(4U), TensorShape(17U, 17U, 4U), PadStrideInfo(1, 1, 3, 0));
+        add_config(TensorShape(17U, 17U, 8U), TensorShape(1U, 3U, 8U, 2U), TensorShape(2U), TensorShape(17U, 17U, 2U), PadStrideInfo(1, 1, 0, 1));
+        add_config(TensorShape(27U, 27U, 4U), TensorShape(3U, 3U, 4U, 2U), TensorShape(2U), TensorShape(7U, 7U, 2U), PadStrideInfo(4, 4, 1, 1));
+        add_config(TensorShape(23U, 19U, 5U), TensorShape(5U, 3U, 5U, 3U), TensorShape(3U), TensorShape(23U, 10U, 3U), PadStrideInfo(1, 2, 2, 1));
+    }
+};
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
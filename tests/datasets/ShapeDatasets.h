@@ -516,7 +516,8 @@ public:
     {
         TensorShape{ 1920U, 1080U },
                      TensorShape{ 2560U, 1536U },
-                     TensorShape{ 3584U, 2048U }
+                     TensorShape{ 3584U, 2048U },
+                     TensorShape{ 3840U, 2160U }
     })
     {
     }
@@ -55,6 +55,25 @@ public:
     }
 };
 
+/** Convolutions whose input and output feature maps are multiples of 4, so that they can be split into 1, 2 or 4 groups.
+ *
+ * @note The depth of the weights is the full input depth, it has to be divided by the number of groups.
+ */
+class SmallGroupedConvolutionLayerDataset final : public ConvolutionLayerDataset
+{
+public:
+    SmallGroupedConvolutionLayerDataset()
+    {
+        // Batch size 1
+        add_config(TensorShape(23U, 27U, 8U), TensorShape(3U, 3U, 8U, 16U), TensorShape(16U), TensorShape(21U, 25U, 16U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(17U, 31U, 12U), TensorShape(3U, 3U, 12U, 24U), TensorShape(24U), TensorShape(9U, 16U, 24U), PadStrideInfo(2, 2, 1, 1));
+        add_config(TensorShape(33U, 27U, 16U), TensorShape(5U, 3U, 16U, 32U), TensorShape(32U), TensorShape(11U, 13U, 32U), PadStrideInfo(3, 2, 1, 0));
+        add_config(TensorShape(13U, 13U, 16U), TensorShape(1U, 1U, 16U, 8U), TensorShape(8U), TensorShape(13U, 13U, 8U), PadStrideInfo(1, 1, 0, 0));
+        // Batch size 3
+        add_config(TensorShape(13U, 11U, 8U, 3U), TensorShape(3U, 3U, 8U, 12U), TensorShape(12U), TensorShape(13U, 11U, 12U, 3U), PadStrideInfo(1, 1, 1, 1));
+    }
+};
+
 class SmallConvolutionLayerDataset final : public ConvolutionLayerDataset
 {
 public:
@@ -24,6 +24,8 @@
 #ifndef ARM_COMPUTE_TEST_FIXTURE
 #define ARM_COMPUTE_TEST_FIXTURE
 
+#include "Workload.h"
+
 namespace arm_compute
 {
 namespace test
@@ -53,6 +55,18 @@ public:
      */
     void teardown() {};
 
+    /** Workload function.
+     *
+     * Benchmark fixtures can hide this function to report the number of
+     * operations and bytes of one run. It is invoked after setup.
+     *
+     * @return Work done by one call to run.
+     */
+    Workload workload() const
+    {
+        return Workload{};
+    }
+
 protected:
     Fixture()          = default;
     virtual ~Fixture() = default;
@@ -23,6 +23,8 @@
  */
 #include "Framework.h"
 
+#include "arm_compute/runtime/Scheduler.h"
+#include "instruments/InstrumentsStats.h"
 #include "support/ToolchainSupport.h"
 
 #include <chrono>
@@ -48,6 +50,18 @@ Framework::Framework()
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::NONE), Instrument::make_instrument<PMUCounter, ScaleFactor::NONE>);
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1K), Instrument::make_instrument<PMUCounter, ScaleFactor::SCALE_1K>);
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1M), Instrument::make_instrument<PMUCounter, ScaleFactor::SCALE_1M>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CACHE, ScaleFactor::NONE),
+                                   Instrument::make_instrument<PMUGroupCounterInstance<PMUEventGroup::CACHE, false>, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_TLB, ScaleFactor::NONE),
+                                   Instrument::make_instrument<PMUGroupCounterInstance<PMUEventGroup::TLB, false>, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_STALLS, ScaleFactor::NONE),
+                                   Instrument::make_instrument<PMUGroupCounterInstance<PMUEventGroup::STALLS, false>, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CACHE_PER_KERNEL, ScaleFactor::NONE),
+                                   Instrument::make_instrument<PMUGroupCounterInstance<PMUEventGroup::CACHE, true>, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_TLB_PER_KERNEL, ScaleFactor::NONE),
+                                   Instrument::make_instrument<PMUGroupCounterInstance<PMUEventGroup::TLB, true>, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_STALLS_PER_KERNEL, ScaleFactor::NONE),
+                                   Instrument::make_instrument<PMUGroupCounterInstance<PMUEventGroup::STALLS, true>, ScaleFactor::NONE>);
 #endif /* PMU_ENABLED */
 #ifdef MALI_ENABLED
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::NONE), Instrument::make_instrument<MaliCounter, ScaleFactor::NONE>);
@@ -171,9 +185,16 @@ void Framework::log_test_end(const TestInfo &info)
 {
     if(_log_level >= LogLevel::MEASUREMENTS)
     {
+        const TestResult &result = _test_results.at(info);
+
         func_on_all_printers([&](Printer * p)
         {
-            p->print_measurements(_test_results.at(info).measurements);
+            p->print_measurements(result.measurements);
+
+            if(!result.scaling.empty())
+            {
+                p->print_scaling(result.scaling);
+            }
         });
     }
 
@@ -225,6 +246,22 @@ void Framework::set_num_iterations(int num_iterations)
     _num_iterations = num_iterations;
 }
 
+void Framework::set_num_warmup_iterations(int num_iterations)
+{
+    _num_warmup_iterations = num_iterations;
+}
+
+void Framework::set_adaptive_iterations(double confidence_target, int max_iterations)
+{
+    _confidence_target = confidence_target;
+    _max_iterations    = max_iterations;
+}
+
+void Framework::set_outlier_threshold(double threshold)
+{
+    _outlier_threshold = threshold;
+}
+
 void Framework::set_throw_errors(bool throw_errors)
 {
     _throw_errors = throw_errors;
@@ -269,6 +306,11 @@ void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
     Profiler   profiler = get_profiler();
     TestResult result(TestResult::Status::NOT_RUN);
 
+    // Without thread scaling the test runs once with the current number of threads
+    const bool                      thread_scaling = !_scaling_threads.empty();
+    const std::vector<unsigned int> thread_counts  = thread_scaling ? _scaling_threads : std::vector<unsigned int>{ 0 };
+    std::vector<double>             times;
+
     _current_test_info   = &info;
     _current_test_result = &result;
 
@@ -288,29 +330,81 @@ void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
 
         try
         {
-            test_case->do_setup();
-
-            for(int i = 0; i < _num_iterations; ++i)
+            for(unsigned int num_threads : thread_counts)
             {
-                //Start the profiler if:
-                //- there is only one iteration
-                //- it's not the first iteration of a multi-iterations run.
-                //
-                //Reason: if the CLTuner is enabled then the first run will be really messy
-                //as each kernel will be executed several times, messing up the instruments like OpenCL timers.
-                if(_num_iterations == 1 || i != 0)
+                if(thread_scaling)
                 {
-                    profiler.start();
+                    // Functions can depend on the number of threads when they are configured so each thread count gets a new test case
+                    if(!times.empty())
+                    {
+                        test_case = test_factory.make();
+                        profiler  = get_profiler();
+                    }
+
+                    Scheduler::get().set_num_threads(num_threads);
                 }
-                test_case->do_run();
-                test_case->do_sync();
-                if(_num_iterations == 1 || i != 0)
+
+                std::vector<double> iteration_times;
+
+                test_case->do_setup();
+                result.workload = test_case->workload();
+
+                // Always measure at least one iteration
+                const int num_warmup_iterations = std::max(0, std::min(_num_warmup_iterations, _num_iterations - 1));
+                int       num_iterations        = _num_iterations;
+
+                for(int i = 0; i < num_iterations; ++i)
                 {
-                    profiler.stop();
+                    //Don't profile the warmup iterations.
+                    //
+                    //Reason: if the CLTuner is enabled then the first run will be really messy
+                    //as each kernel will be executed several times, messing up the instruments like OpenCL timers.
+                    //Caches, page faults and frequency scaling also make the first iterations slower.
+                    const bool measure = i >= num_warmup_iterations;
+                    if(measure)
+                    {
+                        profiler.start();
+                    }
+                    const auto start = std::chrono::high_resolution_clock::now();
+                    test_case->do_run();
+                    test_case->do_sync();
+                    const auto end = std::chrono::high_resolution_clock::now();
+                    if(measure)
+                    {
+                        profiler.stop();
+                        iteration_times.push_back(std::chrono::duration<double>(end - start).count());
+                    }
+
+                    // Add iterations until the confidence interval is small enough
+                    if(i == num_iterations - 1 && _confidence_target > 0.0 && num_iterations - num_warmup_iterations < _max_iterations && !is_precise_enough(iteration_times))
+                    {
+                        ++num_iterations;
+                    }
                 }
-            }
 
-            test_case->do_teardown();
+                if(_outlier_threshold > 0.0)
+                {
+                    iteration_times = reject_outliers(iteration_times, _outlier_threshold);
+                }
+
+                test_case->do_teardown();
+
+                if(thread_scaling)
+                {
+                    auto median = iteration_times.begin() + iteration_times.size() / 2;
+                    std::nth_element(iteration_times.begin(), median, iteration_times.end());
+                    times.push_back(*median);
+
+                    for(const auto &instrument : filter_measurements(profiler.measurements()))
+                    {
+                        result.measurements.emplace(instrument.first + " (" + support::cpp11::to_string(num_threads) + " threads)", instrument.second);
+                    }
+                }
+                else
+                {
+                    result.measurements = filter_measurements(profiler.measurements());
+                }
+            }
 
             // Change status to success if no error has happend
             if(result.status == TestResult::Status::NOT_RUN)
@@ -487,17 +581,121 @@ void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
         }
     }
 
-    result.measurements = profiler.measurements();
+    if(thread_scaling)
+    {
+        compute_scaling(result, times);
+    }
+    else if(result.measurements.empty())
+    {
+        // The test didn't complete, keep what has been measured
+        result.measurements = profiler.measurements();
+    }
 
     set_test_result(info, result);
     log_test_end(info);
 }
 
+void Framework::compute_scaling(TestResult &result, const std::vector<double> &times) const
+{
+    for(size_t i = 0; i < times.size(); ++i)
+    {
+        if(times[i] <= 0.0)
+        {
+            continue;
+        }
+
+        ScalingPoint point;
+        point.num_threads  = _scaling_threads[i];
+        point.time         = times[i];
+        point.speedup      = times[0] / times[i];
+        point.efficiency   = point.speedup * _scaling_threads[0] / _scaling_threads[i];
+        point.gflops       = result.workload.flops / times[i] * 1e-9;
+        point.gbytes_per_s = result.workload.bytes / times[i] * 1e-9;
+        point.roofline     = _rooflines.at(_scaling_threads[i]);
+
+        if(result.workload.flops != 0 && result.workload.bytes != 0)
+        {
+            const double intensity = static_cast<double>(result.workload.flops) / result.workload.bytes;
+            point.roofline_ratio   = point.gflops / attainable_gflops(point.roofline, intensity);
+        }
+        else if(result.workload.bytes != 0)
+        {
+            // Pure data movement, only the memory roof applies
+            point.roofline_ratio = point.gbytes_per_s / point.roofline.gbytes_per_s;
+        }
+
+        result.scaling.push_back(point);
+    }
+}
+
+bool Framework::is_precise_enough(const std::vector<double> &times) const
+{
+    if(_outlier_threshold > 0.0)
+    {
+        return relative_confidence_interval(reject_outliers(times, _outlier_threshold)) <= _confidence_target;
+    }
+
+    return relative_confidence_interval(times) <= _confidence_target;
+}
+
+Profiler::MeasurementsMap Framework::filter_measurements(const Profiler::MeasurementsMap &measurements)
+{
+    if(_outlier_threshold <= 0.0)
+    {
+        return measurements;
+    }
+
+    Profiler::MeasurementsMap filtered;
+
+    for(const auto &instrument : measurements)
+    {
+        std::vector<Measurement> kept = reject_outliers(instrument.second, _outlier_threshold);
+
+        if(kept.size() != instrument.second.size())
+        {
+            log_info(instrument.first + ": rejected " + support::cpp11::to_string(instrument.second.size() - kept.size()) + " outlier(s)");
+        }
+
+        filtered.emplace(instrument.first, std::move(kept));
+    }
+
+    return filtered;
+}
+
+void Framework::set_thread_scaling(std::vector<unsigned int> num_threads)
+{
+    _scaling_threads = std::move(num_threads);
+}
+
 bool Framework::run()
 {
     // Clear old test results
     _test_results.clear();
 
+    const unsigned int num_threads = Scheduler::get().num_threads();
+
+    // Measure the roofline once for each thread count
+    _rooflines.clear();
+    for(unsigned int threads : _scaling_threads)
+    {
+        if(_rooflines.count(threads) != 0)
+        {
+            continue;
+        }
+
+        const Roofline roofline = measure_roofline(threads);
+        _rooflines.emplace(threads, roofline);
+
+        if(_log_level >= LogLevel::CONFIG)
+        {
+            func_on_all_printers([&](Printer * p)
+            {
+                p->print_entry("Roofline " + support::cpp11::to_string(threads) + " threads",
+                               arithmetic_to_string(roofline.gflops, 2) + " GFLOP/s, " + arithmetic_to_string(roofline.gbytes_per_s, 2) + " GB/s");
+            });
+        }
+    }
+
     if(_log_level >= LogLevel::TESTS)
     {
         func_on_all_printers([](Printer * p)
@@ -525,6 +723,9 @@ bool Framework::run()
 
     const std::chrono::time_point<std::chrono::high_resolution_clock> end = std::chrono::high_resolution_clock::now();
 
+    // Thread scaling changes the number of threads, restore the one set by the user
+    Scheduler::get().set_num_threads(num_threads);
+
     if(_log_level >= LogLevel::TESTS)
     {
         func_on_all_printers([](Printer * p)
@@ -564,6 +765,10 @@ void Framework::print_test_results(Printer &printer) const
     {
         printer.print_test_header(test.first);
         printer.print_measurements(test.second.measurements);
+        if(!test.second.scaling.empty())
+        {
+            printer.print_scaling(test.second.scaling);
+        }
         printer.print_test_footer();
     }
 
@@ -27,6 +27,7 @@
 #include "DatasetModes.h"
 #include "Exceptions.h"
 #include "Profiler.h"
+#include "Roofline.h"
 #include "TestCase.h"
 #include "TestCaseFactory.h"
 #include "TestFilter.h"
@@ -209,6 +210,34 @@ public:
      */
     void set_num_iterations(int num_iterations);
 
+    /** Set number of warmup iterations per test case.
+     *
+     * The warmup iterations are run before the measured ones but are not
+     * profiled. At least one iteration of each test case is always measured.
+     *
+     * @param[in] num_iterations Number of warmup iterations per test case.
+     */
+    void set_num_warmup_iterations(int num_iterations);
+
+    /** Run more iterations until the measurements are precise enough.
+     *
+     * After the number of iterations set by @ref init, iterations are added
+     * until the half width of the 95% confidence interval of the mean time of
+     * an iteration is within @p confidence_target of the mean.
+     *
+     * @param[in] confidence_target Relative half width of the confidence interval to reach, 0 to disable.
+     * @param[in] max_iterations    Maximum number of measured iterations per test case.
+     */
+    void set_adaptive_iterations(double confidence_target, int max_iterations);
+
+    /** Set the threshold used to reject outliers from the measurements.
+     *
+     * @see find_outliers
+     *
+     * @param[in] threshold Number of scaled median absolute deviations beyond which a measurement is rejected, 0 to disable.
+     */
+    void set_outlier_threshold(double threshold);
+
     /** Should errors be caught or thrown by the framework.
      *
      * @return True if errors are thrown.
@@ -245,6 +274,18 @@ public:
      */
     void set_error_on_missing_assets(bool error_on_missing_assets);
 
+    /** Enable the thread scaling mode.
+     *
+     * Every selected test is set up and run once per thread count and a
+     * report with the speedup, the parallel efficiency and, for tests that
+     * provide a @ref Workload, the achieved throughputs against the roofline
+     * of the machine is printed. The rooflines are measured at the start of
+     * @ref run.
+     *
+     * @param[in] num_threads Thread counts to use. An empty list disables the mode.
+     */
+    void set_thread_scaling(std::vector<unsigned int> num_threads);
+
     /** Run all enabled test cases.
      *
      * @return True if all test cases executed successful.
@@ -302,6 +343,9 @@ private:
     Framework &operator=(const Framework &) = delete;
 
     void run_test(const TestInfo &info, TestCaseFactory &test_factory);
+    void compute_scaling(TestResult &result, const std::vector<double> &times) const;
+    bool is_precise_enough(const std::vector<double> &times) const;
+    Profiler::MeasurementsMap filter_measurements(const Profiler::MeasurementsMap &measurements);
     std::map<TestResult::Status, int> count_test_results() const;
 
     /** Returns the current test suite name.
@@ -322,6 +366,10 @@ private:
     std::vector<std::unique_ptr<TestCaseFactory>> _test_factories{};
     std::map<TestInfo, TestResult> _test_results{};
     int                    _num_iterations{ 1 };
+    int                    _num_warmup_iterations{ 1 };
+    int                    _max_iterations{ 1 };
+    double                 _confidence_target{ 0.0 };
+    double                 _outlier_threshold{ 0.0 };
     bool                   _throw_errors{ false };
     bool                   _stop_on_error{ false };
     bool                   _error_on_missing_assets{ false };
@@ -336,6 +384,8 @@ private:
     const TestInfo                             *_current_test_info{ nullptr };
     TestResult                                 *_current_test_result{ nullptr };
     std::vector<std::string>                    _test_info{};
+    std::vector<unsigned int>                   _scaling_threads{};
+    std::map<unsigned int, Roofline>            _rooflines{};
 };
 
 template <typename T>
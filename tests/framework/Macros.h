@@ -124,6 +124,11 @@
     {                             \
         FIXTURE::teardown();      \
     }
+#define FIXTURE_WORKLOAD(FIXTURE)                                    \
+    arm_compute::test::framework::Workload workload() const override \
+    {                                                                \
+        return FIXTURE::workload();                                  \
+    }
 #define TEST_REGISTRAR(TEST_NAME, MODE, STATUS)                                               \
     static arm_compute::test::framework::detail::TestCaseRegistrar<TEST_NAME> TEST_NAME##_reg \
     {                                                                                         \
@@ -187,6 +192,7 @@
         FIXTURE_SETUP(FIXTURE)                                                      \
         void do_run() override;                                                     \
         FIXTURE_TEARDOWN(FIXTURE)                                                   \
+        FIXTURE_WORKLOAD(FIXTURE)                                                   \
     };                                                                              \
     TEST_REGISTRAR(TEST_NAME, MODE, STATUS);                                        \
     void TEST_NAME::do_run()
@@ -209,6 +215,7 @@
         FIXTURE_DATA_SETUP(FIXTURE)                                                                                                 \
         void do_run() override;                                                                                                     \
         FIXTURE_TEARDOWN(FIXTURE)                                                                                                   \
+        FIXTURE_WORKLOAD(FIXTURE)                                                                                                   \
     };                                                                                                                              \
     DATA_TEST_REGISTRAR(TEST_NAME, MODE, STATUS, DATASET);                                                                          \
     template <typename... As>                                                                                                       \
@@ -230,6 +237,7 @@
         FIXTURE_RUN(FIXTURE)                                                        \
         FIXTURE_SYNC(FIXTURE)                                                       \
         FIXTURE_TEARDOWN(FIXTURE)                                                   \
+        FIXTURE_WORKLOAD(FIXTURE)                                                   \
     };                                                                              \
     TEST_REGISTRAR(TEST_NAME, MODE, STATUS)
 
@@ -252,6 +260,7 @@
         FIXTURE_RUN(FIXTURE)                                                                                                        \
         FIXTURE_SYNC(FIXTURE)                                                                                                       \
         FIXTURE_TEARDOWN(FIXTURE)                                                                                                   \
+        FIXTURE_WORKLOAD(FIXTURE)                                                                                                   \
     };                                                                                                                              \
     DATA_TEST_REGISTRAR(TEST_NAME, MODE, STATUS, DATASET)
 
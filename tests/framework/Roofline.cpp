@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Roofline.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif /* __ARM_NEON */
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+constexpr int          num_repetitions     = 5;
+constexpr int          num_accumulators    = 12;      // Enough independent chains to hide the latency of the multiply-accumulate
+constexpr unsigned int num_fma_iterations  = 1 << 21; // Per thread
+constexpr size_t       num_stream_elements = 1 << 23; // 32MB per buffer, well above the size of the last level cache
+volatile float         sink                = 0.f;
+
+/** Run @p func(thread_id) on @p num_threads threads and return the elapsed time in seconds. */
+template <typename F>
+double run_on_threads(unsigned int num_threads, F &&func)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    for(unsigned int t = 1; t < num_threads; ++t)
+    {
+        threads.emplace_back(func, t);
+    }
+
+    func(0);
+
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+/** Run multiply-accumulate chains and return a value depending on all of them. */
+float fma_kernel(unsigned int num_iterations)
+{
+#ifdef __ARM_NEON
+    float32x4_t       acc[num_accumulators];
+    const float32x4_t a = vdupq_n_f32(0.999999f);
+    const float32x4_t b = vdupq_n_f32(1e-6f);
+
+    for(int j = 0; j < num_accumulators; ++j)
+    {
+        acc[j] = vdupq_n_f32(static_cast<float>(j));
+    }
+
+    for(unsigned int i = 0; i < num_iterations; ++i)
+    {
+        for(int j = 0; j < num_accumulators; ++j)
+        {
+#ifdef __aarch64__
+            acc[j] = vfmaq_f32(b, acc[j], a);
+#else  /* __aarch64__ */
+            acc[j] = vmlaq_f32(b, acc[j], a);
+#endif /* __aarch64__ */
+        }
+    }
+
+    float32x4_t sum = acc[0];
+    for(int j = 1; j < num_accumulators; ++j)
+    {
+        sum = vaddq_f32(sum, acc[j]);
+    }
+
+    return vgetq_lane_f32(sum, 0) + vgetq_lane_f32(sum, 1) + vgetq_lane_f32(sum, 2) + vgetq_lane_f32(sum, 3);
+#else  /* __ARM_NEON */
+    constexpr int lanes = 4;
+    float         acc[num_accumulators * lanes];
+
+    for(int j = 0; j < num_accumulators * lanes; ++j)
+    {
+        acc[j] = static_cast<float>(j);
+    }
+
+    for(unsigned int i = 0; i < num_iterations; ++i)
+    {
+        for(int j = 0; j < num_accumulators * lanes; ++j)
+        {
+            acc[j] = acc[j] * 0.999999f + 1e-6f;
+        }
+    }
+
+    return std::accumulate(acc, acc + num_accumulators * lanes, 0.f);
+#endif /* __ARM_NEON */
+}
+
+double measure_peak_gflops(unsigned int num_threads)
+{
+    constexpr double flops_per_thread = 2.0 * 4 * num_accumulators * num_fma_iterations;
+
+    std::vector<float> results(num_threads);
+    double             best_time = std::numeric_limits<double>::max();
+
+    for(int r = 0; r < num_repetitions; ++r)
+    {
+        const double time = run_on_threads(num_threads, [&](unsigned int thread_id)
+        {
+            results[thread_id] = fma_kernel(num_fma_iterations);
+        });
+
+        best_time = std::min(best_time, time);
+    }
+
+    sink = std::accumulate(results.begin(), results.end(), 0.f);
+
+    return flops_per_thread * num_threads / best_time * 1e-9;
+}
+
+double measure_peak_bandwidth(unsigned int num_threads)
+{
+    std::vector<float> a(num_stream_elements, 0.f);
+    std::vector<float> b(num_stream_elements, 1.f);
+    std::vector<float> c(num_stream_elements, 2.f);
+
+    const size_t chunk     = (num_stream_elements + num_threads - 1) / num_threads;
+    const float  scalar    = 3.f;
+    double       best_time = std::numeric_limits<double>::max();
+
+    // Warm up the pages before timing anything
+    std::copy(b.begin(), b.end(), a.begin());
+
+    for(int r = 0; r < num_repetitions; ++r)
+    {
+        const double time = run_on_threads(num_threads, [&](unsigned int thread_id)
+        {
+            const size_t start = std::min(num_stream_elements, thread_id * chunk);
+            const size_t end   = std::min(num_stream_elements, start + chunk);
+
+            for(size_t i = start; i < end; ++i)
+            {
+                a[i] = b[i] + scalar * c[i];
+            }
+        });
+
+        best_time = std::min(best_time, time);
+    }
+
+    sink = a[num_stream_elements / 2];
+
+    // Two loads and one store per element, as counted by STREAM
+    return 3.0 * sizeof(float) * num_stream_elements / best_time * 1e-9;
+}
+} // namespace
+
+Roofline measure_roofline(unsigned int num_threads)
+{
+    num_threads = std::max(1U, num_threads);
+
+    Roofline roofline;
+    roofline.gflops       = measure_peak_gflops(num_threads);
+    roofline.gbytes_per_s = measure_peak_bandwidth(num_threads);
+
+    return roofline;
+}
+
+double attainable_gflops(const Roofline &roofline, double intensity)
+{
+    return std::min(roofline.gflops, intensity * roofline.gbytes_per_s);
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_ROOFLINE
+#define ARM_COMPUTE_TEST_ROOFLINE
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Peak throughputs of the machine for a given number of threads. */
+struct Roofline
+{
+    double gflops{ 0.0 };       /**< Peak floating point throughput in GFLOP/s */
+    double gbytes_per_s{ 0.0 }; /**< Peak memory bandwidth in GB/s */
+};
+
+/** Measure the roofline of the machine.
+ *
+ * The compute roof is obtained by running independent single precision
+ * multiply-accumulate chains from registers, the memory roof by running a
+ * STREAM triad on buffers much larger than the last level cache.
+ *
+ * @param[in] num_threads Number of threads to run the micro-benchmarks on.
+ *
+ * @return Best throughputs observed over a few repetitions.
+ */
+Roofline measure_roofline(unsigned int num_threads);
+
+/** Maximum throughput a kernel can reach according to the roofline model.
+ *
+ * @param[in] roofline  Roofline of the machine.
+ * @param[in] intensity Arithmetic intensity of the kernel in FLOP/byte.
+ *
+ * @return Attainable throughput in GFLOP/s.
+ */
+double attainable_gflops(const Roofline &roofline, double intensity);
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_ROOFLINE */
@@ -24,6 +24,8 @@
 #ifndef ARM_COMPUTE_TEST_TESTCASE
 #define ARM_COMPUTE_TEST_TESTCASE
 
+#include "Workload.h"
+
 #include <string>
 #include <utility>
 
@@ -44,6 +46,10 @@ public:
     virtual void do_run() {};
     virtual void do_sync() {};
     virtual void do_teardown() {};
+    virtual Workload workload() const
+    {
+        return Workload{};
+    }
 
     /** Default destructor. */
     virtual ~TestCase() = default;
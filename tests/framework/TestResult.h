@@ -25,6 +25,10 @@
 #define ARM_COMPUTE_TEST_TESTRESULT
 
 #include "Profiler.h"
+#include "Roofline.h"
+#include "Workload.h"
+
+#include <vector>
 
 namespace arm_compute
 {
@@ -32,9 +36,22 @@ namespace test
 {
 namespace framework
 {
+/** Performance of a test for one thread count when running in thread scaling mode. */
+struct ScalingPoint
+{
+    unsigned int num_threads{ 1 };      /**< Number of threads the test ran on */
+    double       time{ 0.0 };           /**< Median execution time of one run in seconds */
+    double       speedup{ 1.0 };        /**< Speedup relative to the smallest thread count */
+    double       efficiency{ 1.0 };     /**< Parallel efficiency, speedup divided by the relative number of threads */
+    double       gflops{ 0.0 };         /**< Achieved throughput in GFLOP/s (Zero if the workload is unknown) */
+    double       gbytes_per_s{ 0.0 };   /**< Achieved bandwidth in GB/s (Zero if the workload is unknown) */
+    double       roofline_ratio{ 0.0 }; /**< Fraction of the throughput attainable according to the roofline (Zero if the workload is unknown) */
+    Roofline     roofline{};            /**< Roofline of the machine for this thread count */
+};
+
 /** Class to store results of a test.
  *
- * Currently the execution status and profiling information are stored.
+ * Currently the execution status, profiling and thread scaling information are stored.
  */
 struct TestResult
 {
@@ -73,6 +90,8 @@ struct TestResult
 
     Status                    status{ Status::NOT_RUN }; //< Execution status
     Profiler::MeasurementsMap measurements{};            //< Profiling information
+    Workload                  workload{};                //< Work done by one run of the test
+    std::vector<ScalingPoint> scaling{};                 //< Thread scaling information
 };
 } // namespace framework
 } // namespace test
@@ -38,6 +38,10 @@ CommonOptions::CommonOptions(CommandLineParser &parser)
     : help(parser.add_option<ToggleOption>("help")),
       instruments(),
       iterations(parser.add_option<SimpleOption<int>>("iterations", 1)),
+      warmup(parser.add_option<SimpleOption<int>>("warmup", 1)),
+      max_iterations(parser.add_option<SimpleOption<int>>("max-iterations", 100)),
+      confidence_target(parser.add_option<SimpleOption<double>>("confidence-target", 0.0)),
+      outlier_threshold(parser.add_option<SimpleOption<double>>("outlier-threshold", 0.0)),
       threads(parser.add_option<SimpleOption<int>>("threads", 1)),
       log_format(),
       log_file(parser.add_option<SimpleOption<std::string>>("log-file")),
@@ -86,6 +90,10 @@ CommonOptions::CommonOptions(CommandLineParser &parser)
     help->set_help("Show this help message");
     instruments->set_help("Set the profiling instruments to use");
     iterations->set_help("Number of iterations per test case");
+    warmup->set_help("Number of iterations at the start of each test case which are not measured (At least one iteration is always measured)");
+    max_iterations->set_help("Maximum number of iterations per test case when --confidence-target is used");
+    confidence_target->set_help("Keep running iterations until the 95% confidence interval of the mean time is within this percentage of the mean (0 to disable)");
+    outlier_threshold->set_help("Reject the measurements further away from the median than this number of scaled median absolute deviations (0 to disable)");
     threads->set_help("Number of threads to use");
     log_format->set_help("Output format for measurements and failures (affects only log-file)");
     log_file->set_help("Write output to file instead of to the console (affected by log-format)");
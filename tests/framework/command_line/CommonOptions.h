@@ -70,6 +70,10 @@ public:
     ToggleOption                               *help;
     EnumListOption<InstrumentsDescription>     *instruments;
     SimpleOption<int>                          *iterations;
+    SimpleOption<int>                          *warmup;
+    SimpleOption<int>                          *max_iterations;
+    SimpleOption<double>                       *confidence_target;
+    SimpleOption<double>                       *outlier_threshold;
     SimpleOption<int>                          *threads;
     EnumOption<LogFormat>                      *log_format;
     SimpleOption<std::string>                  *log_file;
@@ -52,6 +52,12 @@ InstrumentsDescription instrument_type_from_name(const std::string &name)
         { "pmu_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1M) },
         { "pmu_cycles", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CYCLE_COUNTER, ScaleFactor::NONE) },
         { "pmu_instructions", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_INSTRUCTION_COUNTER, ScaleFactor::NONE) },
+        { "pmu_cache", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CACHE, ScaleFactor::NONE) },
+        { "pmu_tlb", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_TLB, ScaleFactor::NONE) },
+        { "pmu_stalls", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_STALLS, ScaleFactor::NONE) },
+        { "pmu_cache_kernels", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CACHE_PER_KERNEL, ScaleFactor::NONE) },
+        { "pmu_tlb_kernels", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_TLB_PER_KERNEL, ScaleFactor::NONE) },
+        { "pmu_stalls_kernels", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_STALLS_PER_KERNEL, ScaleFactor::NONE) },
         { "mali", std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::NONE) },
         { "mali_k", std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::SCALE_1K) },
         { "mali_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::SCALE_1M) },
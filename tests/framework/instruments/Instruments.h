@@ -27,6 +27,7 @@
 #include "MaliCounter.h"
 #include "OpenCLTimer.h"
 #include "PMUCounter.h"
+#include "PMUGroupCounter.h"
 #include "SchedulerTimer.h"
 #include "WallClockTimer.h"
 
@@ -47,6 +48,12 @@ enum class InstrumentType : unsigned int
     PMU                     = 0x0200,
     PMU_CYCLE_COUNTER       = 0x0201,
     PMU_INSTRUCTION_COUNTER = 0x0202,
+    PMU_CACHE               = 0x0203,
+    PMU_TLB                 = 0x0204,
+    PMU_STALLS              = 0x0205,
+    PMU_CACHE_PER_KERNEL    = 0x0213,
+    PMU_TLB_PER_KERNEL      = 0x0214,
+    PMU_STALLS_PER_KERNEL   = 0x0215,
     MALI                    = 0x0300,
     OPENCL_TIMER            = 0x0400,
     SCHEDULER_TIMER         = 0x0500,
@@ -122,6 +129,24 @@ inline ::std::stringstream &operator<<(::std::stringstream &stream, InstrumentsD
         case InstrumentType::PMU_INSTRUCTION_COUNTER:
             stream << "PMU_INSTRUCTION_COUNTER";
             break;
+        case InstrumentType::PMU_CACHE:
+            stream << "PMU_CACHE";
+            break;
+        case InstrumentType::PMU_TLB:
+            stream << "PMU_TLB";
+            break;
+        case InstrumentType::PMU_STALLS:
+            stream << "PMU_STALLS";
+            break;
+        case InstrumentType::PMU_CACHE_PER_KERNEL:
+            stream << "PMU_CACHE_KERNELS";
+            break;
+        case InstrumentType::PMU_TLB_PER_KERNEL:
+            stream << "PMU_TLB_KERNELS";
+            break;
+        case InstrumentType::PMU_STALLS_PER_KERNEL:
+            stream << "PMU_STALLS_KERNELS";
+            break;
         case InstrumentType::MALI:
             switch(instrument.second)
             {
@@ -22,16 +22,37 @@
  * SOFTWARE.
  */
 #include "InstrumentsStats.h"
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/utils/misc/utility.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
 namespace arm_compute
 {
 namespace test
 {
 namespace framework
 {
+namespace
+{
+double to_double(const Measurement::Value &value)
+{
+    return value.is_floating_point ? value.v.floating_point : static_cast<double>(value.v.integer);
+}
+
+double median_of(std::vector<double> values)
+{
+    auto middle = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), middle, values.end());
+    return *middle;
+}
+} // namespace
+
 InstrumentsStats::InstrumentsStats(const std::vector<Measurement> &measurements)
-    : _min(nullptr), _max(nullptr), _median(nullptr), _mean(measurements.begin()->value().is_floating_point), _stddev(0.0)
+    : _sorted(), _min(nullptr), _max(nullptr), _median(nullptr), _mean(measurements.begin()->value().is_floating_point), _stddev(0.0)
 {
     auto add_measurements = [](Measurement::Value a, const Measurement & b)
     {
@@ -44,6 +65,12 @@ InstrumentsStats::InstrumentsStats(const std::vector<Measurement> &measurements)
     _min         = &measurements[indices[0]];
     _max         = &measurements[indices[measurements.size() - 1]];
 
+    _sorted.reserve(measurements.size());
+    for(auto index : indices)
+    {
+        _sorted.push_back(&measurements[index]);
+    }
+
     Measurement::Value sum_values = std::accumulate(measurements.begin(), measurements.end(), Measurement::Value(_min->value().is_floating_point), add_measurements);
 
     // Calculate the relative standard deviation
@@ -57,6 +84,109 @@ InstrumentsStats::InstrumentsStats(const std::vector<Measurement> &measurements)
     auto variance = sq_sum / measurements.size();
     _stddev       = Measurement::Value::relative_standard_deviation(variance, _mean);
 }
+
+const Measurement &InstrumentsStats::percentile(double percentage) const
+{
+    ARM_COMPUTE_ERROR_ON(percentage < 0.0 || percentage > 100.0);
+
+    const size_t rank = static_cast<size_t>(std::ceil(percentage / 100.0 * _sorted.size()));
+    return *_sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+std::vector<bool> find_outliers(const std::vector<double> &values, double threshold)
+{
+    std::vector<bool> outliers(values.size(), false);
+
+    if(values.size() < 3)
+    {
+        return outliers;
+    }
+
+    const double median = median_of(values);
+
+    std::vector<double> deviations(values.size());
+    std::transform(values.begin(), values.end(), deviations.begin(), [&](double value)
+    {
+        return std::abs(value - median);
+    });
+
+    // A MAD of zero means that most of the values are identical: keep all of them
+    const double mad = 1.4826 * median_of(deviations);
+    if(mad == 0.0)
+    {
+        return outliers;
+    }
+
+    std::transform(deviations.begin(), deviations.end(), outliers.begin(), [&](double deviation)
+    {
+        return deviation > threshold * mad;
+    });
+
+    return outliers;
+}
+
+std::vector<double> reject_outliers(const std::vector<double> &values, double threshold)
+{
+    const std::vector<bool> outliers = find_outliers(values, threshold);
+
+    std::vector<double> kept;
+    for(size_t i = 0; i < values.size(); ++i)
+    {
+        if(!outliers[i])
+        {
+            kept.push_back(values[i]);
+        }
+    }
+
+    return kept;
+}
+
+std::vector<Measurement> reject_outliers(const std::vector<Measurement> &measurements, double threshold)
+{
+    std::vector<double> values(measurements.size());
+    std::transform(measurements.begin(), measurements.end(), values.begin(), [](const Measurement & measurement)
+    {
+        return to_double(measurement.value());
+    });
+
+    const std::vector<bool> outliers = find_outliers(values, threshold);
+
+    std::vector<Measurement> kept;
+    for(size_t i = 0; i < measurements.size(); ++i)
+    {
+        if(!outliers[i])
+        {
+            kept.push_back(measurements[i]);
+        }
+    }
+
+    return kept;
+}
+
+double relative_confidence_interval(const std::vector<double> &values)
+{
+    // Two-sided 97.5% quantiles of Student's t-distribution for 1 to 30 degrees of freedom
+    static const double t_values[] =
+    {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+
+    const size_t n = values.size();
+
+    if(n < 2)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const double mean     = std::accumulate(values.begin(), values.end(), 0.0) / n;
+    const double sq_sum   = std::inner_product(values.begin(), values.end(), values.begin(), 0.0);
+    const double variance = std::max(0.0, (sq_sum - n * mean * mean) / (n - 1));
+    const double t        = (n - 1 <= 30) ? t_values[n - 2] : 1.96;
+
+    return t * std::sqrt(variance / n) / mean;
+}
 } // namespace framework
 } // namespace test
 } // namespace arm_compute
@@ -62,6 +62,11 @@ public:
     {
         return *_median;
     }
+    /** The measurement below which the given percentage of the measurements fall (Nearest rank)
+     *
+     * @param[in] percentage Percentage in the range [0, 100]
+     */
+    const Measurement &percentile(double percentage) const;
     /** The average of all the measurements
              */
     const Measurement::Value &mean() const
@@ -76,13 +81,57 @@ public:
     }
 
 private:
-    const Measurement *_min;
-    const Measurement *_max;
-    const Measurement *_median;
-    Measurement::Value _mean;
-    double             _stddev;
+    std::vector<const Measurement *> _sorted;
+    const Measurement               *_min;
+    const Measurement               *_max;
+    const Measurement               *_median;
+    Measurement::Value               _mean;
+    double                           _stddev;
 };
 
+/** Find the outliers of a set of values using the median absolute deviation.
+ *
+ * A value is an outlier if its distance to the median is larger than
+ * @p threshold times the scaled MAD (1.4826 * MAD, which estimates the
+ * standard deviation of normally distributed values but is not affected by
+ * the outliers themselves).
+ *
+ * @param[in] values    Values to process.
+ * @param[in] threshold Number of scaled MADs beyond which a value is an outlier.
+ *
+ * @return Mask with one entry per value, true if the value is an outlier.
+ */
+std::vector<bool> find_outliers(const std::vector<double> &values, double threshold);
+
+/** Remove the outliers from a set of values.
+ *
+ * @see find_outliers
+ *
+ * @param[in] values    Values to process.
+ * @param[in] threshold Number of scaled MADs beyond which a value is an outlier.
+ *
+ * @return The values which are not outliers.
+ */
+std::vector<double> reject_outliers(const std::vector<double> &values, double threshold);
+
+/** Remove the outliers from a set of measurements.
+ *
+ * @see find_outliers
+ *
+ * @param[in] measurements Measurements to process.
+ * @param[in] threshold    Number of scaled MADs beyond which a measurement is an outlier.
+ *
+ * @return The measurements which are not outliers.
+ */
+std::vector<Measurement> reject_outliers(const std::vector<Measurement> &measurements, double threshold);
+
+/** Half width of the 95% confidence interval of the mean of a set of values, relative to the mean.
+ *
+ * @param[in] values Values to process.
+ *
+ * @return Relative half width of the interval, infinity if there are less than two values.
+ */
+double relative_confidence_interval(const std::vector<double> &values);
 } // namespace framework
 } // namespace test
 } // namespace arm_compute
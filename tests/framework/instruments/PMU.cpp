@@ -24,7 +24,9 @@
 #include "PMU.h"
 
 #include <asm/unistd.h>
+#include <cstdlib>
 #include <cstring>
+#include <dirent.h>
 #include <stdexcept>
 #include <sys/ioctl.h>
 
@@ -97,6 +99,142 @@ void PMU::reset()
         ARM_COMPUTE_ERROR("Failed to reset PMU counter: %d", errno);
     }
 }
+
+namespace
+{
+/** Get the identifiers of all the threads of the process */
+std::vector<pid_t> process_threads()
+{
+    std::vector<pid_t> threads;
+    DIR               *dir = opendir("/proc/self/task");
+
+    if(dir == nullptr)
+    {
+        // Only count the calling thread and its children
+        threads.push_back(0);
+        return threads;
+    }
+
+    while(const struct dirent *entry = readdir(dir))
+    {
+        if(entry->d_name[0] != '.')
+        {
+            threads.push_back(static_cast<pid_t>(std::strtol(entry->d_name, nullptr, 10)));
+        }
+    }
+    closedir(dir);
+
+    return threads;
+}
+
+long open_event(const PMUEvent &event, pid_t tid, long group_fd)
+{
+    perf_event_attr perf_config{};
+    perf_config.type        = event.type;
+    perf_config.config      = event.config;
+    perf_config.size        = sizeof(perf_event_attr);
+    perf_config.read_format = PERF_FORMAT_GROUP;
+    // Only the leader starts disabled: the members are enabled with it
+    perf_config.disabled = group_fd == -1 ? 1 : 0;
+    // The inherit bit specifies that this counter should count events of child
+    // tasks as well as the task specified
+    perf_config.inherit = 1;
+
+    return syscall(__NR_perf_event_open, &perf_config, tid, -1, group_fd, 0);
+}
+} // namespace
+
+PMUGroup::~PMUGroup()
+{
+    close();
+}
+
+void PMUGroup::open(const std::vector<PMUEvent> &events)
+{
+    close();
+
+    for(const pid_t tid : process_threads())
+    {
+        std::vector<long> fds;
+
+        // The first thread decides which events are supported, the following ones must support the same ones
+        const std::vector<PMUEvent> &thread_events = _fds.empty() ? events : _events;
+        for(const auto &event : thread_events)
+        {
+            const long fd = open_event(event, tid, fds.empty() ? -1 : fds.front());
+            if(fd >= 0)
+            {
+                fds.push_back(fd);
+                if(_fds.empty())
+                {
+                    _events.push_back(event);
+                }
+            }
+            else if(fds.empty() || !_fds.empty())
+            {
+                // No leader or the thread doesn't support the same events as the first one (e.g. it exited in between): skip it
+                break;
+            }
+        }
+
+        if(fds.size() != _events.size() || fds.empty())
+        {
+            for(const long fd : fds)
+            {
+                ::close(fd);
+            }
+            continue;
+        }
+
+        const int result = ioctl(fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        if(result == -1)
+        {
+            ARM_COMPUTE_ERROR("Failed to enable PMU counter group: %d", errno);
+        }
+        _fds.push_back(std::move(fds));
+    }
+}
+
+void PMUGroup::close()
+{
+    for(const auto &fds : _fds)
+    {
+        for(const long fd : fds)
+        {
+            ::close(fd);
+        }
+    }
+    _fds.clear();
+    _events.clear();
+}
+
+const std::vector<PMUEvent> &PMUGroup::events() const
+{
+    return _events;
+}
+
+std::vector<uint64_t> PMUGroup::get_values() const
+{
+    std::vector<uint64_t> values(_events.size(), 0);
+    // Layout of a PERF_FORMAT_GROUP read: number of events followed by one value per event
+    std::vector<uint64_t> buffer(_events.size() + 1);
+
+    for(const auto &fds : _fds)
+    {
+        const ssize_t result = read(fds.front(), buffer.data(), buffer.size() * sizeof(uint64_t));
+        if(result == -1)
+        {
+            ARM_COMPUTE_ERROR("Can't get PMU counter group values: %d", errno);
+        }
+
+        for(size_t i = 0; i < values.size() && i < buffer[0]; ++i)
+        {
+            values[i] += buffer[i + 1];
+        }
+    }
+
+    return values;
+}
 } // namespace framework
 } // namespace test
 } // namespace arm_compute
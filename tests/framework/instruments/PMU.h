@@ -32,6 +32,7 @@
 #include <stdexcept>
 #include <sys/syscall.h>
 #include <unistd.h>
+#include <vector>
 
 namespace arm_compute
 {
@@ -81,6 +82,62 @@ private:
     long            _fd{ -1 };
 };
 
+/** CPU event which can be counted by a @ref PMUGroup */
+struct PMUEvent
+{
+    const char *name;   /**< Name of the event used to report its value */
+    uint32_t    type;   /**< Type of the event (e.g. PERF_TYPE_HARDWARE) */
+    uint64_t    config; /**< Type specific identifier of the event (e.g. PERF_COUNT_HW_CPU_CYCLES) */
+};
+
+/** Class provides atomic access to a group of CPU hardware counters.
+ *
+ * All the counters of a group are scheduled together on the PMU and read with a single read() (PERF_FORMAT_GROUP),
+ * therefore ratios between them (e.g. instructions per cycle) are consistent.
+ *
+ * One group is opened for each thread running in the process when @ref open is called (e.g. the scheduler's worker threads)
+ * and the threads they create afterwards are counted as well.
+ */
+class PMUGroup
+{
+public:
+    /** Default constructor. */
+    PMUGroup() = default;
+    /** Prevent instances of this class from being copied */
+    PMUGroup(const PMUGroup &) = delete;
+    /** Prevent instances of this class from being copied */
+    PMUGroup &operator=(const PMUGroup &) = delete;
+    /** Default destructor. */
+    ~PMUGroup();
+
+    /** Open the specified events.
+     *
+     * @note The events not supported by the CPU or the kernel are skipped. If the first event can't be opened nothing is counted.
+     *
+     * @param[in] events Events to count. The first one is the leader of the group.
+     */
+    void open(const std::vector<PMUEvent> &events);
+
+    /** Close all the counters of the group. */
+    void close();
+
+    /** Get the events which are counted.
+     *
+     * @return The events in the order of the values returned by @ref get_values
+     */
+    const std::vector<PMUEvent> &events() const;
+
+    /** Get the counter values.
+     *
+     * @return The value of each counted event, accumulated over all the threads.
+     */
+    std::vector<uint64_t> get_values() const;
+
+private:
+    std::vector<PMUEvent>          _events{};
+    std::vector<std::vector<long>> _fds{}; /**< File descriptors of each thread: the leader first */
+};
+
 template <typename T>
 T PMU::get_value() const
 {
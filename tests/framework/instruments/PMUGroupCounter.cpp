@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "PMUGroupCounter.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+
+#include <map>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+/** Size of a cache line used to convert refills into bytes */
+constexpr double cache_line_size = 64.0;
+
+constexpr uint64_t hw_cache_event(uint64_t cache, uint64_t op, uint64_t result)
+{
+    return cache | (op << 8) | (result << 16);
+}
+
+std::vector<PMUEvent> group_events(PMUEventGroup group)
+{
+    std::vector<PMUEvent> events =
+    {
+        { "CPU cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { "CPU instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    };
+
+    switch(group)
+    {
+        case PMUEventGroup::CACHE:
+            events.push_back({ "L1D accesses", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_ACCESS) });
+            events.push_back({ "L1D misses", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) });
+#if defined(__arm__) || defined(__aarch64__)
+            // L2D_CACHE_REFILL: common architectural event of the PMUv3 which has no generic perf equivalent
+            events.push_back({ "L2 misses", PERF_TYPE_RAW, 0x17 });
+#endif /* defined(__arm__) || defined(__aarch64__) */
+            events.push_back({ "LLC misses", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) });
+            break;
+        case PMUEventGroup::TLB:
+            events.push_back({ "dTLB accesses", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_ACCESS) });
+            events.push_back({ "dTLB misses", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) });
+            events.push_back({ "iTLB misses", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_ITLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) });
+            break;
+        case PMUEventGroup::STALLS:
+            events.push_back({ "Branches", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS });
+            events.push_back({ "Branch misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES });
+            events.push_back({ "Frontend stall cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND });
+            events.push_back({ "Backend stall cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND });
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported PMU event group");
+    }
+
+    return events;
+}
+
+/** Metric computed as scale * numerator / denominator */
+struct DerivedMetric
+{
+    const char *name;
+    const char *numerator;
+    const char *denominator;
+    double      scale;
+    const char *unit;
+};
+
+const DerivedMetric derived_metrics[] =
+{
+    { "IPC", "CPU instructions", "CPU cycles", 1.0, "instructions/cycle" },
+    { "L1D miss rate", "L1D misses", "L1D accesses", 100.0, "%" },
+    { "L1D refill bandwidth", "L1D misses", "CPU cycles", cache_line_size, "bytes/cycle" },
+    { "L2 refill bandwidth", "L2 misses", "CPU cycles", cache_line_size, "bytes/cycle" },
+    { "LLC refill bandwidth", "LLC misses", "CPU cycles", cache_line_size, "bytes/cycle" },
+    { "dTLB miss rate", "dTLB misses", "dTLB accesses", 100.0, "%" },
+    { "dTLB MPKI", "dTLB misses", "CPU instructions", 1000.0, "misses/Kinstructions" },
+    { "iTLB MPKI", "iTLB misses", "CPU instructions", 1000.0, "misses/Kinstructions" },
+    { "Branch miss rate", "Branch misses", "Branches", 100.0, "%" },
+    { "Branch MPKI", "Branch misses", "CPU instructions", 1000.0, "misses/Kinstructions" },
+    { "Frontend stalls", "Frontend stall cycles", "CPU cycles", 100.0, "%" },
+    { "Backend stalls", "Backend stall cycles", "CPU cycles", 100.0, "%" },
+};
+
+void add_measurements(Instrument::MeasurementsMap &measurements, const std::string &prefix, const std::vector<PMUEvent> &events, const std::vector<uint64_t> &values)
+{
+    std::map<std::string, uint64_t> counts;
+    for(size_t i = 0; i < events.size() && i < values.size(); ++i)
+    {
+        counts[events[i].name] = values[i];
+        measurements.emplace(prefix + events[i].name, Measurement(values[i], "events"));
+    }
+
+    for(const auto &metric : derived_metrics)
+    {
+        const auto numerator   = counts.find(metric.numerator);
+        const auto denominator = counts.find(metric.denominator);
+        if(numerator != counts.end() && denominator != counts.end() && denominator->second != 0)
+        {
+            const double value = metric.scale * static_cast<double>(numerator->second) / static_cast<double>(denominator->second);
+            measurements.emplace(prefix + metric.name, Measurement(value, metric.unit));
+        }
+    }
+}
+
+std::vector<uint64_t> difference(const std::vector<uint64_t> &end, const std::vector<uint64_t> &start)
+{
+    std::vector<uint64_t> values(end.size(), 0);
+    for(size_t i = 0; i < end.size() && i < start.size(); ++i)
+    {
+        values[i] = end[i] - start[i];
+    }
+    return values;
+}
+} // namespace
+
+PMUGroupCounter::PMUGroupCounter(PMUEventGroup group, bool per_kernel)
+    : _group(group), _per_kernel(per_kernel)
+{
+    _pmu.open(group_events(group));
+}
+
+std::string PMUGroupCounter::id() const
+{
+    std::string id;
+    switch(_group)
+    {
+        case PMUEventGroup::CACHE:
+            id = "PMU Cache Counters";
+            break;
+        case PMUEventGroup::TLB:
+            id = "PMU TLB Counters";
+            break;
+        case PMUEventGroup::STALLS:
+            id = "PMU Stall Counters";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported PMU event group");
+    }
+    return _per_kernel ? id + " per kernel" : id;
+}
+
+void PMUGroupCounter::start()
+{
+    _kernels.clear();
+    if(_per_kernel)
+    {
+        SchedulerInterceptor::add_listener(this);
+    }
+    _start_values = _pmu.get_values();
+}
+
+void PMUGroupCounter::stop()
+{
+    _values = difference(_pmu.get_values(), _start_values);
+    if(_per_kernel)
+    {
+        SchedulerInterceptor::remove_listener(this);
+    }
+}
+
+void PMUGroupCounter::kernel_started(const ICPPKernel &kernel)
+{
+    ARM_COMPUTE_UNUSED(kernel);
+    _kernel_start_values = _pmu.get_values();
+}
+
+void PMUGroupCounter::kernel_finished(const ICPPKernel &kernel)
+{
+    kernel_info info;
+    info.values = difference(_pmu.get_values(), _kernel_start_values);
+    info.name   = kernel.name();
+    _kernels.push_back(std::move(info));
+}
+
+Instrument::MeasurementsMap PMUGroupCounter::measurements() const
+{
+    MeasurementsMap measurements;
+    add_measurements(measurements, "", _pmu.events(), _values);
+
+    unsigned int kernel_number = 0;
+    for(const auto &kernel : _kernels)
+    {
+        add_measurements(measurements, kernel.name + " #" + support::cpp11::to_string(kernel_number++) + " ", _pmu.events(), kernel.values);
+    }
+
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
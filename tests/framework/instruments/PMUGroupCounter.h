@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_PMU_GROUP_COUNTER
+#define ARM_COMPUTE_TEST_PMU_GROUP_COUNTER
+
+#include "Instrument.h"
+#include "PMU.h"
+#include "SchedulerInterceptor.h"
+
+#include <list>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Groups of CPU events which can be counted together */
+enum class PMUEventGroup
+{
+    CACHE,  /**< Cycles, instructions, L1D accesses and misses, L2 misses (Arm only), last level cache misses */
+    TLB,    /**< Cycles, instructions, data TLB accesses and misses, instruction TLB misses */
+    STALLS, /**< Cycles, instructions, branches and branch misses, frontend and backend stall cycles */
+};
+
+/** Implementation of an instrument to count a group of CPU events.
+ *
+ * On top of the raw counts the instrument reports derived metrics: instructions per cycle, miss rates,
+ * misses per thousand instructions, bytes refilled per cycle (Assuming 64 bytes cache lines) and share of stalled cycles.
+ *
+ * If @p per_kernel is true, the events are also attributed to each kernel run through the scheduler
+ * (See @ref SchedulerInterceptor).
+ */
+class PMUGroupCounter : public Instrument, public ISchedulerListener
+{
+public:
+    /** Constructor
+     *
+     * @param[in] group      Group of events to count.
+     * @param[in] per_kernel Report the events of each scheduled kernel as well as the ones of the whole iteration.
+     */
+    PMUGroupCounter(PMUEventGroup group, bool per_kernel);
+
+    std::string     id() const override;
+    void            start() override;
+    void            stop() override;
+    MeasurementsMap measurements() const override;
+    void            kernel_started(const ICPPKernel &kernel) override;
+    void            kernel_finished(const ICPPKernel &kernel) override;
+
+private:
+    struct kernel_info
+    {
+        std::string           name{};   /**< Kernel name */
+        std::vector<uint64_t> values{}; /**< Events counted while the kernel was running */
+    };
+
+    PMUEventGroup          _group;
+    bool                   _per_kernel;
+    PMUGroup               _pmu{};
+    std::vector<uint64_t>  _start_values{};
+    std::vector<uint64_t>  _values{};
+    std::vector<uint64_t>  _kernel_start_values{};
+    std::list<kernel_info> _kernels{};
+};
+
+/** Wrapper to create a @ref PMUGroupCounter through @ref Instrument::make_instrument */
+template <PMUEventGroup group, bool per_kernel>
+class PMUGroupCounterInstance final : public PMUGroupCounter
+{
+public:
+    /** Constructor
+     *
+     * @param[in] scale_factor Unused: the counts are always reported unscaled.
+     */
+    PMUGroupCounterInstance(ScaleFactor scale_factor)
+        : PMUGroupCounter(group, per_kernel)
+    {
+        ARM_COMPUTE_UNUSED(scale_factor);
+    }
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_PMU_GROUP_COUNTER */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "SchedulerInterceptor.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+struct InterceptorState
+{
+    std::vector<ISchedulerListener *> listeners{};
+    bool                              installed{ false };
+    Scheduler::Type                   real_scheduler_type{ Scheduler::Type::ST };
+};
+
+InterceptorState &state()
+{
+    static InterceptorState instance;
+    return instance;
+}
+} // namespace
+
+SchedulerInterceptor::SchedulerInterceptor(IScheduler &real_scheduler)
+    : _real_scheduler(real_scheduler)
+{
+}
+
+void SchedulerInterceptor::add_listener(ISchedulerListener *listener)
+{
+    ARM_COMPUTE_ERROR_ON(listener == nullptr);
+    InterceptorState &s = state();
+
+    if(s.listeners.empty())
+    {
+        s.real_scheduler_type = Scheduler::get_type();
+        //Note: We can't currently replace a custom scheduler
+        if(s.real_scheduler_type != Scheduler::Type::CUSTOM)
+        {
+            auto interceptor = std::make_shared<SchedulerInterceptor>(Scheduler::get());
+            Scheduler::set(std::static_pointer_cast<IScheduler>(interceptor));
+            s.installed = true;
+        }
+    }
+    s.listeners.push_back(listener);
+}
+
+void SchedulerInterceptor::remove_listener(ISchedulerListener *listener)
+{
+    InterceptorState &s = state();
+
+    s.listeners.erase(std::remove(s.listeners.begin(), s.listeners.end(), listener), s.listeners.end());
+    if(s.listeners.empty() && s.installed)
+    {
+        // Restore real scheduler
+        Scheduler::set(s.real_scheduler_type);
+        s.installed = false;
+    }
+}
+
+void SchedulerInterceptor::set_num_threads(unsigned int num_threads)
+{
+    _real_scheduler.set_num_threads(num_threads);
+}
+
+unsigned int SchedulerInterceptor::num_threads() const
+{
+    return _real_scheduler.num_threads();
+}
+
+void SchedulerInterceptor::schedule(ICPPKernel *kernel, unsigned int split_dimension)
+{
+    const std::vector<ISchedulerListener *> &listeners = state().listeners;
+
+    for(auto listener : listeners)
+    {
+        listener->kernel_started(*kernel);
+    }
+
+    _real_scheduler.schedule(kernel, split_dimension);
+
+    // Notify in reverse order so that each listener's measurement only encloses the ones of the listeners registered after it
+    for(auto it = listeners.rbegin(); it != listeners.rend(); ++it)
+    {
+        (*it)->kernel_finished(*kernel);
+    }
+}
+
+void SchedulerInterceptor::set_counters_enabled(bool enable)
+{
+    _real_scheduler.set_counters_enabled(enable);
+}
+
+bool SchedulerInterceptor::counters_enabled() const
+{
+    return _real_scheduler.counters_enabled();
+}
+
+SchedulerCounters SchedulerInterceptor::counters() const
+{
+    return _real_scheduler.counters();
+}
+
+void SchedulerInterceptor::reset_counters()
+{
+    _real_scheduler.reset_counters();
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_SCHEDULER_INTERCEPTOR
+#define ARM_COMPUTE_TEST_SCHEDULER_INTERCEPTOR
+
+#include "arm_compute/runtime/Scheduler.h"
+
+namespace arm_compute
+{
+class ICPPKernel;
+
+namespace test
+{
+namespace framework
+{
+/** Interface of the instruments notified of every kernel scheduled while they are registered to the @ref SchedulerInterceptor */
+class ISchedulerListener
+{
+public:
+    /** Default destructor */
+    virtual ~ISchedulerListener() = default;
+    /** Called right before a kernel is passed to the real scheduler
+     *
+     * @param[in] kernel Kernel about to be scheduled
+     */
+    virtual void kernel_started(const ICPPKernel &kernel) = 0;
+    /** Called right after the real scheduler returned
+     *
+     * @param[in] kernel Kernel which has just been executed
+     */
+    virtual void kernel_finished(const ICPPKernel &kernel) = 0;
+};
+
+/** Scheduler forwarding the kernels to the real scheduler and notifying the registered listeners
+ *
+ * The interceptor is installed when the first listener is added and the real scheduler is restored when the last one is removed,
+ * which allows several instruments (e.g. @ref SchedulerTimer and @ref PMUGroupCounter) to attribute their measurements to the same kernels.
+ *
+ * @note We can't currently replace a custom scheduler: if a custom scheduler is active the listeners are not notified.
+ */
+class SchedulerInterceptor final : public IScheduler
+{
+public:
+    /** Constructor
+     *
+     * @param[in] real_scheduler Scheduler to forward the kernels to.
+     */
+    SchedulerInterceptor(IScheduler &real_scheduler);
+
+    /** Registers a listener, installs the interceptor if it's the first one.
+     *
+     * @param[in] listener Listener to notify. Must stay alive until @ref remove_listener is called.
+     */
+    static void add_listener(ISchedulerListener *listener);
+    /** Unregisters a listener, restores the real scheduler if it was the last one.
+     *
+     * @param[in] listener Listener previously passed to @ref add_listener.
+     */
+    static void remove_listener(ISchedulerListener *listener);
+
+    // Inherited methods overridden:
+    void set_num_threads(unsigned int num_threads) override;
+    unsigned int num_threads() const override;
+    void schedule(ICPPKernel *kernel, unsigned int split_dimension) override;
+    void set_counters_enabled(bool enable) override;
+    bool counters_enabled() const override;
+    SchedulerCounters counters() const override;
+    void reset_counters() override;
+
+private:
+    IScheduler &_real_scheduler;
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SCHEDULER_INTERCEPTOR */
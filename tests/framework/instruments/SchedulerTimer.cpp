@@ -23,7 +23,6 @@
  */
 #include "SchedulerTimer.h"
 
-#include "WallClockTimer.h"
 #include "arm_compute/core/CPP/ICPPKernel.h"
 
 namespace arm_compute
@@ -37,67 +36,36 @@ std::string SchedulerTimer::id() const
     return "SchedulerTimer";
 }
 
-class Interceptor final : public IScheduler
-{
-public:
-    /** Default constructor. */
-    Interceptor(std::list<SchedulerTimer::kernel_info> &kernels, IScheduler &real_scheduler, ScaleFactor scale_factor)
-        : _kernels(kernels), _real_scheduler(real_scheduler), _timer(scale_factor)
-    {
-    }
-
-    void set_num_threads(unsigned int num_threads) override
-    {
-        _real_scheduler.set_num_threads(num_threads);
-    }
-
-    unsigned int num_threads() const override
-    {
-        return _real_scheduler.num_threads();
-    }
-
-    void schedule(ICPPKernel *kernel, unsigned int split_dimension) override
-    {
-        _timer.start();
-        _real_scheduler.schedule(kernel, split_dimension);
-        _timer.stop();
-
-        SchedulerTimer::kernel_info info;
-        info.name         = kernel->name();
-        info.measurements = _timer.measurements();
-        _kernels.push_back(std::move(info));
-    }
-
-private:
-    std::list<SchedulerTimer::kernel_info> &_kernels;
-    IScheduler                             &_real_scheduler;
-    WallClockTimer                          _timer;
-};
-
 SchedulerTimer::SchedulerTimer(ScaleFactor scale_factor)
-    : _kernels(), _real_scheduler(nullptr), _real_scheduler_type(), _scale_factor(scale_factor)
+    : _kernels(), _timer(scale_factor)
 {
 }
 
 void SchedulerTimer::start()
 {
-    ARM_COMPUTE_ERROR_ON(_real_scheduler != nullptr);
-    _real_scheduler_type = Scheduler::get_type();
-    //Note: We can't currently replace a custom scheduler
-    if(_real_scheduler_type != Scheduler::Type::CUSTOM)
-    {
-        _real_scheduler  = &Scheduler::get();
-        auto interceptor = std::make_shared<Interceptor>(_kernels, *_real_scheduler, _scale_factor);
-        Scheduler::set(std::static_pointer_cast<IScheduler>(interceptor));
-    }
     _kernels.clear();
+    SchedulerInterceptor::add_listener(this);
 }
 
 void SchedulerTimer::stop()
 {
-    // Restore real scheduler
-    Scheduler::set(_real_scheduler_type);
-    _real_scheduler = nullptr;
+    SchedulerInterceptor::remove_listener(this);
+}
+
+void SchedulerTimer::kernel_started(const ICPPKernel &kernel)
+{
+    ARM_COMPUTE_UNUSED(kernel);
+    _timer.start();
+}
+
+void SchedulerTimer::kernel_finished(const ICPPKernel &kernel)
+{
+    _timer.stop();
+
+    SchedulerTimer::kernel_info info;
+    info.name         = kernel.name();
+    info.measurements = _timer.measurements();
+    _kernels.push_back(std::move(info));
 }
 
 Instrument::MeasurementsMap SchedulerTimer::measurements() const
@@ -25,7 +25,9 @@
 #define ARM_COMPUTE_TEST_SCHEDULER_TIMER
 
 #include "Instrument.h"
-#include "arm_compute/runtime/Scheduler.h"
+#include "SchedulerInterceptor.h"
+#include "WallClockTimer.h"
+
 #include <list>
 
 namespace arm_compute
@@ -35,7 +37,7 @@ namespace test
 namespace framework
 {
 /** Instrument creating measurements based on the information returned by clGetEventProfilingInfo for each OpenCL kernel executed*/
-class SchedulerTimer : public Instrument
+class SchedulerTimer : public Instrument, public ISchedulerListener
 {
 public:
     SchedulerTimer(const SchedulerTimer &) = delete;
@@ -45,6 +47,8 @@ public:
     void                        start() override;
     void                        stop() override;
     Instrument::MeasurementsMap measurements() const override;
+    void                        kernel_started(const ICPPKernel &kernel) override;
+    void                        kernel_finished(const ICPPKernel &kernel) override;
     struct kernel_info
     {
         Instrument::MeasurementsMap measurements{}; /**< Time it took the kernel to run */
@@ -53,9 +57,7 @@ public:
 
 private:
     std::list<kernel_info> _kernels;
-    IScheduler            *_real_scheduler;
-    Scheduler::Type        _real_scheduler_type;
-    ScaleFactor            _scale_factor;
+    WallClockTimer         _timer;
 };
 } // namespace framework
 } // namespace test
@@ -24,6 +24,7 @@
 #include "JSONPrinter.h"
 
 #include "../Framework.h"
+#include "../instruments/InstrumentsStats.h"
 #include "../instruments/Measurement.h"
 
 #include <algorithm>
@@ -195,6 +196,16 @@ void JSONPrinter::print_measurements(const Profiler::MeasurementsMap &measuremen
             }
         };
         *_stream << R"("raw" : [)" << join(i_it->second.begin(), i_it->second.end(), ",", measurement_to_string) << "],";
+
+        if(i_it->second.size() > 1)
+        {
+            InstrumentsStats stats(i_it->second);
+            *_stream << R"("percentiles" : {)";
+            *_stream << R"("50" : ")" << stats.percentile(50).value() << R"(",)";
+            *_stream << R"("90" : ")" << stats.percentile(90).value() << R"(",)";
+            *_stream << R"("99" : ")" << stats.percentile(99).value() << R"("},)";
+        }
+
         *_stream << R"("unit" : ")" << i_it->second.begin()->unit() << R"(")";
         *_stream << "}";
 
@@ -206,6 +217,34 @@ void JSONPrinter::print_measurements(const Profiler::MeasurementsMap &measuremen
 
     *_stream << "}";
 }
+
+void JSONPrinter::print_scaling(const std::vector<ScalingPoint> &scaling)
+{
+    print_separator(_first_test_entry);
+
+    *_stream << R"("scaling" : [)";
+
+    for(auto it = scaling.cbegin(); it != scaling.cend(); ++it)
+    {
+        if(it != scaling.cbegin())
+        {
+            *_stream << ",";
+        }
+
+        *_stream << "{";
+        *_stream << R"("threads" : )" << it->num_threads << ",";
+        *_stream << R"("time" : )" << it->time << ",";
+        *_stream << R"("speedup" : )" << it->speedup << ",";
+        *_stream << R"("efficiency" : )" << it->efficiency << ",";
+        *_stream << R"("gflops" : )" << it->gflops << ",";
+        *_stream << R"("gbytes_per_s" : )" << it->gbytes_per_s << ",";
+        *_stream << R"("roofline_ratio" : )" << it->roofline_ratio << ",";
+        *_stream << R"("roofline" : { "gflops" : )" << it->roofline.gflops << R"(, "gbytes_per_s" : )" << it->roofline.gbytes_per_s << "}";
+        *_stream << "}";
+    }
+
+    *_stream << "]";
+}
 } // namespace framework
 } // namespace test
 } // namespace arm_compute
@@ -132,6 +132,32 @@ void PrettyPrinter::print_measurements(const Profiler::MeasurementsMap &measurem
             *_stream << ", MIN=" << stats.min() << ", ";
             *_stream << ", MAX=" << stats.max() << ", ";
             *_stream << ", MEDIAN=" << stats.median().value() << " " << stats.median().unit();
+            *_stream << ", P90=" << stats.percentile(90).value() << " " << stats.percentile(90).unit();
+            *_stream << ", P99=" << stats.percentile(99).value() << " " << stats.percentile(99).unit();
+        }
+        *_stream << end_color() << "\n";
+    }
+}
+
+void PrettyPrinter::print_scaling(const std::vector<ScalingPoint> &scaling)
+{
+    for(const auto &point : scaling)
+    {
+        *_stream << begin_color("3") << "  " << point.num_threads << " thread(s):";
+        *_stream << "    TIME=" << arithmetic_to_string(point.time * 1000.0, 4) << " ms";
+        *_stream << ", SPEEDUP=" << arithmetic_to_string(point.speedup, 2);
+        *_stream << ", EFFICIENCY=" << arithmetic_to_string(point.efficiency * 100.0, 1) << " %";
+        if(point.gflops > 0.0)
+        {
+            *_stream << ", " << arithmetic_to_string(point.gflops, 2) << " GFLOP/s";
+        }
+        if(point.gbytes_per_s > 0.0)
+        {
+            *_stream << ", " << arithmetic_to_string(point.gbytes_per_s, 2) << " GB/s";
+        }
+        if(point.roofline_ratio > 0.0)
+        {
+            *_stream << ", ROOFLINE=" << arithmetic_to_string(point.roofline_ratio * 100.0, 1) << " %";
         }
         *_stream << end_color() << "\n";
     }
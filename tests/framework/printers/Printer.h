@@ -30,6 +30,7 @@
 #include <iostream>
 #include <ostream>
 #include <stdexcept>
+#include <vector>
 
 namespace arm_compute
 {
@@ -38,6 +39,7 @@ namespace test
 namespace framework
 {
 struct TestInfo;
+struct ScalingPoint;
 
 /** Abstract printer class used by the @ref Framework to present output. */
 class Printer
@@ -126,6 +128,12 @@ public:
      */
     virtual void print_measurements(const Profiler::MeasurementsMap &measurements) = 0;
 
+    /** Print the thread scaling report of a test.
+     *
+     * @param[in] scaling Performance of the test for each thread count.
+     */
+    virtual void print_scaling(const std::vector<ScalingPoint> &scaling) = 0;
+
     /** Set the output stream.
      *
      * @param[out] stream Output stream.
@@ -46,6 +46,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <utility>
 
@@ -99,6 +100,8 @@ int main(int argc, char **argv)
     test_instruments->set_help("Test if the instruments work on the platform");
     auto error_on_missing_assets = parser.add_option<framework::ToggleOption>("error-on-missing-assets", false);
     error_on_missing_assets->set_help("Mark a test as failed instead of skipping it when assets are missing");
+    auto thread_scaling = parser.add_option<framework::ToggleOption>("thread-scaling", false);
+    thread_scaling->set_help("Run every test with 1 to --threads threads and report the speedup, parallel efficiency and roofline usage");
     auto assets = parser.add_positional_option<framework::SimpleOption<std::string>>("assets");
     assets->set_help("Path to the assets directory");
 
@@ -131,6 +134,16 @@ int main(int argc, char **argv)
                 p->print_entry("Version", build_information());
                 p->print_entry("Seed", support::cpp11::to_string(seed->value()));
                 p->print_entry("Iterations", support::cpp11::to_string(options.iterations->value()));
+                p->print_entry("Warmup iterations", support::cpp11::to_string(options.warmup->value()));
+                if(options.confidence_target->value() > 0.0)
+                {
+                    p->print_entry("Confidence target", framework::arithmetic_to_string(options.confidence_target->value(), 2) + " %");
+                    p->print_entry("Max iterations", support::cpp11::to_string(options.max_iterations->value()));
+                }
+                if(options.outlier_threshold->value() > 0.0)
+                {
+                    p->print_entry("Outlier threshold", framework::arithmetic_to_string(options.outlier_threshold->value(), 2) + " MAD");
+                }
                 p->print_entry("Threads", support::cpp11::to_string(options.threads->value()));
                 {
                     using support::cpp11::to_string;
@@ -147,6 +160,16 @@ int main(int argc, char **argv)
         framework.set_throw_errors(options.throw_errors->value());
         framework.set_stop_on_error(stop_on_error->value());
         framework.set_error_on_missing_assets(error_on_missing_assets->value());
+        framework.set_num_warmup_iterations(options.warmup->value());
+        framework.set_adaptive_iterations(options.confidence_target->value() / 100.0, options.max_iterations->value());
+        framework.set_outlier_threshold(options.outlier_threshold->value());
+
+        if(thread_scaling->value())
+        {
+            std::vector<unsigned int> thread_counts(Scheduler::get().num_threads());
+            std::iota(thread_counts.begin(), thread_counts.end(), 1U);
+            framework.set_thread_scaling(std::move(thread_counts));
+        }
 
         bool success = true;
 
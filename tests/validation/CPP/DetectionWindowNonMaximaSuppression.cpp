@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/kernels/CPPDetectionWindowNonMaximaSuppressionKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Array.h"
+#include "tests/Globals.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/DetectionWindowNonMaximaSuppression.h"
+
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Create random detection windows
+ *
+ * The windows are packed in a small area so that many overlap, a few scores are used so that many windows have the same score,
+ * and some windows are duplicated.
+ */
+std::vector<DetectionWindow> generate_detection_windows(size_t num_windows, std::random_device::result_type seed)
+{
+    std::mt19937                          gen(seed);
+    std::uniform_int_distribution<int>    dist_x(0, 256);
+    std::uniform_int_distribution<int>    dist_y(0, 192);
+    std::uniform_int_distribution<int>    dist_size(0, 1);
+    std::uniform_int_distribution<int>    dist_class(0, 2);
+    std::uniform_int_distribution<int>    dist_score(1, 8);
+    std::uniform_int_distribution<size_t> dist_duplicate(0, 9);
+
+    std::vector<DetectionWindow> windows;
+
+    for(size_t i = 0; i < num_windows; ++i)
+    {
+        if(!windows.empty() && dist_duplicate(gen) == 0)
+        {
+            windows.push_back(windows[std::uniform_int_distribution<size_t>(0, windows.size() - 1)(gen)]);
+            continue;
+        }
+
+        DetectionWindow win;
+        win.x         = dist_x(gen);
+        win.y         = dist_y(gen);
+        win.width     = dist_size(gen) == 0 ? 64 : 48;
+        win.height    = dist_size(gen) == 0 ? 128 : 96;
+        win.idx_class = dist_class(gen);
+        win.score     = dist_score(gen) * 0.25f;
+        windows.push_back(win);
+    }
+
+    return windows;
+}
+
+bool operator==(const DetectionWindow &lhs, const DetectionWindow &rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.width == rhs.width && lhs.height == rhs.height && lhs.idx_class == rhs.idx_class && lhs.score == rhs.score;
+}
+} // namespace
+
+TEST_SUITE(CPP)
+TEST_SUITE(DetectionWindowNonMaximaSuppression)
+
+DATA_TEST_CASE(Run, framework::DatasetMode::ALL, combine(framework::dataset::make("NumWindows", { 1, 50, 500, 2000 }),
+                                                         framework::dataset::make("MinDistance", { 0.f, 0.5f, 1.f, 8.f, 30.f, 100.f })),
+               num_windows, min_distance)
+{
+    const std::vector<DetectionWindow> windows = generate_detection_windows(num_windows, library->seed());
+
+    DetectionWindowArray input_output(windows.size());
+    for(const auto &win : windows)
+    {
+        input_output.push_back(win);
+    }
+
+    // Compute function
+    CPPDetectionWindowNonMaximaSuppressionKernel nms;
+    nms.configure(&input_output, min_distance);
+    nms.run(nms.window(), ThreadInfo());
+
+    // Compute reference
+    const std::vector<DetectionWindow> reference = reference::detection_window_non_maxima_suppression(windows, min_distance);
+
+    // Validate output
+    ARM_COMPUTE_EXPECT_EQUAL(input_output.num_values(), reference.size(), framework::LogLevel::ERRORS);
+
+    size_t num_mismatches = 0;
+    for(size_t i = 0; i < std::min(input_output.num_values(), reference.size()); ++i)
+    {
+        if(!(input_output.at(i) == reference[i]))
+        {
+            ++num_mismatches;
+        }
+    }
+
+    ARM_COMPUTE_EXPECT_EQUAL(num_mismatches, 0U, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // DetectionWindowNonMaximaSuppression
+TEST_SUITE_END() // CPP
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
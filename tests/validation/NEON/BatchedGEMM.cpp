@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEBatchedGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/BatchedGEMMFixture.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+
+/** Batches of small problems, with both per-batch and shared B matrices */
+const auto SmallBatchedGEMMDataset = zip(zip(zip(zip(
+                                                     framework::dataset::make("ShapeA", { TensorShape(21U, 13U, 7U), TensorShape(31U, 1U, 16U), TensorShape(38U, 12U, 3U), TensorShape(64U, 64U, 12U), TensorShape(17U, 33U, 5U) }),
+                                                     framework::dataset::make("ShapeB", { TensorShape(33U, 21U, 7U), TensorShape(23U, 31U, 16U), TensorShape(21U, 38U), TensorShape(64U, 64U, 12U), TensorShape(29U, 17U) })),
+                                                 framework::dataset::make("OutputShape", { TensorShape(33U, 13U, 7U), TensorShape(23U, 1U, 16U), TensorShape(21U, 12U, 3U), TensorShape(64U, 64U, 12U), TensorShape(29U, 33U, 5U) })),
+                                             framework::dataset::make("Alpha", { 1.0f, 1.0f, 0.2f, 1.0f, 0.4f })),
+                                         framework::dataset::make("Beta", { 0.0f, 0.0f, 1.2f, 0.0f, 0.7f }));
+
+bool is_valid_array(const std::vector<const ITensorInfo *> &a, const std::vector<const ITensorInfo *> &b, const std::vector<const ITensorInfo *> &d)
+{
+    return bool(NEBatchedGEMM::validate(a, b, d));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(BatchedGEMM)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
+    framework::dataset::make("AInfo", { TensorInfo(TensorShape(21U, 13U, 7U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(21U, 13U, 7U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(21U, 13U, 7U), 1, DataType::F32, 0), // Mismatching K
+                                        TensorInfo(TensorShape(21U, 13U, 7U), 1, DataType::F32, 0), // Mismatching number of batches
+                                        TensorInfo(TensorShape(21U, 13U, 7U), 1, DataType::QS8, 2), // Unsupported data type
+                                      }),
+    framework::dataset::make("BInfo", { TensorInfo(TensorShape(33U, 21U, 7U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(33U, 21U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(33U, 20U, 7U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(33U, 21U, 5U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(33U, 21U, 7U), 1, DataType::QS8, 2),
+                                      })),
+    framework::dataset::make("DInfo", { TensorInfo(TensorShape(33U, 13U, 7U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(33U, 13U, 7U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(33U, 13U, 7U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(33U, 13U, 7U), 1, DataType::F32, 0),
+                                        TensorInfo(TensorShape(33U, 13U, 7U), 1, DataType::QS8, 2),
+                                      })),
+    framework::dataset::make("Expected", { true, true, false, false, false })),
+    a_info, b_info, d_info, expected)
+{
+    bool is_valid = bool(NEBatchedGEMM::validate(&a_info.clone()->set_is_resizable(false),
+                                                 &b_info.clone()->set_is_resizable(false),
+                                                 &d_info.clone()->set_is_resizable(false)));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(ValidateArrays, framework::DatasetMode::ALL)
+{
+    const TensorInfo a_info(TensorShape(21U, 13U), 1, DataType::F32, 0);
+    const TensorInfo b_info(TensorShape(33U, 21U), 1, DataType::F32, 0);
+    const TensorInfo d_info(TensorShape(33U, 13U), 1, DataType::F32, 0);
+    const TensorInfo a_info_other_m(TensorShape(21U, 12U), 1, DataType::F32, 0);
+    const TensorInfo d_info_other_m(TensorShape(33U, 12U), 1, DataType::F32, 0);
+    const TensorInfo b_info_other_k(TensorShape(33U, 20U), 1, DataType::F32, 0);
+    const TensorInfo a_info_3d(TensorShape(21U, 13U, 2U), 1, DataType::F32, 0);
+    const TensorInfo d_info_3d(TensorShape(33U, 13U, 2U), 1, DataType::F32, 0);
+    const TensorInfo a_info_qs8(TensorShape(21U, 13U), 1, DataType::QS8, 2);
+    const TensorInfo b_info_qs8(TensorShape(33U, 21U), 1, DataType::QS8, 2);
+    const TensorInfo d_info_qs8(TensorShape(33U, 13U), 1, DataType::QS8, 2);
+
+    // Per-batch and shared matrices B
+    ARM_COMPUTE_EXPECT(is_valid_array({ &a_info, &a_info, &a_info }, { &b_info, &b_info, &b_info }, { &d_info, &d_info, &d_info }), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_valid_array({ &a_info, &a_info }, { &b_info }, { &d_info, &d_info }), framework::LogLevel::ERRORS);
+
+    // Empty batch
+    ARM_COMPUTE_EXPECT(!is_valid_array({}, { &b_info }, {}), framework::LogLevel::ERRORS);
+    // Not one matrix C per matrix A
+    ARM_COMPUTE_EXPECT(!is_valid_array({ &a_info, &a_info }, { &b_info }, { &d_info }), framework::LogLevel::ERRORS);
+    // Matrices B neither shared nor one per matrix A
+    ARM_COMPUTE_EXPECT(!is_valid_array({ &a_info, &a_info, &a_info }, { &b_info, &b_info }, { &d_info, &d_info, &d_info }), framework::LogLevel::ERRORS);
+    // Missing matrix
+    ARM_COMPUTE_EXPECT(!is_valid_array({ &a_info, nullptr }, { &b_info }, { &d_info, &d_info }), framework::LogLevel::ERRORS);
+    // Mismatching K in one of the problems
+    ARM_COMPUTE_EXPECT(!is_valid_array({ &a_info, &a_info }, { &b_info, &b_info_other_k }, { &d_info, &d_info }), framework::LogLevel::ERRORS);
+    // Problems which are valid on their own but don't have the same shape
+    ARM_COMPUTE_EXPECT(!is_valid_array({ &a_info, &a_info_other_m }, { &b_info }, { &d_info, &d_info_other_m }), framework::LogLevel::ERRORS);
+    // Strided batch in an array
+    ARM_COMPUTE_EXPECT(!is_valid_array({ &a_info_3d }, { &b_info }, { &d_info_3d }), framework::LogLevel::ERRORS);
+    // Unsupported data type
+    ARM_COMPUTE_EXPECT(!is_valid_array({ &a_info_qs8 }, { &b_info_qs8 }, { &d_info_qs8 }), framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEBatchedGEMMFixture = BatchedGEMMValidationFixture<Tensor, Accessor, NEBatchedGEMM, T>;
+template <typename T>
+using NEBatchedGEMMArrayFixture = BatchedGEMMArrayValidationFixture<Tensor, Accessor, NEBatchedGEMM, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEBatchedGEMMFixture<float>, framework::DatasetMode::PRECOMMIT, combine(SmallBatchedGEMMDataset, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallArrays, NEBatchedGEMMArrayFixture<float>, framework::DatasetMode::PRECOMMIT, combine(SmallBatchedGEMMDataset, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate every problem of the batch against its own reference
+    ARM_COMPUTE_EXPECT_EQUAL(_target.size(), _reference.size(), framework::LogLevel::ERRORS);
+
+    for(size_t i = 0; i < _target.size(); ++i)
+    {
+        validate(Accessor(*_target[i]), _reference[i], tolerance_f32);
+    }
+}
+TEST_SUITE_END()
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
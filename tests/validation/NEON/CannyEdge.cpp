@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NECannyEdgeKernel.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NESobel3x3.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/BorderModeDataset.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const auto NormTypes = framework::dataset::make("NormType", { 1, 2 });
+
+/** Counts the elements of the valid region of the target which differ from the reference */
+template <typename T>
+size_t count_mismatches(const ITensor &target, const ITensor &reference)
+{
+    const ValidRegion valid_region = target.info()->valid_region();
+    size_t            mismatches   = 0;
+
+    for(int y = valid_region.anchor[1]; y < valid_region.anchor[1] + static_cast<int>(valid_region.shape[1]); ++y)
+    {
+        for(int x = valid_region.anchor[0]; x < valid_region.anchor[0] + static_cast<int>(valid_region.shape[0]); ++x)
+        {
+            const Coordinates id(x, y);
+            if(*reinterpret_cast<const T *>(target.ptr_to_element(id)) != *reinterpret_cast<const T *>(reference.ptr_to_element(id)))
+            {
+                ++mismatches;
+            }
+        }
+    }
+
+    return mismatches;
+}
+
+/** Checks that NESobel3x3GradientKernel produces exactly the same magnitude and phase as NESobel3x3 followed by NEGradientKernel */
+void validate_fused_sobel3x3_gradient(const TensorShape &shape, BorderMode border_mode, int32_t norm_type)
+{
+    std::mt19937                           generator(library->seed());
+    std::uniform_int_distribution<uint8_t> distribution_u8(0, 255);
+    const uint8_t                          constant_border_value = distribution_u8(generator);
+
+    // Create tensors
+    Tensor src           = create_tensor<Tensor>(shape, DataType::U8);
+    Tensor gx            = create_tensor<Tensor>(shape, DataType::S16);
+    Tensor gy            = create_tensor<Tensor>(shape, DataType::S16);
+    Tensor magnitude     = create_tensor<Tensor>(shape, DataType::U16);
+    Tensor phase         = create_tensor<Tensor>(shape, DataType::U8);
+    Tensor ref_magnitude = create_tensor<Tensor>(shape, DataType::U16);
+    Tensor ref_phase     = create_tensor<Tensor>(shape, DataType::U8);
+
+    // Fused path, configured as in NECannyEdge
+    NESobel3x3GradientKernel fused_gradient;
+    fused_gradient.configure(&src, &magnitude, &phase, norm_type, border_mode == BorderMode::UNDEFINED);
+    NEFillBorderKernel fill_border;
+    fill_border.configure(&src, fused_gradient.border_size(), border_mode, PixelValue(constant_border_value));
+
+    // Separate Sobel and gradient path
+    NESobel3x3 sobel;
+    sobel.configure(&src, &gx, &gy, border_mode, constant_border_value);
+    NEGradientKernel gradient;
+    gradient.configure(&gx, &gy, &ref_magnitude, &ref_phase, norm_type);
+
+    // Allocate tensors
+    src.allocator()->allocate();
+    gx.allocator()->allocate();
+    gy.allocator()->allocate();
+    magnitude.allocator()->allocate();
+    phase.allocator()->allocate();
+    ref_magnitude.allocator()->allocate();
+    ref_phase.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    // Run both paths
+    NEScheduler::get().schedule(&fill_border, Window::DimZ);
+    NEScheduler::get().schedule(&fused_gradient, Window::DimY);
+    sobel.run();
+    NEScheduler::get().schedule(&gradient, Window::DimY);
+
+    // Validate valid regions
+    validate(magnitude.info()->valid_region(), ref_magnitude.info()->valid_region());
+    validate(phase.info()->valid_region(), ref_phase.info()->valid_region());
+
+    // Validate outputs: the results must be bit-identical
+    ARM_COMPUTE_EXPECT(count_mismatches<uint16_t>(magnitude, ref_magnitude) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_mismatches<uint8_t>(phase, ref_phase) == 0, framework::LogLevel::ERRORS);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(CannyEdge)
+TEST_SUITE(FusedSobel3x3Gradient)
+
+DATA_TEST_CASE(RunSmall, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::Small2DShapes(), datasets::BorderModes()), NormTypes),
+               shape, border_mode, norm_type)
+{
+    validate_fused_sobel3x3_gradient(shape, border_mode, norm_type);
+}
+
+DATA_TEST_CASE(RunLarge, framework::DatasetMode::NIGHTLY, combine(combine(datasets::Large2DShapes(), datasets::BorderModes()), NormTypes),
+               shape, border_mode, norm_type)
+{
+    validate_fused_sobel3x3_gradient(shape, border_mode, norm_type);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
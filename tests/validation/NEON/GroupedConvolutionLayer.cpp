@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGroupedConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/SmallConvolutionLayerDataset.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/GroupedConvolutionLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const AbsoluteTolerance<float> tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+const AbsoluteTolerance<float> tolerance_f16(0.01f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F16 */
+#endif                                               /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+const auto NumGroups = framework::dataset::make("NumGroups", { 1U, 2U, 4U });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GroupedConvolutionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
+    framework::dataset::make("InputInfo", { TensorInfo(TensorShape(23U, 27U, 8U), 1, DataType::F32, 0),
+                                            TensorInfo(TensorShape(23U, 27U, 8U), 1, DataType::F32, 0), // Input depth not multiple of the groups
+                                            TensorInfo(TensorShape(23U, 27U, 8U), 1, DataType::F32, 0), // Number of kernels not multiple of the groups
+                                            TensorInfo(TensorShape(23U, 27U, 8U), 1, DataType::F32, 0), // Weights depth does not match
+                                            TensorInfo(TensorShape(23U, 27U, 8U), 1, DataType::F32, 0), // Wrong output shape
+                                          }),
+    framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 4U, 16U), 1, DataType::F32, 0),
+                                              TensorInfo(TensorShape(3U, 3U, 3U, 15U), 1, DataType::F32, 0),
+                                              TensorInfo(TensorShape(3U, 3U, 4U, 15U), 1, DataType::F32, 0),
+                                              TensorInfo(TensorShape(3U, 3U, 8U, 16U), 1, DataType::F32, 0),
+                                              TensorInfo(TensorShape(3U, 3U, 4U, 16U), 1, DataType::F32, 0),
+                                            })),
+    framework::dataset::make("BiasesInfo", { TensorInfo(TensorShape(16U), 1, DataType::F32, 0),
+                                             TensorInfo(TensorShape(15U), 1, DataType::F32, 0),
+                                             TensorInfo(TensorShape(15U), 1, DataType::F32, 0),
+                                             TensorInfo(TensorShape(16U), 1, DataType::F32, 0),
+                                             TensorInfo(TensorShape(16U), 1, DataType::F32, 0),
+                                           })),
+    framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(21U, 25U, 16U), 1, DataType::F32, 0),
+                                             TensorInfo(TensorShape(21U, 25U, 15U), 1, DataType::F32, 0),
+                                             TensorInfo(TensorShape(21U, 25U, 15U), 1, DataType::F32, 0),
+                                             TensorInfo(TensorShape(21U, 25U, 16U), 1, DataType::F32, 0),
+                                             TensorInfo(TensorShape(23U, 27U, 16U), 1, DataType::F32, 0),
+                                           })),
+    framework::dataset::make("NumGroups", { 2U, 3U, 2U, 2U, 2U })),
+    framework::dataset::make("Expected", { true, false, false, false, false })),
+    input_info, weights_info, biases_info, output_info, num_groups, expected)
+{
+    bool is_valid = bool(NEGroupedConvolutionLayer::validate(&input_info.clone()->set_is_resizable(false),
+                                                             &weights_info.clone()->set_is_resizable(false),
+                                                             &biases_info.clone()->set_is_resizable(false),
+                                                             &output_info.clone()->set_is_resizable(false),
+                                                             PadStrideInfo(1, 1, 0, 0), num_groups));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEGroupedConvolutionLayerFixture = GroupedConvolutionValidationFixture<Tensor, Accessor, NEGroupedConvolutionLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGroupedConvolutionLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallGroupedConvolutionLayerDataset(), NumGroups),
+                                                                                                                      framework::dataset::make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+TEST_SUITE_END()
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGroupedConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallGroupedConvolutionLayerDataset(), NumGroups),
+                                                                                                                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END()
+TEST_SUITE_END()
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/HOGInfo.h"
+#include "arm_compute/core/NEON/kernels/NEHOGDetectorKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Array.h"
+#include "arm_compute/runtime/HOG.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "support/ToolchainSupport.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const HOGInfo hog_info(Size2D(8U, 8U), Size2D(16U, 16U), Size2D(64U, 128U), Size2D(8U, 8U), 9U);
+
+/** Sort the detection windows by class and position: the order in which the threads append them is not deterministic */
+std::vector<DetectionWindow> sorted_detection_windows(const IDetectionWindowArray &windows)
+{
+    std::vector<DetectionWindow> sorted(windows.buffer(), windows.buffer() + windows.num_values());
+
+    std::sort(sorted.begin(), sorted.end(), [](const DetectionWindow & lhs, const DetectionWindow & rhs)
+    {
+        return std::tie(lhs.idx_class, lhs.y, lhs.x) < std::tie(rhs.idx_class, rhs.y, rhs.x);
+    });
+
+    return sorted;
+}
+
+bool operator==(const DetectionWindow &lhs, const DetectionWindow &rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.width == rhs.width && lhs.height == rhs.height && lhs.idx_class == rhs.idx_class && lhs.score == rhs.score;
+}
+
+/** Score the windows of a normalized HOG space with one kernel evaluating all the models and with one kernel per model */
+void validate_multi_model(const TensorShape &shape, size_t num_models, const Size2D &detection_window_stride)
+{
+    // Create the models with random weights
+    std::vector<std::unique_ptr<HOG>> hogs;
+    std::vector<const IHOG *>         hog_ptrs;
+    std::vector<uint16_t>             idx_classes;
+    std::mt19937                      gen(library->seed());
+    std::uniform_real_distribution<float> distribution(-0.1f, 0.1f);
+
+    for(size_t m = 0; m < num_models; ++m)
+    {
+        hogs.emplace_back(support::cpp14::make_unique<HOG>());
+        hogs.back()->init(hog_info);
+        std::generate(hogs.back()->descriptor(), hogs.back()->descriptor() + hog_info.descriptor_size(), [&]()
+        {
+            return distribution(gen);
+        });
+
+        hog_ptrs.push_back(hogs.back().get());
+        idx_classes.push_back(m);
+    }
+
+    // Normalized HOG space
+    Tensor src;
+    src.allocator()->init(TensorInfo(hog_info, shape.x(), shape.y()));
+
+    const size_t         max_num_detection_windows = shape.x() * shape.y() * num_models;
+    DetectionWindowArray multi_windows(max_num_detection_windows);
+    DetectionWindowArray single_windows(max_num_detection_windows);
+
+    // Create and configure kernels
+    NEHOGDetectorKernel multi_kernel;
+    multi_kernel.configure(&src, hog_ptrs, &multi_windows, detection_window_stride, 0.0f, idx_classes);
+
+    auto single_kernels = support::cpp14::make_unique<NEHOGDetectorKernel[]>(num_models);
+    for(size_t m = 0; m < num_models; ++m)
+    {
+        single_kernels[m].configure(&src, hog_ptrs[m], &single_windows, detection_window_stride, 0.0f, idx_classes[m]);
+    }
+
+    // Allocate and fill the normalized HOG space
+    src.allocator()->allocate();
+    library->fill(Accessor(src), std::uniform_real_distribution<float>(0.0f, 0.25f), 0);
+
+    // Compute kernels
+    NEScheduler::get().schedule(&multi_kernel, Window::DimY);
+    for(size_t m = 0; m < num_models; ++m)
+    {
+        NEScheduler::get().schedule(single_kernels.get() + m, Window::DimY);
+    }
+
+    // Validate output
+    const std::vector<DetectionWindow> multi  = sorted_detection_windows(multi_windows);
+    const std::vector<DetectionWindow> single = sorted_detection_windows(single_windows);
+
+    ARM_COMPUTE_EXPECT(!single.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(multi.size(), single.size(), framework::LogLevel::ERRORS);
+
+    size_t num_mismatches = 0;
+    for(size_t i = 0; i < std::min(multi.size(), single.size()); ++i)
+    {
+        if(!(multi[i] == single[i]))
+        {
+            ++num_mismatches;
+        }
+    }
+
+    ARM_COMPUTE_EXPECT_EQUAL(num_mismatches, 0U, framework::LogLevel::ERRORS);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(HOGDetector)
+TEST_SUITE(MultiModel)
+
+DATA_TEST_CASE(RunSmall, framework::DatasetMode::PRECOMMIT, combine(combine(framework::dataset::make("Shape", { TensorShape(320U, 240U), TensorShape(150U, 200U) }),
+                                                                            framework::dataset::make("NumModels", { 1, 2, 3, 4 })),
+                                                                    framework::dataset::make("DetectionWindowStride", { Size2D(8U, 8U), Size2D(16U, 16U) })),
+               shape, num_models, detection_window_stride)
+{
+    validate_multi_model(shape, num_models, detection_window_stride);
+}
+
+DATA_TEST_CASE(RunLarge, framework::DatasetMode::NIGHTLY, combine(combine(framework::dataset::make("Shape", { TensorShape(1920U, 1080U) }),
+                                                                          framework::dataset::make("NumModels", { 2, 4 })),
+                                                                  framework::dataset::make("DetectionWindowStride", { Size2D(8U, 8U) })),
+               shape, num_models, detection_window_stride)
+{
+    validate_multi_model(shape, num_models, detection_window_stride);
+}
+
+TEST_SUITE_END() // MultiModel
+TEST_SUITE_END() // HOGDetector
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
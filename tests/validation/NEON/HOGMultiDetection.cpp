@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/HOGInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Array.h"
+#include "arm_compute/runtime/HOG.h"
+#include "arm_compute/runtime/MultiHOG.h"
+#include "arm_compute/runtime/NEON/functions/NEHOGMultiDetection.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const HOGInfo hog_info(Size2D(8U, 8U), Size2D(16U, 16U), Size2D(64U, 128U), Size2D(8U, 8U), 9U);
+
+/** Sort the detection windows by class and position: the order in which the threads append them is not deterministic */
+std::vector<DetectionWindow> sorted_detection_windows(std::vector<DetectionWindow> windows)
+{
+    std::sort(windows.begin(), windows.end(), [](const DetectionWindow & lhs, const DetectionWindow & rhs)
+    {
+        return std::tie(lhs.idx_class, lhs.y, lhs.x) < std::tie(rhs.idx_class, rhs.y, rhs.x);
+    });
+
+    return windows;
+}
+
+bool operator==(const DetectionWindow &lhs, const DetectionWindow &rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.width == rhs.width && lhs.height == rhs.height && lhs.idx_class == rhs.idx_class && lhs.score == rhs.score;
+}
+
+/** Detect with models sharing their geometry, scored together by a single detector kernel, and with one function per model */
+void validate_grouped_models(const TensorShape &shape, size_t num_models)
+{
+    const Size2D detection_window_stride(8U, 8U);
+
+    // Models with random weights, shared by all the functions
+    std::vector<std::vector<float>>       weights(num_models, std::vector<float>(hog_info.descriptor_size()));
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> distribution(-0.1f, 0.1f);
+
+    for(auto &model_weights : weights)
+    {
+        std::generate(model_weights.begin(), model_weights.end(), [&]()
+        {
+            return distribution(gen);
+        });
+    }
+
+    const auto init_model = [&](IHOG * model, size_t m)
+    {
+        static_cast<HOG *>(model)->init(hog_info);
+        std::copy(weights[m].begin(), weights[m].end(), model->descriptor());
+    };
+
+    Tensor src = create_tensor<Tensor>(shape, Format::U8);
+
+    const size_t max_num_detection_windows = shape.x() * shape.y() * num_models;
+
+    // All the models in one function: they are grouped in a single detector kernel
+    MultiHOG    multi_hog(num_models);
+    Size2DArray strides(num_models);
+
+    for(size_t m = 0; m < num_models; ++m)
+    {
+        init_model(multi_hog.model(m), m);
+        strides.push_back(detection_window_stride);
+    }
+
+    DetectionWindowArray grouped_windows(max_num_detection_windows);
+    NEHOGMultiDetection  grouped;
+    grouped.configure(&src, &multi_hog, &grouped_windows, &strides, BorderMode::REPLICATE, 0, 0.0f, false);
+
+    // One function per model
+    std::vector<std::unique_ptr<MultiHOG>>             single_hogs;
+    std::vector<std::unique_ptr<Size2DArray>>          single_strides;
+    std::vector<std::unique_ptr<DetectionWindowArray>> single_windows;
+    std::vector<std::unique_ptr<NEHOGMultiDetection>>  singles;
+
+    for(size_t m = 0; m < num_models; ++m)
+    {
+        single_hogs.emplace_back(support::cpp14::make_unique<MultiHOG>(1));
+        init_model(single_hogs.back()->model(0), m);
+
+        single_strides.emplace_back(support::cpp14::make_unique<Size2DArray>(1));
+        single_strides.back()->push_back(detection_window_stride);
+
+        single_windows.emplace_back(support::cpp14::make_unique<DetectionWindowArray>(max_num_detection_windows));
+
+        singles.emplace_back(support::cpp14::make_unique<NEHOGMultiDetection>());
+        singles.back()->configure(&src, single_hogs.back().get(), single_windows.back().get(), single_strides.back().get(), BorderMode::REPLICATE, 0, 0.0f, false);
+    }
+
+    // Allocate and fill the image
+    src.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    // Compute functions
+    grouped.run();
+
+    std::vector<DetectionWindow> reference;
+    for(size_t m = 0; m < num_models; ++m)
+    {
+        singles[m]->run();
+
+        // The class of a detection is the index of its model in the multi HOG
+        for(size_t i = 0; i < single_windows[m]->num_values(); ++i)
+        {
+            DetectionWindow win = single_windows[m]->at(i);
+            win.idx_class       = m;
+            reference.push_back(win);
+        }
+    }
+
+    // Validate output
+    const std::vector<DetectionWindow> target = sorted_detection_windows(std::vector<DetectionWindow>(grouped_windows.buffer(), grouped_windows.buffer() + grouped_windows.num_values()));
+    reference                                 = sorted_detection_windows(reference);
+
+    ARM_COMPUTE_EXPECT(!reference.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(target.size(), reference.size(), framework::LogLevel::ERRORS);
+
+    size_t num_mismatches = 0;
+    for(size_t i = 0; i < std::min(target.size(), reference.size()); ++i)
+    {
+        if(!(target[i] == reference[i]))
+        {
+            ++num_mismatches;
+        }
+    }
+
+    ARM_COMPUTE_EXPECT_EQUAL(num_mismatches, 0U, framework::LogLevel::ERRORS);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(HOGMultiDetection)
+TEST_SUITE(GroupedModels)
+
+DATA_TEST_CASE(RunSmall, framework::DatasetMode::PRECOMMIT, combine(framework::dataset::make("Shape", { TensorShape(320U, 240U) }),
+                                                                    framework::dataset::make("NumModels", { 2, 4, 6 })),
+               shape, num_models)
+{
+    validate_grouped_models(shape, num_models);
+}
+
+TEST_SUITE_END() // GroupedModels
+TEST_SUITE_END() // HOGMultiDetection
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/MultiImage.h"
+#include "arm_compute/runtime/NEON/functions/NEImagePreprocess.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/ImagePreprocessFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float>   tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);  /**< Tolerance value for comparing reference's output against implementation's output for DataType::QASYMM8 */
+
+/** Source formats, network input sizes and channel orders */
+const auto ImagePreprocessDataset = combine(combine(framework::dataset::make("Format", { Format::RGB888, Format::RGBA8888, Format::NV12, Format::NV21 }),
+                                                    framework::dataset::make("OutputShape", { TensorShape(32U, 24U), TensorShape(17U, 29U) })),
+                                            framework::dataset::make("BGR", { false, true }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ImagePreprocess)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
+    framework::dataset::make("InputInfo", { TensorInfo(TensorShape(27U, 13U), Format::RGB888),
+                                            TensorInfo(TensorShape(27U, 13U), Format::RGBA8888),
+                                            TensorInfo(TensorShape(27U, 13U), Format::U8),        // Unsupported format
+                                            TensorInfo(TensorShape(27U, 13U), Format::RGB888),    // Output with 4 planes
+                                            TensorInfo(TensorShape(27U, 13U), Format::RGB888),    // Unsupported output data type
+                                            TensorInfo(TensorShape(27U, 13U), Format::RGB888),    // Zero standard deviation
+                                          }),
+    framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(16U, 16U, 3U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(16U, 16U, 3U), 1, DataType::QASYMM8, QuantizationInfo(0.02f, 110)),
+                                             TensorInfo(TensorShape(16U, 16U, 3U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(16U, 16U, 4U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(16U, 16U, 3U), 1, DataType::S16),
+                                             TensorInfo(TensorShape(16U, 16U, 3U), 1, DataType::F32),
+                                           })),
+    framework::dataset::make("StdDev", { 58.4f, 1.f, 1.f, 1.f, 1.f, 0.f })),
+    framework::dataset::make("Expected", { true, true, false, false, false, false })),
+    input_info, output_info, std_dev, expected)
+{
+    const Status status = NEImagePreprocess::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), std::array<float, 3> { { std_dev, std_dev, std_dev } });
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEImagePreprocessFixture = ImagePreprocessValidationFixture<MultiImage, Tensor, Accessor, NEImagePreprocess, T>;
+
+TEST_SUITE(Float)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEImagePreprocessFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::Small2DShapes(), ImagePreprocessDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEImagePreprocessFixture<float>, framework::DatasetMode::NIGHTLY, combine(datasets::Large2DShapes(), ImagePreprocessDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END()
+
+TEST_SUITE(Quantized)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEImagePreprocessFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(datasets::Small2DShapes(), ImagePreprocessDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END()
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
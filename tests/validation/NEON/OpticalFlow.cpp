@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/PyramidInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Array.h"
+#include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
+#include "arm_compute/runtime/NEON/functions/NEOpticalFlow.h"
+#include "arm_compute/runtime/Pyramid.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+#include <array>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr unsigned int num_frames       = 5;
+constexpr size_t       num_levels       = 3;
+constexpr size_t       window_dimension = 5;
+constexpr unsigned int num_iterations   = 20;
+constexpr int          grid_step        = 8;
+
+/** Image and Gaussian pyramid of one frame */
+struct FramePyramid
+{
+    void configure(const TensorShape &shape, BorderMode border_mode)
+    {
+        src = create_tensor<Tensor>(shape, Format::U8);
+        pyramid.init(PyramidInfo(num_levels, SCALE_PYRAMID_HALF, shape, Format::U8));
+        pyramid_func.configure(&src, &pyramid, border_mode, 0);
+
+        src.allocator()->allocate();
+        pyramid.allocate();
+    }
+
+    /** Write a frame to the image and build its pyramid
+     *
+     * Frame @p frame is the window of @p pattern starting at column @p frame, so that the content moves by one pixel from one frame to the next.
+     */
+    void load(const std::vector<uint8_t> &pattern, size_t pattern_width, unsigned int frame)
+    {
+        Window window;
+        window.use_tensor_dimensions(src.info()->tensor_shape());
+
+        Iterator it(&src, window);
+
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            *it.ptr() = pattern[id.y() * pattern_width + id.x() + frame];
+        },
+        it);
+
+        pyramid_func.run();
+    }
+
+    Tensor                src{};
+    Pyramid               pyramid{};
+    NEGaussianPyramidHalf pyramid_func{};
+};
+
+/** Track the key points with a function configured for the pair of pyramids */
+void track_pair(const Pyramid &old_pyramid, const Pyramid &new_pyramid, const KeyPointArray &old_points, const KeyPointArray &new_points_estimates,
+                KeyPointArray &new_points, BorderMode border_mode)
+{
+    NEOpticalFlow optical_flow;
+    optical_flow.configure(&old_pyramid, &new_pyramid, &old_points, &new_points_estimates, &new_points,
+                           Termination::TERM_CRITERIA_BOTH, 0.01f, num_iterations, window_dimension, false, border_mode, 0);
+    optical_flow.run();
+}
+
+bool operator==(const KeyPoint &lhs, const KeyPoint &rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.strength == rhs.strength && lhs.scale == rhs.scale && lhs.orientation == rhs.orientation
+           && lhs.tracking_status == rhs.tracking_status && lhs.error == rhs.error;
+}
+
+void validate_streaming(const TensorShape &shape, BorderMode border_mode)
+{
+    const size_t width  = shape.x();
+    const size_t height = shape.y();
+
+    // Random pattern wide enough to slide the frames across it
+    const size_t                       pattern_width = width + num_frames;
+    std::vector<uint8_t>               pattern(pattern_width * height);
+    std::mt19937                       gen(library->seed());
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    for(auto &value : pattern)
+    {
+        value = static_cast<uint8_t>(distribution(gen));
+    }
+
+    // Key points on a regular grid, away from the borders
+    const int border     = static_cast<int>(window_dimension);
+    const int num_points = ((width - 2 * border) / grid_step + 1) * ((height - 2 * border) / grid_step + 1);
+
+    KeyPointArray old_points(num_points);
+    KeyPointArray new_points_estimates(num_points);
+    KeyPointArray new_points(num_points);
+    KeyPointArray ref_new_points(num_points);
+
+    for(int y = border; y <= static_cast<int>(height) - border; y += grid_step)
+    {
+        for(int x = border; x <= static_cast<int>(width) - border; x += grid_step)
+        {
+            KeyPoint point;
+            point.x               = x;
+            point.y               = y;
+            point.tracking_status = 1;
+            old_points.push_back(point);
+            new_points_estimates.push_back(point);
+        }
+    }
+
+    // Pair of pyramids used by the streaming function, and pair rebuilt for every reference run
+    std::array<FramePyramid, 2> stream_pyramids;
+    std::array<FramePyramid, 2> ref_pyramids;
+
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+        stream_pyramids[i].configure(shape, border_mode);
+        ref_pyramids[i].configure(shape, border_mode);
+    }
+
+    NEOpticalFlow optical_flow;
+    optical_flow.configure_streaming(&stream_pyramids[0].pyramid, &stream_pyramids[1].pyramid, &old_points, &new_points_estimates, &new_points,
+                                     Termination::TERM_CRITERIA_BOTH, 0.01f, num_iterations, window_dimension, false, border_mode, 0);
+
+    ARM_COMPUTE_EXPECT(optical_flow.old_pyramid() == &stream_pyramids[0].pyramid, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(optical_flow.new_pyramid() == &stream_pyramids[1].pyramid, framework::LogLevel::ERRORS);
+
+    stream_pyramids[0].load(pattern, pattern_width, 0);
+
+    for(unsigned int frame = 1; frame < num_frames; ++frame)
+    {
+        if(frame > 1)
+        {
+            const Pyramid *previous_new_pyramid = optical_flow.new_pyramid();
+
+            optical_flow.next_frame();
+
+            // The pyramids swap roles: the previous new frame is not rebuilt
+            ARM_COMPUTE_EXPECT(optical_flow.old_pyramid() == previous_new_pyramid, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(optical_flow.new_pyramid() != previous_new_pyramid, framework::LogLevel::ERRORS);
+        }
+
+        // Write the next frame to the pyramid given by the function
+        FramePyramid &new_frame = (optical_flow.new_pyramid() == &stream_pyramids[0].pyramid) ? stream_pyramids[0] : stream_pyramids[1];
+        new_frame.load(pattern, pattern_width, frame);
+
+        optical_flow.run();
+
+        // Reference: track the same key points between the same two frames with a function configured for the pair
+        ref_pyramids[0].load(pattern, pattern_width, frame - 1);
+        ref_pyramids[1].load(pattern, pattern_width, frame);
+        track_pair(ref_pyramids[0].pyramid, ref_pyramids[1].pyramid, old_points, new_points_estimates, ref_new_points, border_mode);
+
+        // Validate output
+        ARM_COMPUTE_EXPECT_EQUAL(new_points.num_values(), ref_new_points.num_values(), framework::LogLevel::ERRORS);
+
+        size_t num_mismatches = 0;
+
+        for(size_t i = 0; i < new_points.num_values(); ++i)
+        {
+            if(!(new_points.at(i) == ref_new_points.at(i)))
+            {
+                ++num_mismatches;
+            }
+        }
+
+        ARM_COMPUTE_EXPECT_EQUAL(num_mismatches, 0U, framework::LogLevel::ERRORS);
+
+        // The tracked key points are the old key points of the next frame
+        for(size_t i = 0; i < new_points.num_values(); ++i)
+        {
+            old_points.at(i)           = new_points.at(i);
+            new_points_estimates.at(i) = new_points.at(i);
+        }
+    }
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(OpticalFlow)
+TEST_SUITE(Streaming)
+
+DATA_TEST_CASE(RunSmall, framework::DatasetMode::PRECOMMIT, combine(framework::dataset::make("Shape", { TensorShape(64U, 48U), TensorShape(83U, 72U) }),
+                                                                    framework::dataset::make("BorderMode", { BorderMode::UNDEFINED, BorderMode::REPLICATE })),
+               shape, border_mode)
+{
+    validate_streaming(shape, border_mode);
+}
+
+DATA_TEST_CASE(RunLarge, framework::DatasetMode::NIGHTLY, combine(framework::dataset::make("Shape", { TensorShape(640U, 480U), TensorShape(1245U, 652U) }),
+                                                                  framework::dataset::make("BorderMode", { BorderMode::UNDEFINED, BorderMode::REPLICATE })),
+               shape, border_mode)
+{
+    validate_streaming(shape, border_mode);
+}
+
+TEST_SUITE_END() // Streaming
+TEST_SUITE_END() // OpticalFlow
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -44,6 +44,7 @@ namespace validation
 namespace
 {
 constexpr AbsoluteTolerance<uint8_t> tolerance_value(0);
+constexpr AbsoluteTolerance<uint8_t> tolerance_compressed(1); /**< Tolerance for the fractional coordinates decoded from compressed maps */
 constexpr float                      tolerance_number = 0.f;
 } // namespace
 
@@ -104,6 +105,23 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NERemapFixture<uint8_t>, framework::DatasetMode
     // Validate output
     validate(Accessor(_target), _reference, _valid_mask, tolerance_value, tolerance_number);
 }
+
+template <typename T>
+using NERemapCompressedMapsFixture = RemapCompressedMapsValidationFixture<Tensor, Accessor, NERemap, T>;
+
+TEST_SUITE(CompressedMaps)
+FIXTURE_DATA_TEST_CASE(RunSmall, NERemapCompressedMapsFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(datasets::SmallShapes(),
+                                                                                                                       framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::NEAREST_NEIGHBOR, InterpolationPolicy::BILINEAR })),
+                                                                                                                       framework::dataset::make("DataType", DataType::U8)),
+                                                                                                                       framework::dataset::make("BorderModes", { BorderMode::UNDEFINED, BorderMode::CONSTANT })),
+                                                                                                                       concat(combine(framework::dataset::make("MapDataType", DataType::QS16), framework::dataset::make("MapSubsampling", { 1U, 2U, 4U })),
+                                                                                                                              combine(framework::dataset::make("MapDataType", DataType::F32), framework::dataset::make("MapSubsampling", { 2U, 4U })))))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, _valid_mask, tolerance_compressed, tolerance_number);
+}
+TEST_SUITE_END()
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace validation
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEResize.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/ResizeFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<uint8_t> tolerance_u8(1); /**< Tolerance value for comparing reference's output against implementation's output for U8 (fixed-point coefficients) */
+
+/** Formats supported by NEResize */
+const auto ResizeFormats = framework::dataset::make("Format", { Format::U8, Format::RGB888, Format::RGBA8888 });
+
+/** Interpolation policies supported by NEResize */
+const auto ResizeInterpolationPolicies = framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::NEAREST_NEIGHBOR,
+                                                                                           InterpolationPolicy::BILINEAR,
+                                                                                           InterpolationPolicy::BICUBIC,
+                                                                                           InterpolationPolicy::AREA
+                                                                                         });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Resize)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
+    framework::dataset::make("InputInfo", { TensorInfo(TensorShape(27U, 13U), Format::U8),
+                                            TensorInfo(TensorShape(27U, 13U), Format::RGB888),
+                                            TensorInfo(TensorShape(27U, 13U), Format::RGB888),   // Mismatching formats
+                                            TensorInfo(TensorShape(27U, 13U), Format::F32),      // Unsupported format
+                                            TensorInfo(TensorShape(27U, 13U, 2U), Format::U8),   // Mismatching batches
+                                            TensorInfo(TensorShape(27U, 13U), Format::U8),
+                                          }),
+    framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(54U, 7U), Format::U8),
+                                             TensorInfo(TensorShape(9U, 40U), Format::RGB888),
+                                             TensorInfo(TensorShape(9U, 40U), Format::RGBA8888),
+                                             TensorInfo(TensorShape(9U, 40U), Format::F32),
+                                             TensorInfo(TensorShape(9U, 40U, 3U), Format::U8),
+                                             TensorInfo(TensorShape(9U, 40U), Format::U8),
+                                           })),
+    framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::BICUBIC,
+                                                      InterpolationPolicy::AREA,
+                                                      InterpolationPolicy::BILINEAR,
+                                                      InterpolationPolicy::BILINEAR,
+                                                      InterpolationPolicy::BILINEAR,
+                                                      InterpolationPolicy::NEAREST_NEIGHBOR,
+                                                    })),
+    framework::dataset::make("Expected", { true, true, false, false, false, true })),
+    input_info, output_info, policy, expected)
+{
+    const Status status = NEResize::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), policy);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEResizeFixture = ResizeValidationFixture<Tensor, Accessor, NEResize, T>;
+
+FIXTURE_DATA_TEST_CASE(RunSmall, NEResizeFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::Small2DShapes(), ResizeFormats),
+                                                                                                                      ResizeInterpolationPolicies),
+                                                                                                              framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER, SamplingPolicy::TOP_LEFT })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_u8);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEResizeFixture<uint8_t>, framework::DatasetMode::NIGHTLY, combine(combine(combine(datasets::Large2DShapes(), ResizeFormats),
+                                                                                                                    ResizeInterpolationPolicies),
+                                                                                                            framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_u8);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -84,6 +84,54 @@ TEST_CASE(ImportMemory, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(t4.buffer() == nullptr, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(ImportRawMemory, framework::DatasetMode::ALL)
+{
+    // U8 image with 48 bytes between the beginning of two rows
+    TensorInfo info;
+    info.init_with_row_stride(TensorShape(40U, 16U), Format::U8, 48);
+
+    // Allocate memory buffer
+    std::unique_ptr<uint8_t[]> buf(new uint8_t[info.total_size() + 1]());
+
+    // Negative case : Import null memory
+    Tensor t1;
+    t1.allocator()->init(info);
+    ARM_COMPUTE_EXPECT(!bool(t1.allocator()->import_memory(nullptr, info.total_size())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t1.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+    // Negative case : Import memory smaller than the tensor
+    Tensor t2;
+    t2.allocator()->init(info);
+    ARM_COMPUTE_EXPECT(!bool(t2.allocator()->import_memory(buf.get(), info.total_size() - 1)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t2.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+    // Negative case : Import memory to a tensor without info
+    Tensor t3;
+    ARM_COMPUTE_EXPECT(!bool(t3.allocator()->import_memory(buf.get(), info.total_size())), framework::LogLevel::ERRORS);
+
+    // Positive case : Rows are accessed with the given stride
+    Tensor t4;
+    t4.allocator()->init(info);
+    ARM_COMPUTE_EXPECT(bool(t4.allocator()->import_memory(buf.get(), info.total_size())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!t4.info()->is_resizable(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t4.buffer() == buf.get(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t4.ptr_to_element(Coordinates(3, 2)) == buf.get() + 2 * 48 + 3, framework::LogLevel::ERRORS);
+
+    // Negative case : Import memory to a tensor which already has some
+    ARM_COMPUTE_EXPECT(!bool(t4.allocator()->import_memory(buf.get() + 1, info.total_size())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t4.buffer() == buf.get(), framework::LogLevel::ERRORS);
+
+    // The imported memory is not owned by the tensor
+    t4.allocator()->free();
+    ARM_COMPUTE_EXPECT(t4.info()->is_resizable(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t4.buffer() == nullptr, framework::LogLevel::ERRORS);
+
+    // Negative case : Import misaligned memory
+    Tensor t5;
+    t5.allocator()->init(TensorInfo(TensorShape(8U, 8U), 1, DataType::F32));
+    ARM_COMPUTE_EXPECT(!bool(t5.allocator()->import_memory(buf.get() + 1, t5.info()->total_size())), framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
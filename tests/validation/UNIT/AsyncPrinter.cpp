@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/utils/logging/AsyncPrinter.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::logging;
+using namespace arm_compute::test;
+using namespace arm_compute::test::validation;
+
+namespace
+{
+/** Printer storing the messages it receives, optionally blocked until released */
+class CapturePrinter final : public Printer
+{
+public:
+    /** Make the next calls to print block until @ref unblock is called */
+    void block()
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _blocked = true;
+    }
+    /** Let the blocked calls to print return */
+    void unblock()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _blocked = false;
+        }
+        _cv.notify_all();
+    }
+    /** Wait until @p count messages have been received */
+    void wait_for_messages(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cv.wait(lock, [&] { return _messages.size() >= count; });
+    }
+    /** Messages received so far */
+    std::vector<std::string> messages()
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        return _messages;
+    }
+
+private:
+    void print_internal(const std::string &msg) override
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _messages.push_back(msg);
+        _cv.notify_all();
+        _cv.wait(lock, [&] { return !_blocked; });
+    }
+
+    std::mutex               _mtx{};
+    std::condition_variable  _cv{};
+    bool                     _blocked{ false };
+    std::vector<std::string> _messages{};
+};
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(AsyncPrinter)
+
+#ifndef NO_MULTI_THREADING
+TEST_CASE(MultipleProducers, framework::DatasetMode::ALL)
+{
+    constexpr int num_producers = 4;
+    constexpr int num_messages  = 1000;
+
+    auto         capture = std::make_shared<CapturePrinter>();
+    AsyncPrinter printer(capture, num_producers * num_messages);
+
+    std::vector<std::thread> producers;
+    for(int p = 0; p < num_producers; ++p)
+    {
+        producers.emplace_back([&printer, p]
+        {
+            for(int i = 0; i < num_messages; ++i)
+            {
+                printer.print(support::cpp11::to_string(p) + ":" + support::cpp11::to_string(i));
+            }
+        });
+    }
+    for(auto &producer : producers)
+    {
+        producer.join();
+    }
+
+    printer.flush();
+
+    ARM_COMPUTE_EXPECT_EQUAL(printer.dropped(), 0U, framework::LogLevel::ERRORS);
+
+    // Every message is printed exactly once, in order for a given producer
+    const std::vector<std::string> messages = capture->messages();
+    ARM_COMPUTE_EXPECT_EQUAL(messages.size(), static_cast<size_t>(num_producers * num_messages), framework::LogLevel::ERRORS);
+
+    std::vector<int> next_message(num_producers, 0);
+    bool             in_order = true;
+    for(const auto &msg : messages)
+    {
+        const size_t separator = msg.find(':');
+        const int    p         = support::cpp11::stoi(msg.substr(0, separator));
+        const int    i         = support::cpp11::stoi(msg.substr(separator + 1));
+
+        in_order = in_order && (p >= 0) && (p < num_producers) && (i == next_message[p]);
+        if(p >= 0 && p < num_producers)
+        {
+            next_message[p] = i + 1;
+        }
+    }
+
+    ARM_COMPUTE_EXPECT(in_order, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::all_of(next_message.begin(), next_message.end(), [](int count)
+    {
+        return count == num_messages;
+    }),
+    framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Dropped, framework::DatasetMode::ALL)
+{
+    constexpr size_t capacity     = 4;
+    constexpr size_t num_overflow = 3;
+
+    auto         capture = std::make_shared<CapturePrinter>();
+    AsyncPrinter printer(capture, capacity);
+
+    // Block the background thread in the wrapped printer: the buffer can't be emptied
+    capture->block();
+    printer.print("first");
+    capture->wait_for_messages(1);
+
+    for(size_t i = 0; i < capacity + num_overflow; ++i)
+    {
+        printer.print("message " + support::cpp11::to_string(i));
+    }
+
+    ARM_COMPUTE_EXPECT_EQUAL(printer.dropped(), num_overflow, framework::LogLevel::ERRORS);
+
+    capture->unblock();
+    printer.flush();
+
+    // The messages which fitted are printed, followed by the number of dropped messages
+    const std::vector<std::string> messages = capture->messages();
+
+    ARM_COMPUTE_EXPECT_EQUAL(messages.size(), capacity + 2, framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < capacity && i + 1 < messages.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT_EQUAL(messages[i + 1], "message " + support::cpp11::to_string(i), framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT_EQUAL(messages.back(), "[AsyncPrinter] " + support::cpp11::to_string(num_overflow) + " message(s) dropped", framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Truncated, framework::DatasetMode::ALL)
+{
+    constexpr size_t record_size = 8;
+
+    auto         capture = std::make_shared<CapturePrinter>();
+    AsyncPrinter printer(capture, 16, record_size);
+
+    printer.print("0123456789");
+    printer.print("01234567");
+    printer.print("short");
+    printer.flush();
+
+    ARM_COMPUTE_EXPECT_EQUAL(printer.truncated(), 1U, framework::LogLevel::ERRORS);
+
+    const std::vector<std::string> messages = capture->messages();
+    ARM_COMPUTE_EXPECT_EQUAL(messages.size(), 3U, framework::LogLevel::ERRORS);
+    if(messages.size() == 3)
+    {
+        ARM_COMPUTE_EXPECT_EQUAL(messages[0], "01234567", framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT_EQUAL(messages[1], "01234567", framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT_EQUAL(messages[2], "short", framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(DrainOnDestruction, framework::DatasetMode::ALL)
+{
+    constexpr size_t num_messages = 100;
+
+    auto        capture = std::make_shared<CapturePrinter>();
+    std::thread releaser;
+    {
+        AsyncPrinter printer(capture, num_messages);
+
+        // Keep the messages queued until the printer is being destroyed
+        capture->block();
+        for(size_t i = 0; i < num_messages; ++i)
+        {
+            printer.print("message " + support::cpp11::to_string(i));
+        }
+
+        releaser = std::thread([&capture]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            capture->unblock();
+        });
+    }
+    releaser.join();
+
+    const std::vector<std::string> messages = capture->messages();
+    ARM_COMPUTE_EXPECT_EQUAL(messages.size(), num_messages, framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < std::min(num_messages, messages.size()); ++i)
+    {
+        ARM_COMPUTE_EXPECT_EQUAL(messages[i], "message " + support::cpp11::to_string(i), framework::LogLevel::ERRORS);
+    }
+}
+
+#endif /* NO_MULTI_THREADING */
+
+TEST_SUITE_END()
+TEST_SUITE_END()
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "tests/Globals.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "utils/Utils.h"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+#ifndef BARE_METAL
+namespace
+{
+const std::string packed_filename = "UNIT_PackedWeightsFile.aclpack";
+
+/** Appends a little-endian integer to a buffer */
+template <typename T>
+void append_value(std::vector<uint8_t> &buffer, T value)
+{
+    for(size_t i = 0; i < sizeof(T); ++i)
+    {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+/** Creates a version 1 .npy file holding a 1D float array of the given size */
+std::vector<uint8_t> make_npy(size_t num_elements, std::mt19937 &gen)
+{
+    std::string header = "{'descr': '<f4', 'fortran_order': False, 'shape': (" + support::cpp11::to_string(num_elements) + ",), }";
+    // The header is padded with spaces and terminated by a new line so that the data is 16 bytes aligned
+    while((10 + header.size() + 1) % 16 != 0)
+    {
+        header += ' ';
+    }
+    header += '\n';
+
+    std::vector<uint8_t> npy = { 0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0 };
+    append_value<uint16_t>(npy, static_cast<uint16_t>(header.size()));
+    npy.insert(npy.end(), header.begin(), header.end());
+
+    std::uniform_int_distribution<int> distribution(0, 255);
+    for(size_t i = 0; i < num_elements * sizeof(float); ++i)
+    {
+        npy.push_back(static_cast<uint8_t>(distribution(gen)));
+    }
+    return npy;
+}
+
+/** Packs named .npy files the same way as scripts/pack_npy_weights.py */
+std::vector<uint8_t> pack(const std::vector<std::pair<std::string, std::vector<uint8_t>>> &entries)
+{
+    const auto align = [](size_t offset)
+    {
+        return (offset + 63) / 64 * 64;
+    };
+
+    size_t index_size = 16;
+    for(const auto &e : entries)
+    {
+        index_size += 4 + e.first.size() + 16;
+    }
+
+    std::vector<size_t> offsets;
+    size_t              offset = align(index_size);
+    for(const auto &e : entries)
+    {
+        offsets.push_back(offset);
+        offset = align(offset + e.second.size());
+    }
+
+    std::vector<uint8_t> packed = { 'A', 'C', 'L', 'P', 'A', 'C', 'K', '\0' };
+    append_value<uint32_t>(packed, 1);
+    append_value<uint32_t>(packed, static_cast<uint32_t>(entries.size()));
+    for(size_t i = 0; i < entries.size(); ++i)
+    {
+        append_value<uint32_t>(packed, static_cast<uint32_t>(entries[i].first.size()));
+        packed.insert(packed.end(), entries[i].first.begin(), entries[i].first.end());
+        append_value<uint64_t>(packed, offsets[i]);
+        append_value<uint64_t>(packed, entries[i].second.size());
+    }
+    for(size_t i = 0; i < entries.size(); ++i)
+    {
+        packed.resize(offsets[i], 0);
+        packed.insert(packed.end(), entries[i].second.begin(), entries[i].second.end());
+    }
+    return packed;
+}
+
+void write_file(const std::vector<uint8_t> &data, size_t size)
+{
+    std::ofstream out(packed_filename, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(data.data()), size);
+}
+
+/** Returns true if mapping the file raised an error */
+bool fails_to_load()
+{
+    try
+    {
+        utils::PackedWeightsFile file(packed_filename);
+    }
+    catch(const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+std::vector<std::pair<std::string, std::vector<uint8_t>>> make_entries()
+{
+    std::mt19937 gen(library->seed());
+    return { { "conv1_w.npy", make_npy(27, gen) }, { "conv1_b.npy", make_npy(3, gen) }, { "fc/fc8_w.npy", make_npy(1000, gen) } };
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(PackedWeightsFile)
+
+TEST_CASE(RoundTrip, framework::DatasetMode::ALL)
+{
+    const auto                 entries = make_entries();
+    const std::vector<uint8_t> packed  = pack(entries);
+    write_file(packed, packed.size());
+
+    {
+        utils::PackedWeightsFile file(packed_filename);
+        for(const auto &e : entries)
+        {
+            const std::pair<uint8_t *, size_t> entry = file.entry(e.first);
+            ARM_COMPUTE_EXPECT(entry.second == e.second.size(), framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(std::equal(e.second.begin(), e.second.end(), entry.first), framework::LogLevel::ERRORS);
+            // Entries must keep the alignment of the packer
+            ARM_COMPUTE_EXPECT(((entry.first - file.entry(entries[0].first).first) % 64) == 0, framework::LogLevel::ERRORS);
+        }
+    }
+
+    std::remove(packed_filename.c_str());
+}
+
+TEST_CASE(Truncated, framework::DatasetMode::ALL)
+{
+    const auto                 entries = make_entries();
+    const std::vector<uint8_t> packed  = pack(entries);
+
+    // Cut the file in the header, in the middle of a name, of an offset and of the data of the last entry
+    const size_t first_name = 16 + 4;
+    for(size_t size : { size_t(0), size_t(7), size_t(12), first_name + 3, first_name + entries[0].first.size() + 5, packed.size() - 1 })
+    {
+        write_file(packed, size);
+        ARM_COMPUTE_EXPECT(fails_to_load(), framework::LogLevel::ERRORS);
+    }
+
+    std::remove(packed_filename.c_str());
+}
+
+TEST_CASE(Corrupted, framework::DatasetMode::ALL)
+{
+    const auto           entries = make_entries();
+    std::vector<uint8_t> packed  = pack(entries);
+
+    // Number of entries larger than the index
+    std::vector<uint8_t> too_many_entries = packed;
+    too_many_entries[12]                  = 0xFF;
+    too_many_entries[13]                  = 0xFF;
+    write_file(too_many_entries, too_many_entries.size());
+    ARM_COMPUTE_EXPECT(fails_to_load(), framework::LogLevel::ERRORS);
+
+    // Name length past the end of the file
+    std::vector<uint8_t> long_name = packed;
+    long_name[19]                  = 0x7F;
+    write_file(long_name, long_name.size());
+    ARM_COMPUTE_EXPECT(fails_to_load(), framework::LogLevel::ERRORS);
+
+    // Offset + size overflowing
+    const size_t         first_offset = 16 + 4 + entries[0].first.size();
+    std::vector<uint8_t> overflow     = packed;
+    for(size_t i = 0; i < 8; ++i)
+    {
+        overflow[first_offset + 8 + i] = 0xFF;
+    }
+    write_file(overflow, overflow.size());
+    ARM_COMPUTE_EXPECT(fails_to_load(), framework::LogLevel::ERRORS);
+
+    // Wrong magic string
+    std::vector<uint8_t> bad_magic = packed;
+    bad_magic[0]                   = 'X';
+    write_file(bad_magic, bad_magic.size());
+    ARM_COMPUTE_EXPECT(fails_to_load(), framework::LogLevel::ERRORS);
+
+    std::remove(packed_filename.c_str());
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+#endif /* BARE_METAL */
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+using namespace arm_compute::test::validation;
+
+namespace
+{
+constexpr unsigned int num_iterations = 64;
+
+/** Kernel spending a little time on each iteration of a 1D window */
+class BusyKernel : public ICPPKernel
+{
+public:
+    BusyKernel()
+    {
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, num_iterations, 1));
+        ICPPKernel::configure(win);
+    }
+    const char *name() const override
+    {
+        return "BusyKernel";
+    }
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+
+        for(int x = window.x().start(); x < window.x().end(); x += window.x().step())
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+        }
+    }
+};
+
+/** Restore the number of threads and the state of the counters of the scheduler when leaving the test */
+class SchedulerStateGuard
+{
+public:
+    SchedulerStateGuard(IScheduler &scheduler)
+        : _scheduler(scheduler), _num_threads(scheduler.num_threads()), _counters_enabled(scheduler.counters_enabled())
+    {
+    }
+    ~SchedulerStateGuard()
+    {
+        _scheduler.set_num_threads(_num_threads);
+        _scheduler.set_counters_enabled(_counters_enabled);
+        _scheduler.reset_counters();
+    }
+
+private:
+    IScheduler        &_scheduler;
+    const unsigned int _num_threads;
+    const bool         _counters_enabled;
+};
+
+/** Number of threads to request: the single thread scheduler only accepts one, in which case the kernels run serially */
+unsigned int num_threads_to_request()
+{
+    return (Scheduler::get_type() == Scheduler::Type::ST) ? 1U : 4U;
+}
+
+bool all_zero(const SchedulerCounters &counters)
+{
+    bool zero = counters.kernels == 0 && counters.serial_kernels == 0 && counters.windows == 0 && counters.schedule_time == 0 && counters.dispatch_time == 0
+                && counters.wait_time == 0;
+
+    for(const auto &thread : counters.threads)
+    {
+        zero = zero && thread.windows == 0 && thread.busy_time == 0 && thread.wakeups == 0 && thread.wakeup_latency == 0 && thread.max_wakeup_latency == 0;
+    }
+
+    return zero;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(SchedulerCounters)
+
+TEST_CASE(ParallelKernel, framework::DatasetMode::ALL)
+{
+    IScheduler         &scheduler = Scheduler::get();
+    SchedulerStateGuard guard(scheduler);
+
+    // Ask for several threads if the scheduler supports them: with a single window the kernel runs serially
+    scheduler.set_num_threads(num_threads_to_request());
+    scheduler.set_counters_enabled(true);
+    scheduler.reset_counters();
+
+    ARM_COMPUTE_EXPECT(scheduler.counters_enabled(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(all_zero(scheduler.counters()), framework::LogLevel::ERRORS);
+
+    BusyKernel kernel;
+    scheduler.schedule(&kernel, Window::DimX);
+
+    const SchedulerCounters counters    = scheduler.counters();
+    const unsigned int      num_windows = std::min(num_iterations, scheduler.num_threads());
+
+    ARM_COMPUTE_EXPECT_EQUAL(counters.kernels, 1U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(counters.serial_kernels, num_windows == 1 ? 1U : 0U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(counters.windows, num_windows, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(counters.schedule_time > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(counters.threads.size() >= num_windows, framework::LogLevel::ERRORS);
+
+    // Each window ran on its own thread
+    uint64_t thread_windows = 0;
+
+    for(size_t t = 0; t < counters.threads.size(); ++t)
+    {
+        const ThreadCounters &thread = counters.threads[t];
+
+        if(t < num_windows)
+        {
+            ARM_COMPUTE_EXPECT_EQUAL(thread.windows, 1U, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(thread.busy_time > 0, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(thread.busy_time <= counters.elapsed_time, framework::LogLevel::ERRORS);
+        }
+        else
+        {
+            ARM_COMPUTE_EXPECT_EQUAL(thread.windows, 0U, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT_EQUAL(thread.busy_time, 0U, framework::LogLevel::ERRORS);
+        }
+
+        thread_windows += thread.windows;
+    }
+
+    ARM_COMPUTE_EXPECT_EQUAL(thread_windows, counters.windows, framework::LogLevel::ERRORS);
+
+    // Reset clears all the counters
+    scheduler.reset_counters();
+
+    const SchedulerCounters reset_counters = scheduler.counters();
+
+    ARM_COMPUTE_EXPECT(all_zero(reset_counters), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(reset_counters.threads.size(), counters.threads.size(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Disabled, framework::DatasetMode::ALL)
+{
+    IScheduler         &scheduler = Scheduler::get();
+    SchedulerStateGuard guard(scheduler);
+
+    scheduler.set_num_threads(num_threads_to_request());
+    scheduler.set_counters_enabled(false);
+    scheduler.reset_counters();
+
+    ARM_COMPUTE_EXPECT(!scheduler.counters_enabled(), framework::LogLevel::ERRORS);
+
+    BusyKernel kernel;
+    scheduler.schedule(&kernel, Window::DimX);
+
+    ARM_COMPUTE_EXPECT(all_zero(scheduler.counters()), framework::LogLevel::ERRORS);
+
+    // Disabling keeps the values recorded so far
+    scheduler.set_counters_enabled(true);
+    scheduler.schedule(&kernel, Window::DimX);
+    scheduler.set_counters_enabled(false);
+    scheduler.schedule(&kernel, Window::DimX);
+
+    ARM_COMPUTE_EXPECT_EQUAL(scheduler.counters().kernels, 1U, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
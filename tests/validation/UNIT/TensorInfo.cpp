@@ -128,6 +128,26 @@ TEST_CASE(TensorInfoBuild, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(info.tensor_shape() == TensorShape(13U, 15U), framework::LogLevel::ERRORS);
 }
 
+/** Validates that the row stride given to TensorInfo is exposed as right padding */
+TEST_CASE(RowStride, framework::DatasetMode::ALL)
+{
+    // RGB888 image with 64 bytes between the beginning of two rows: 4 bytes gap, of which 1 whole element
+    TensorInfo info;
+    info.init_with_row_stride(TensorShape(20U, 8U), Format::RGB888, 64);
+
+    ARM_COMPUTE_EXPECT(info.format() == Format::RGB888, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.strides_in_bytes()[1] == 64, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.offset_first_element_in_bytes() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.total_size() == 8 * 64, framework::LogLevel::ERRORS);
+    validate(info.padding(), PaddingSize(0, 1, 0, 0));
+
+    // F32 tensor whose rows are tightly packed
+    info.init_with_row_stride(TensorShape(16U, 4U, 2U), 1, DataType::F32, 16 * sizeof(float));
+
+    ARM_COMPUTE_EXPECT(!info.has_padding(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.total_size() == 16 * 4 * 2 * sizeof(float), framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END() // TensorInfoValidation
 TEST_SUITE_END()
 } // namespace validation
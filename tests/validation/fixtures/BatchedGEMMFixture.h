@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_BATCHED_GEMM_FIXTURE
+#define ARM_COMPUTE_TEST_BATCHED_GEMM_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "support/ToolchainSupport.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class BatchedGEMMValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape output_shape, float alpha, float beta, DataType data_type)
+    {
+        _data_type = data_type;
+
+        _target    = compute_target(shape_a, shape_b, output_shape, alpha, beta);
+        _reference = compute_reference(shape_a, shape_b, output_shape, alpha, beta);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, float alpha, float beta)
+    {
+        // Create tensors
+        TensorType a   = create_tensor<TensorType>(shape_a, _data_type);
+        TensorType b   = create_tensor<TensorType>(shape_b, _data_type);
+        TensorType dst = create_tensor<TensorType>(output_shape, _data_type);
+
+        // Create and configure function
+        FunctionType gemm;
+        gemm.configure(&a, &b, &dst, alpha, beta);
+
+        ARM_COMPUTE_EXPECT(a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors: the destination holds the matrices C which are accumulated when beta is not zero
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+        fill(AccessorType(dst), 2);
+
+        // Compute GEMM function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, float alpha, float beta)
+    {
+        // Create reference
+        SimpleTensor<T> a{ shape_a, _data_type };
+        SimpleTensor<T> b{ shape_b, _data_type };
+        SimpleTensor<T> c{ output_shape, _data_type };
+
+        // Fill reference
+        fill(a, 0);
+        fill(b, 1);
+        fill(c, 2);
+
+        return reference::gemm<T>(a, b, c, alpha, beta);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    DataType        _data_type{};
+};
+
+/** Fixture for the arrays of matrices: the strided shapes are split along their third dimension into one 2D matrix per problem */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class BatchedGEMMArrayValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape output_shape, float alpha, float beta, DataType data_type)
+    {
+        _data_type = data_type;
+
+        const size_t      num_batches = output_shape.z();
+        const size_t      num_b       = shape_b.z();
+        const TensorShape matrix_a    = TensorShape(shape_a.x(), shape_a.y());
+        const TensorShape matrix_b    = TensorShape(shape_b.x(), shape_b.y());
+        const TensorShape matrix_out  = TensorShape(output_shape.x(), output_shape.y());
+
+        compute_target(matrix_a, matrix_b, matrix_out, num_batches, num_b, alpha, beta);
+        compute_reference(matrix_a, matrix_b, matrix_out, num_batches, num_b, alpha, beta);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    void compute_target(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, size_t num_batches, size_t num_b, float alpha, float beta)
+    {
+        // Create tensors
+        std::vector<std::unique_ptr<TensorType>> a;
+        std::vector<std::unique_ptr<TensorType>> b;
+
+        for(size_t i = 0; i < num_batches; ++i)
+        {
+            a.emplace_back(support::cpp14::make_unique<TensorType>(create_tensor<TensorType>(shape_a, _data_type)));
+            _target.emplace_back(support::cpp14::make_unique<TensorType>(create_tensor<TensorType>(output_shape, _data_type)));
+        }
+
+        for(size_t i = 0; i < num_b; ++i)
+        {
+            b.emplace_back(support::cpp14::make_unique<TensorType>(create_tensor<TensorType>(shape_b, _data_type)));
+        }
+
+        std::vector<const ITensor *> a_ptrs;
+        std::vector<const ITensor *> b_ptrs;
+        std::vector<ITensor *>       dst_ptrs;
+
+        for(size_t i = 0; i < num_batches; ++i)
+        {
+            a_ptrs.push_back(a[i].get());
+            dst_ptrs.push_back(_target[i].get());
+        }
+
+        for(size_t i = 0; i < num_b; ++i)
+        {
+            b_ptrs.push_back(b[i].get());
+        }
+
+        // Create and configure function
+        FunctionType gemm;
+        gemm.configure(a_ptrs, b_ptrs, dst_ptrs, alpha, beta);
+
+        // Allocate and fill tensors: the destinations hold the matrices C which are accumulated when beta is not zero
+        for(size_t i = 0; i < num_batches; ++i)
+        {
+            a[i]->allocator()->allocate();
+            _target[i]->allocator()->allocate();
+
+            ARM_COMPUTE_EXPECT(!a[i]->info()->is_resizable(), framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(!_target[i]->info()->is_resizable(), framework::LogLevel::ERRORS);
+
+            fill(AccessorType(*a[i]), 3 * i);
+            fill(AccessorType(*_target[i]), 3 * i + 2);
+        }
+
+        for(size_t i = 0; i < num_b; ++i)
+        {
+            b[i]->allocator()->allocate();
+
+            ARM_COMPUTE_EXPECT(!b[i]->info()->is_resizable(), framework::LogLevel::ERRORS);
+
+            fill(AccessorType(*b[i]), 3 * i + 1);
+        }
+
+        // Compute GEMM function
+        gemm.run();
+    }
+
+    void compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, size_t num_batches, size_t num_b, float alpha, float beta)
+    {
+        for(size_t i = 0; i < num_batches; ++i)
+        {
+            // Create reference
+            SimpleTensor<T> a{ shape_a, _data_type };
+            SimpleTensor<T> b{ shape_b, _data_type };
+            SimpleTensor<T> c{ output_shape, _data_type };
+
+            // Fill reference: a shared matrix B is the first one
+            fill(a, 3 * i);
+            fill(b, 3 * ((num_b == 1) ? 0 : i) + 1);
+            fill(c, 3 * i + 2);
+
+            _reference.emplace_back(reference::gemm<T>(a, b, c, alpha, beta));
+        }
+    }
+
+    std::vector<std::unique_ptr<TensorType>> _target{};
+    std::vector<SimpleTensor<T>>             _reference{};
+    DataType                                 _data_type{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_BATCHED_GEMM_FIXTURE */
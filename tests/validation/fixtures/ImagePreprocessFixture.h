@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_IMAGE_PREPROCESS_FIXTURE
+#define ARM_COMPUTE_TEST_IMAGE_PREPROCESS_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ImagePreprocess.h"
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename MultiImageType, typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ImagePreprocessValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, Format format, TensorShape dst_shape, bool bgr)
+    {
+        shape = adjust_odd_shape(shape, format);
+
+        // ImageNet statistics
+        const std::array<float, 3> mean{ { 123.68f, 116.78f, 103.94f } };
+        const std::array<float, 3> std_dev{ { 58.4f, 57.1f, 57.4f } };
+
+        const DataType         data_type         = std::is_same<T, float>::value ? DataType::F32 : DataType::QASYMM8;
+        const QuantizationInfo quantization_info = (data_type == DataType::QASYMM8) ? QuantizationInfo(0.02f, 110) : QuantizationInfo();
+
+        dst_shape.set(2, 3);
+
+        _target    = compute_target(shape, format, dst_shape, data_type, quantization_info, mean, std_dev, bgr);
+        _reference = compute_reference(shape, format, dst_shape, quantization_info, mean, std_dev, bgr);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i);
+    }
+
+    std::vector<SimpleTensor<uint8_t>> create_tensor_planes_reference(const TensorShape &shape, Format format)
+    {
+        std::vector<SimpleTensor<uint8_t>> tensor_planes;
+
+        switch(format)
+        {
+            case Format::RGB888:
+            case Format::RGBA8888:
+                tensor_planes.emplace_back(shape, format);
+                break;
+            case Format::NV12:
+            case Format::NV21:
+                tensor_planes.emplace_back(shape, Format::U8);
+                tensor_planes.emplace_back(calculate_subsampled_shape(shape, Format::UV88), Format::UV88);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Not supported");
+                break;
+        }
+
+        return tensor_planes;
+    }
+
+    TensorType compute_target(const TensorShape &shape, Format format, const TensorShape &dst_shape, DataType data_type, QuantizationInfo quantization_info,
+                              const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr)
+    {
+        const unsigned int num_planes = num_planes_from_format(format);
+
+        // Create tensors
+        MultiImageType src = create_multi_image<MultiImageType>(shape, format);
+        TensorType     dst = create_tensor<TensorType>(dst_shape, data_type, 1, 0, quantization_info);
+
+        // Create and configure function
+        FunctionType preprocess;
+
+        if(1U == num_planes)
+        {
+            const TensorType *plane_src = static_cast<TensorType *>(src.plane(0));
+
+            preprocess.configure(plane_src, &dst, mean, std_dev, bgr);
+        }
+        else
+        {
+            preprocess.configure(&src, &dst, mean, std_dev, bgr);
+        }
+
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensor planes
+        for(unsigned int plane_idx = 0; plane_idx < num_planes; ++plane_idx)
+        {
+            TensorType *src_plane = static_cast<TensorType *>(src.plane(plane_idx));
+
+            fill(AccessorType(*src_plane), plane_idx);
+        }
+
+        // Compute function
+        preprocess.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, Format format, const TensorShape &dst_shape, QuantizationInfo quantization_info,
+                                      const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr)
+    {
+        const unsigned int num_planes = num_planes_from_format(format);
+
+        // Create reference
+        std::vector<SimpleTensor<uint8_t>> src = create_tensor_planes_reference(shape, format);
+
+        // Fill references
+        for(unsigned int plane_idx = 0; plane_idx < num_planes; ++plane_idx)
+        {
+            fill(src[plane_idx], plane_idx);
+        }
+
+        return reference::image_preprocess<T>(src, format, dst_shape, quantization_info, mean, std_dev, bgr);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_IMAGE_PREPROCESS_FIXTURE */
@@ -33,6 +33,7 @@
 #include "tests/framework/Fixture.h"
 #include "tests/validation/reference/Remap.h"
 
+#include <algorithm>
 #include <random>
 
 namespace arm_compute
@@ -128,6 +129,143 @@ protected:
     SimpleTensor<T> _reference{};
     SimpleTensor<T> _valid_mask{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class RemapCompressedMapsValidationFixture : public RemapValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, InterpolationPolicy policy, DataType data_type, BorderMode border_mode, DataType map_data_type, unsigned int map_subsampling)
+    {
+        std::mt19937                           gen(library->seed());
+        std::uniform_int_distribution<uint8_t> distribution(0, 255);
+        const T                                constant_border_value = static_cast<T>(distribution(gen));
+
+        // QS16 maps hold 3 fractional bits
+        const int fixed_point_position = (map_data_type == DataType::QS16) ? 3 : 0;
+
+        this->_target    = compute_target(shape, policy, data_type, border_mode, constant_border_value, map_data_type, fixed_point_position, map_subsampling);
+        this->_reference = compute_reference(shape, policy, data_type, border_mode, constant_border_value, fixed_point_position, map_subsampling);
+    }
+
+protected:
+    TensorShape compute_map_shape(TensorShape shape, unsigned int map_subsampling)
+    {
+        shape.set(0, DIV_CEIL(shape[0] - 1, map_subsampling) + 1);
+        shape.set(1, DIV_CEIL(shape[1] - 1, map_subsampling) + 1);
+
+        return shape;
+    }
+
+    TensorType compute_target(const TensorShape &shape, InterpolationPolicy policy, DataType data_type, BorderMode border_mode, T constant_border_value, DataType map_data_type,
+                              int fixed_point_position, unsigned int map_subsampling)
+    {
+        const TensorShape map_shape = compute_map_shape(shape, map_subsampling);
+        const int         scale     = 1 << fixed_point_position;
+
+        // Create tensors
+        TensorType src   = create_tensor<TensorType>(shape, data_type);
+        TensorType map_x = create_tensor<TensorType>(map_shape, map_data_type, 1, fixed_point_position);
+        TensorType map_y = create_tensor<TensorType>(map_shape, map_data_type, 1, fixed_point_position);
+        TensorType dst   = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType remap;
+        remap.configure(&src, &map_x, &map_y, &dst, policy, border_mode, constant_border_value, map_subsampling);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(map_x.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(map_y.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        map_x.allocator()->allocate();
+        map_y.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!map_x.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!map_y.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        this->fill(AccessorType(src), 0, 0, 255);
+        this->fill(AccessorType(map_x), 1, -5 * scale, (shape.x() + 5) * scale);
+        this->fill(AccessorType(map_y), 2, -5 * scale, (shape.y() + 5) * scale);
+
+        // Compute function
+        remap.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, InterpolationPolicy policy, DataType data_type, BorderMode border_mode, T constant_border_value, int fixed_point_position,
+                                      unsigned int map_subsampling)
+    {
+        ARM_COMPUTE_ERROR_ON(data_type != DataType::U8);
+
+        const TensorShape map_shape = compute_map_shape(shape, map_subsampling);
+        const int         scale     = 1 << fixed_point_position;
+
+        // Create reference
+        SimpleTensor<T>     src{ shape, data_type };
+        SimpleTensor<float> nodes_x{ map_shape, DataType::F32 };
+        SimpleTensor<float> nodes_y{ map_shape, DataType::F32 };
+
+        // Create the valid mask Tensor
+        this->_valid_mask = SimpleTensor<T> { shape, data_type };
+
+        // Fill reference
+        this->fill(src, 0, 0, 255);
+        this->fill(nodes_x, 1, -5 * scale, (shape.x() + 5) * scale);
+        this->fill(nodes_y, 2, -5 * scale, (shape.y() + 5) * scale);
+
+        // Expand the maps and compute reference
+        SimpleTensor<float> map_x = expand_map(nodes_x, shape, map_subsampling, 1.f / scale);
+        SimpleTensor<float> map_y = expand_map(nodes_y, shape, map_subsampling, 1.f / scale);
+
+        return reference::remap<T>(src, map_x, map_y, this->_valid_mask, policy, border_mode, constant_border_value);
+    }
+
+    /** Bilinearly interpolate the nodes of a sub-sampled map over the whole XY-plane */
+    SimpleTensor<float> expand_map(const SimpleTensor<float> &nodes, const TensorShape &shape, unsigned int map_subsampling, float scale)
+    {
+        SimpleTensor<float> map{ shape, DataType::F32 };
+
+        const int   subsampling = static_cast<int>(map_subsampling);
+        const float inv_sub     = 1.f / subsampling;
+        const int   last_x      = nodes.shape().x() - 1;
+        const int   last_y      = nodes.shape().y() - 1;
+
+        for(int idx = 0; idx < map.num_elements(); ++idx)
+        {
+            const Coordinates id = index2coord(shape, idx);
+
+            const int   x0 = id.x() / subsampling;
+            const int   y0 = id.y() / subsampling;
+            const int   x1 = std::min(x0 + 1, last_x);
+            const int   y1 = std::min(y0 + 1, last_y);
+            const float wx = (id.x() - x0 * subsampling) * inv_sub;
+            const float wy = (id.y() - y0 * subsampling) * inv_sub;
+
+            auto node = [&](int x, int y)
+            {
+                Coordinates node_id(id);
+                node_id.set(0, x);
+                node_id.set(1, y);
+                return nodes[coord2index(nodes.shape(), node_id)];
+            };
+
+            const float top    = node(x0, y0) + (node(x1, y0) - node(x0, y0)) * wx;
+            const float bottom = node(x0, y1) + (node(x1, y1) - node(x0, y1)) * wx;
+
+            map[idx] = (top + (bottom - top) * wy) * scale;
+        }
+
+        return map;
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "DetectionWindowNonMaximaSuppression.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+std::vector<DetectionWindow> detection_window_non_maxima_suppression(std::vector<DetectionWindow> windows, float min_distance)
+{
+    // Sort the candidates by score, in the same order as the library
+    std::sort(windows.begin(), windows.end(), [](const DetectionWindow & lhs, const DetectionWindow & rhs)
+    {
+        return lhs.score > rhs.score;
+    });
+
+    const float min_distance_pow2 = min_distance * min_distance;
+
+    std::vector<DetectionWindow> detections;
+
+    for(size_t i = 0; i < windows.size(); ++i)
+    {
+        if(windows[i].score == 0.0f)
+        {
+            continue;
+        }
+
+        detections.push_back(windows[i]);
+
+        const float xc = windows[i].x + windows[i].width * 0.5f;
+        const float yc = windows[i].y + windows[i].height * 0.5f;
+
+        // Suppress the lower scored windows close to the current one
+        for(size_t k = i + 1; k < windows.size(); ++k)
+        {
+            const float dx = std::fabs(windows[k].x + windows[k].width * 0.5f - xc);
+            const float dy = std::fabs(windows[k].y + windows[k].height * 0.5f - yc);
+
+            if(dx < min_distance && dy < min_distance && (dx * dx + dy * dy) < min_distance_pow2)
+            {
+                windows[k].score = 0.0f;
+            }
+        }
+    }
+
+    return detections;
+}
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -45,19 +45,30 @@ SimpleTensor<T> gemm(const SimpleTensor<T> &a, const SimpleTensor<T> &b, const S
     const int N = dst.shape().x();
     const int K = a.shape().x();
 
-    for(int row = 0; row < M; ++row)
+    // Matrices are batched along the third dimension, a single matrix B is shared by all the batches
+    const int num_batches = dst.shape().z();
+    const int b_stride    = (b.shape().z() > 1) ? K * N : 0;
+
+    for(int batch = 0; batch < num_batches; ++batch)
     {
-        for(int col = 0; col < N; ++col)
-        {
-            T acc(0);
+        const int a_offset = batch * M * K;
+        const int b_offset = batch * b_stride;
+        const int c_offset = batch * M * N;
 
-            for(int k = 0; k < K; ++k)
+        for(int row = 0; row < M; ++row)
+        {
+            for(int col = 0; col < N; ++col)
             {
-                acc += a[row * K + k] * b[k * N + col];
-            }
+                T acc(0);
 
-            // Finalize the result: alpha * A * B + beta * C
-            dst[col + row * N] = alpha * acc + beta * c[col + row * N];
+                for(int k = 0; k < K; ++k)
+                {
+                    acc += a[a_offset + row * K + k] * b[b_offset + k * N + col];
+                }
+
+                // Finalize the result: alpha * A * B + beta * C
+                dst[c_offset + col + row * N] = alpha * acc + beta * c[c_offset + col + row * N];
+            }
         }
     }
 
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ImagePreprocess.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+struct Sample
+{
+    int   index0;
+    int   index1;
+    float weight;
+};
+
+Sample sample(int dst, int src_size, int dst_size)
+{
+    const float scale = static_cast<float>(src_size) / dst_size;
+    const float src   = (dst + 0.5f) * scale - 0.5f;
+    const int   i0    = static_cast<int>(std::floor(src));
+
+    return Sample{ std::min(std::max(i0, 0), src_size - 1), std::min(std::max(i0 + 1, 0), src_size - 1), src - i0 };
+}
+
+float bilinear(const SimpleTensor<uint8_t> &src, int channel, const Sample &sx, const Sample &sy)
+{
+    const auto pixel = [&](int x, int y)
+    {
+        return static_cast<float>(reinterpret_cast<const uint8_t *>(src(Coordinates(x, y)))[channel]);
+    };
+
+    const float p00 = pixel(sx.index0, sy.index0);
+    const float p01 = pixel(sx.index1, sy.index0);
+    const float p10 = pixel(sx.index0, sy.index1);
+    const float p11 = pixel(sx.index1, sy.index1);
+
+    const float top    = p00 + sx.weight * (p01 - p00);
+    const float bottom = p10 + sx.weight * (p11 - p10);
+
+    return top + sy.weight * (bottom - top);
+}
+
+template <typename T>
+T store(float value, QuantizationInfo quantization_info);
+
+template <>
+float store(float value, QuantizationInfo quantization_info)
+{
+    ARM_COMPUTE_UNUSED(quantization_info);
+    return value;
+}
+
+template <>
+uint8_t store(float value, QuantizationInfo quantization_info)
+{
+    return quantization_info.quantize(value, RoundingPolicy::TO_NEAREST_UP);
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> image_preprocess(const std::vector<SimpleTensor<uint8_t>> &tensor_planes, Format format, const TensorShape &dst_shape, QuantizationInfo quantization_info,
+                                 const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr)
+{
+    const DataType data_type = std::is_same<T, float>::value ? DataType::F32 : DataType::QASYMM8;
+
+    SimpleTensor<T> dst{ dst_shape, data_type, 1, 0, quantization_info };
+
+    const SimpleTensor<uint8_t> &src           = tensor_planes[0];
+    const bool                   is_yuv        = (format == Format::NV12 || format == Format::NV21);
+    const int                    src_width     = src.shape().x();
+    const int                    src_height    = src.shape().y();
+    const int                    width         = dst_shape.x();
+    const int                    height        = dst_shape.y();
+    const int                    u_idx         = (format == Format::NV12) ? 0 : 1;
+    const int                    v_idx         = 1 - u_idx;
+    const int                    chroma_width  = is_yuv ? tensor_planes[1].shape().x() : 0;
+    const int                    chroma_height = is_yuv ? tensor_planes[1].shape().y() : 0;
+
+    for(int y = 0; y < height; ++y)
+    {
+        const Sample sy = sample(y, src_height, height);
+
+        for(int x = 0; x < width; ++x)
+        {
+            const Sample sx = sample(x, src_width, width);
+
+            std::array<float, 3> rgb{ {} };
+
+            if(is_yuv)
+            {
+                const Sample csx = sample(x, chroma_width, width);
+                const Sample csy = sample(y, chroma_height, height);
+
+                // BT709
+                const float luma = bilinear(src, 0, sx, sy);
+                const float u    = bilinear(tensor_planes[1], u_idx, csx, csy) - 128.f;
+                const float v    = bilinear(tensor_planes[1], v_idx, csx, csy) - 128.f;
+
+                rgb[0] = luma + 1.5748f * v;
+                rgb[1] = luma - 0.1873f * u - 0.4681f * v;
+                rgb[2] = luma + 1.8556f * u;
+
+                for(auto &value : rgb)
+                {
+                    value = std::min(std::max(value, 0.f), 255.f);
+                }
+            }
+            else
+            {
+                for(int c = 0; c < 3; ++c)
+                {
+                    rgb[c] = bilinear(src, c, sx, sy);
+                }
+            }
+
+            for(int plane = 0; plane < 3; ++plane)
+            {
+                const int channel = bgr ? 2 - plane : plane;
+
+                *reinterpret_cast<T *>(dst(Coordinates(x, y, plane))) = store<T>((rgb[channel] - mean[channel]) / std_dev[channel], quantization_info);
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> image_preprocess(const std::vector<SimpleTensor<uint8_t>> &tensor_planes, Format format, const TensorShape &dst_shape, QuantizationInfo quantization_info,
+                                              const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr);
+template SimpleTensor<uint8_t> image_preprocess(const std::vector<SimpleTensor<uint8_t>> &tensor_planes, Format format, const TensorShape &dst_shape, QuantizationInfo quantization_info,
+                                                const std::array<float, 3> &mean, const std::array<float, 3> &std_dev, bool bgr);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ROIPoolingLayer.h"
+
+#include "arm_compute/core/Types.h"
+#include "support/ToolchainSupport.h"
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> roi_pooling_layer(const SimpleTensor<T> &src, const std::vector<ROI> &rois, const ROIPoolingLayerInfo &pool_info)
+{
+    const int   width         = src.shape().x();
+    const int   height        = src.shape().y();
+    const int   fms           = src.shape().z();
+    const int   pooled_w      = pool_info.pooled_width();
+    const int   pooled_h      = pool_info.pooled_height();
+    const float spatial_scale = pool_info.spatial_scale();
+
+    // Create reference
+    SimpleTensor<T> dst{ TensorShape(pooled_w, pooled_h, fms, rois.size()), src.data_type(), 1, src.fixed_point_position() };
+
+    for(size_t r = 0; r < rois.size(); ++r)
+    {
+        const ROI &roi = rois[r];
+
+        // Scale ROI
+        const int roi_batch    = roi.batch_idx;
+        const int roi_anchor_x = support::cpp11::round(roi.rect.x * spatial_scale);
+        const int roi_anchor_y = support::cpp11::round(roi.rect.y * spatial_scale);
+        const int roi_width    = std::max(support::cpp11::round(roi.rect.width * spatial_scale), 1.f);
+        const int roi_height   = std::max(support::cpp11::round(roi.rect.height * spatial_scale), 1.f);
+
+        for(int fm = 0; fm < fms; ++fm)
+        {
+            for(int py = 0; py < pooled_h; ++py)
+            {
+                for(int px = 0; px < pooled_w; ++px)
+                {
+                    // Pooling region of the output element, clamped to the input
+                    int region_start_x = static_cast<int>(std::floor((static_cast<float>(px) / pooled_w) * roi_width)) + roi_anchor_x;
+                    int region_end_x   = static_cast<int>(std::floor((static_cast<float>(px + 1) / pooled_w) * roi_width)) + roi_anchor_x;
+                    int region_start_y = static_cast<int>(std::floor((static_cast<float>(py) / pooled_h) * roi_height)) + roi_anchor_y;
+                    int region_end_y   = static_cast<int>(std::floor((static_cast<float>(py + 1) / pooled_h) * roi_height)) + roi_anchor_y;
+
+                    region_start_x = std::min(std::max(region_start_x, 0), width);
+                    region_end_x   = std::min(std::max(region_end_x, 0), width);
+                    region_start_y = std::min(std::max(region_start_y, 0), height);
+                    region_end_y   = std::min(std::max(region_end_y, 0), height);
+
+                    const int dst_idx = coord2index(dst.shape(), Coordinates(px, py, fm, r));
+
+                    // Empty regions are set to zero
+                    if((region_end_x <= region_start_x) || (region_end_y <= region_start_y))
+                    {
+                        dst[dst_idx] = static_cast<T>(0);
+                        continue;
+                    }
+
+                    T max_val = src[coord2index(src.shape(), Coordinates(region_start_x, region_start_y, fm, roi_batch))];
+
+                    for(int y = region_start_y; y < region_end_y; ++y)
+                    {
+                        for(int x = region_start_x; x < region_end_x; ++x)
+                        {
+                            max_val = std::max(max_val, src[coord2index(src.shape(), Coordinates(x, y, fm, roi_batch))]);
+                        }
+                    }
+
+                    dst[dst_idx] = max_val;
+                }
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> roi_pooling_layer(const SimpleTensor<float> &src, const std::vector<ROI> &rois, const ROIPoolingLayerInfo &pool_info);
+template SimpleTensor<half> roi_pooling_layer(const SimpleTensor<half> &src, const std::vector<ROI> &rois, const ROIPoolingLayerInfo &pool_info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
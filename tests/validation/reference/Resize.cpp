@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Resize.h"
+
+#include "arm_compute/core/Types.h"
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+/** Source pixels (clamped to the image) and weights contributing to every destination pixel along one dimension */
+std::vector<std::vector<std::pair<int, float>>> compute_taps(int src_size, int dst_size, InterpolationPolicy policy, SamplingPolicy sampling_policy)
+{
+    const float scale  = static_cast<float>(src_size) / static_cast<float>(dst_size);
+    const bool  center = (sampling_policy == SamplingPolicy::CENTER);
+
+    auto clamp = [&](int i)
+    {
+        return std::min(std::max(i, 0), src_size - 1);
+    };
+
+    std::vector<std::vector<std::pair<int, float>>> taps(dst_size);
+
+    for(int d = 0; d < dst_size; ++d)
+    {
+        switch(policy)
+        {
+            case InterpolationPolicy::NEAREST_NEIGHBOR:
+            {
+                const float src = center ? (d + 0.5f) * scale : d * scale;
+                taps[d].emplace_back(clamp(std::floor(src)), 1.f);
+                break;
+            }
+            case InterpolationPolicy::BILINEAR:
+            {
+                const float src = center ? (d + 0.5f) * scale - 0.5f : d * scale;
+                const int   i   = std::floor(src);
+                taps[d].emplace_back(clamp(i), 1.f - (src - i));
+                taps[d].emplace_back(clamp(i + 1), src - i);
+                break;
+            }
+            case InterpolationPolicy::BICUBIC:
+            {
+                const float src = center ? (d + 0.5f) * scale - 0.5f : d * scale;
+                const int   i   = std::floor(src);
+
+                for(int k = -1; k <= 2; ++k)
+                {
+                    // Keys cubic convolution with a = -0.5
+                    const float x = std::fabs(src - (i + k));
+                    const float w = (x < 1.f) ? (1.5f * x * x * x - 2.5f * x * x + 1.f) : ((x < 2.f) ? (-0.5f * x * x * x + 2.5f * x * x - 4.f * x + 2.f) : 0.f);
+                    taps[d].emplace_back(clamp(i + k), w);
+                }
+                break;
+            }
+            case InterpolationPolicy::AREA:
+            {
+                const float begin = d * scale;
+                const float end   = (d + 1) * scale;
+
+                for(int i = std::floor(begin); i < end; ++i)
+                {
+                    const float overlap = std::min(i + 1.f, end) - std::max(static_cast<float>(i), begin);
+
+                    if(overlap > 0.f)
+                    {
+                        taps[d].emplace_back(clamp(i), overlap / scale);
+                    }
+                }
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Interpolation policy not supported");
+        }
+    }
+
+    return taps;
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> resize(const SimpleTensor<T> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy)
+{
+    SimpleTensor<T> dst{ dst_shape, src.format() };
+
+    const auto taps_x = compute_taps(src.shape().x(), dst_shape.x(), policy, sampling_policy);
+    const auto taps_y = compute_taps(src.shape().y(), dst_shape.y(), policy, sampling_policy);
+
+    for(int y = 0; y < static_cast<int>(dst_shape.y()); ++y)
+    {
+        for(int x = 0; x < static_cast<int>(dst_shape.x()); ++x)
+        {
+            auto *dst_pixel = reinterpret_cast<T *>(dst(Coordinates(x, y)));
+
+            for(int c = 0; c < src.num_channels(); ++c)
+            {
+                float sum = 0.f;
+
+                for(const auto &tap_y : taps_y[y])
+                {
+                    for(const auto &tap_x : taps_x[x])
+                    {
+                        const auto *src_pixel = reinterpret_cast<const T *>(src(Coordinates(tap_x.first, tap_y.first)));
+                        sum += tap_y.second * tap_x.second * src_pixel[c];
+                    }
+                }
+
+                dst_pixel[c] = saturate_cast<T>(std::round(sum));
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<uint8_t> resize(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -24,7 +24,10 @@
 
 #include "utils/GraphUtils.h"
 
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
 #include "utils/Utils.h"
 
 #ifdef ARM_COMPUTE_CL
@@ -32,10 +35,245 @@
 #include "arm_compute/runtime/CL/CLTensor.h"
 #endif /* ARM_COMPUTE_CL */
 
+#include <cstring>
 #include <iomanip>
+#include <limits>
+#include <sstream>
+#include <tuple>
 
+using namespace arm_compute;
 using namespace arm_compute::graph_utils;
 
+namespace
+{
+/** Checks that the header of a .npy file describes the given tensor
+ *
+ * @param[in] header Header read from the .npy file
+ * @param[in] info   Info of the tensor to be filled
+ */
+void validate_npy_header(const std::string &header, const ITensorInfo &info)
+{
+    const TensorShape          tensor_shape = info.tensor_shape();
+    std::vector<unsigned long> shape;
+
+    // Parse header
+    bool        fortran_order = false;
+    std::string typestr;
+    npy::parse_header(header, typestr, fortran_order, shape);
+
+    // Check if the typestring matches the given one
+    std::string expect_typestr = arm_compute::utils::get_typestring(info.data_type());
+    if(typestr != expect_typestr)
+    {
+        ARM_COMPUTE_ERROR("Typestrings mismatch");
+    }
+
+    // Reverse vector in case of non fortran order
+    if(!fortran_order)
+    {
+        std::reverse(shape.begin(), shape.end());
+    }
+
+    // Correct dimensions (Needs to match TensorShape dimension corrections)
+    if(shape.size() != tensor_shape.num_dimensions())
+    {
+        for(int i = static_cast<int>(shape.size()) - 1; i > 0; --i)
+        {
+            if(shape[i] == 1)
+            {
+                shape.pop_back();
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    // Validate tensor ranks
+    if(shape.size() != tensor_shape.num_dimensions())
+    {
+        ARM_COMPUTE_ERROR("Tensor ranks mismatch");
+    }
+
+    // Validate shapes
+    for(size_t i = 0; i < shape.size(); ++i)
+    {
+        if(tensor_shape[i] != shape[i])
+        {
+            ARM_COMPUTE_ERROR("Tensor dimensions mismatch");
+        }
+    }
+}
+
+/** Validates an in-memory .npy file against a tensor
+ *
+ * @param[in] npy  Beginning of the .npy file
+ * @param[in] size Size of the .npy file in bytes
+ * @param[in] info Info of the tensor to be filled
+ *
+ * @return Pointer to the array data of the .npy file
+ */
+uint8_t *validate_npy_data(uint8_t *npy, size_t size, const ITensorInfo &info)
+{
+    if(size < 10 || std::memcmp(npy, "\x93NUMPY", 6) != 0)
+    {
+        ARM_COMPUTE_ERROR("Not a .npy file");
+    }
+
+    // Magic string and version, followed by the little-endian header length (2 bytes for version 1, 4 for version 2)
+    const size_t header_length_size = (npy[6] == 1) ? 2 : 4;
+    if(size < 8 + header_length_size)
+    {
+        ARM_COMPUTE_ERROR("Truncated .npy header");
+    }
+    size_t header_length = 0;
+    for(size_t i = 0; i < header_length_size; ++i)
+    {
+        header_length |= static_cast<size_t>(npy[8 + i]) << (8 * i);
+    }
+    if(header_length > size - 8 - header_length_size)
+    {
+        ARM_COMPUTE_ERROR("Truncated .npy header");
+    }
+    const size_t data_offset = 8 + header_length_size + header_length;
+
+    // Wrap the header in a stream to reuse the npy parser
+    std::istringstream header(std::string(reinterpret_cast<const char *>(npy), data_offset));
+    validate_npy_header(npy::read_header(header), info);
+
+    if(size - data_offset < info.tensor_shape().total_size() * info.element_size())
+    {
+        ARM_COMPUTE_ERROR("Not enough data");
+    }
+
+    return npy + data_offset;
+}
+
+/** Kernel copying a dense buffer to the rows of a (possibly padded) tensor, rows being distributed among threads */
+class CopyRowsToTensorKernel final : public ICPPKernel
+{
+public:
+    const char *name() const override
+    {
+        return "CopyRowsToTensorKernel";
+    }
+    /** Default constructor */
+    CopyRowsToTensorKernel()
+        : _src(nullptr), _dst(nullptr), _row_size(0)
+    {
+    }
+    /** Set the source buffer and the destination tensor
+     *
+     * @param[in]  src Dense buffer holding all the elements of @p dst
+     * @param[out] dst Destination tensor
+     */
+    void configure(const uint8_t *src, ITensor *dst)
+    {
+        const TensorShape &shape = dst->info()->tensor_shape();
+
+        _src      = src;
+        _dst      = dst;
+        _row_size = shape[0] * dst->info()->element_size();
+
+        // Rows are enumerated along the X dimension of the window
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, shape.total_size_upper(1)));
+        ICPPKernel::configure(win);
+    }
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+        ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+        const TensorShape &shape = _dst->info()->tensor_shape();
+
+        for(int row = window.x().start(); row < window.x().end(); ++row)
+        {
+            Coordinates id(0);
+            size_t      index = row;
+            for(size_t d = 1; d < shape.num_dimensions(); ++d)
+            {
+                id.set(d, index % shape[d]);
+                index /= shape[d];
+            }
+            std::memcpy(_dst->ptr_to_element(id), _src + row * _row_size, _row_size);
+        }
+    }
+
+private:
+    const uint8_t *_src;
+    ITensor       *_dst;
+    size_t         _row_size;
+};
+
+/** Default bounds used by a RandomAccessor to fill a tensor of the given data type
+ *
+ * @param[in] data_type Data type of the tensor to fill
+ *
+ * @return A pair containing the lower and upper bounds
+ */
+std::pair<PixelValue, PixelValue> default_random_range(DataType data_type)
+{
+    PixelValue lower;
+    PixelValue upper;
+
+    switch(data_type)
+    {
+        case DataType::U8:
+        case DataType::QASYMM8:
+            lower.value.u8 = std::numeric_limits<uint8_t>::lowest();
+            upper.value.u8 = std::numeric_limits<uint8_t>::max();
+            break;
+        case DataType::S8:
+        case DataType::QS8:
+            lower.value.s8 = std::numeric_limits<int8_t>::lowest();
+            upper.value.s8 = std::numeric_limits<int8_t>::max();
+            break;
+        case DataType::U16:
+            lower = PixelValue(static_cast<uint16_t>(0));
+            upper = PixelValue(static_cast<uint16_t>(100));
+            break;
+        case DataType::S16:
+        case DataType::QS16:
+            lower = PixelValue(static_cast<int16_t>(-100));
+            upper = PixelValue(static_cast<int16_t>(100));
+            break;
+        case DataType::U32:
+            lower = PixelValue(static_cast<uint32_t>(0));
+            upper = PixelValue(static_cast<uint32_t>(100));
+            break;
+        case DataType::S32:
+            lower = PixelValue(static_cast<int32_t>(-100));
+            upper = PixelValue(static_cast<int32_t>(100));
+            break;
+        case DataType::U64:
+            lower = PixelValue(static_cast<uint64_t>(0));
+            upper = PixelValue(static_cast<uint64_t>(100));
+            break;
+        case DataType::S64:
+            lower = PixelValue(static_cast<int64_t>(-100));
+            upper = PixelValue(static_cast<int64_t>(100));
+            break;
+        case DataType::F16:
+        case DataType::F32:
+            lower = PixelValue(-1.f);
+            upper = PixelValue(1.f);
+            break;
+        case DataType::F64:
+            lower = PixelValue(-1.0);
+            upper = PixelValue(1.0);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT SUPPORTED!");
+    }
+
+    return std::make_pair(lower, upper);
+}
+} // namespace
+
 void TFPreproccessor::preprocess(ITensor &tensor)
 {
     Window window;
@@ -138,6 +376,40 @@ bool PPMAccessor::access_tensor(ITensor &tensor)
     return true;
 }
 
+ImagePreprocessAccessor::ImagePreprocessAccessor(const IImage *image, std::array<float, 3> mean, std::array<float, 3> std_dev, bool bgr)
+    : _image(image), _multi_image(nullptr), _mean(mean), _std_dev(std_dev), _bgr(bgr), _tensor(nullptr), _preprocess(nullptr)
+{
+}
+
+ImagePreprocessAccessor::ImagePreprocessAccessor(const IMultiImage *image, std::array<float, 3> mean, std::array<float, 3> std_dev, bool bgr)
+    : _image(nullptr), _multi_image(image), _mean(mean), _std_dev(std_dev), _bgr(bgr), _tensor(nullptr), _preprocess(nullptr)
+{
+}
+
+bool ImagePreprocessAccessor::access_tensor(ITensor &tensor)
+{
+    // The coefficient tables only depend on the shapes: configure once per destination tensor
+    if(_preprocess == nullptr || _tensor != &tensor)
+    {
+        _preprocess = arm_compute::support::cpp14::make_unique<NEImagePreprocess>();
+
+        if(_multi_image != nullptr)
+        {
+            _preprocess->configure(_multi_image, &tensor, _mean, _std_dev, _bgr);
+        }
+        else
+        {
+            _preprocess->configure(_image, &tensor, _mean, _std_dev, _bgr);
+        }
+
+        _tensor = &tensor;
+    }
+
+    _preprocess->run();
+
+    return true;
+}
+
 TopNPredictionsAccessor::TopNPredictionsAccessor(const std::string &labels_path, size_t top_n, std::ostream &output_stream)
     : _labels(), _output_stream(output_stream), _top_n(top_n)
 {
@@ -216,7 +488,12 @@ bool TopNPredictionsAccessor::access_tensor(ITensor &tensor)
 }
 
 RandomAccessor::RandomAccessor(PixelValue lower, PixelValue upper, std::random_device::result_type seed)
-    : _lower(lower), _upper(upper), _seed(seed)
+    : _lower(lower), _upper(upper), _seed(seed), _default_range(false)
+{
+}
+
+RandomAccessor::RandomAccessor(std::random_device::result_type seed)
+    : _lower(), _upper(), _seed(seed), _default_range(true)
 {
 }
 
@@ -229,7 +506,7 @@ void RandomAccessor::fill(ITensor &tensor, D &&distribution)
     {
         for(size_t offset = 0; offset < tensor.info()->total_size(); offset += tensor.info()->element_size())
         {
-            const T value                                    = distribution(gen);
+            const T value                                    = static_cast<T>(distribution(gen));
             *reinterpret_cast<T *>(tensor.buffer() + offset) = value;
         }
     }
@@ -241,7 +518,7 @@ void RandomAccessor::fill(ITensor &tensor, D &&distribution)
 
         execute_window_loop(window, [&](const Coordinates & id)
         {
-            const T value                                     = distribution(gen);
+            const T value                                     = static_cast<T>(distribution(gen));
             *reinterpret_cast<T *>(tensor.ptr_to_element(id)) = value;
         });
     }
@@ -249,73 +526,82 @@ void RandomAccessor::fill(ITensor &tensor, D &&distribution)
 
 bool RandomAccessor::access_tensor(ITensor &tensor)
 {
+    PixelValue lower = _lower;
+    PixelValue upper = _upper;
+
+    if(_default_range)
+    {
+        std::tie(lower, upper) = default_random_range(tensor.info()->data_type());
+    }
+
     switch(tensor.info()->data_type())
     {
         case DataType::U8:
+        case DataType::QASYMM8:
         {
-            std::uniform_int_distribution<uint8_t> distribution_u8(_lower.get<uint8_t>(), _upper.get<uint8_t>());
+            std::uniform_int_distribution<uint8_t> distribution_u8(lower.get<uint8_t>(), upper.get<uint8_t>());
             fill<uint8_t>(tensor, distribution_u8);
             break;
         }
         case DataType::S8:
         case DataType::QS8:
         {
-            std::uniform_int_distribution<int8_t> distribution_s8(_lower.get<int8_t>(), _upper.get<int8_t>());
+            std::uniform_int_distribution<int8_t> distribution_s8(lower.get<int8_t>(), upper.get<int8_t>());
             fill<int8_t>(tensor, distribution_s8);
             break;
         }
         case DataType::U16:
         {
-            std::uniform_int_distribution<uint16_t> distribution_u16(_lower.get<uint16_t>(), _upper.get<uint16_t>());
+            std::uniform_int_distribution<uint16_t> distribution_u16(lower.get<uint16_t>(), upper.get<uint16_t>());
             fill<uint16_t>(tensor, distribution_u16);
             break;
         }
         case DataType::S16:
         case DataType::QS16:
         {
-            std::uniform_int_distribution<int16_t> distribution_s16(_lower.get<int16_t>(), _upper.get<int16_t>());
+            std::uniform_int_distribution<int16_t> distribution_s16(lower.get<int16_t>(), upper.get<int16_t>());
             fill<int16_t>(tensor, distribution_s16);
             break;
         }
         case DataType::U32:
         {
-            std::uniform_int_distribution<uint32_t> distribution_u32(_lower.get<uint32_t>(), _upper.get<uint32_t>());
+            std::uniform_int_distribution<uint32_t> distribution_u32(lower.get<uint32_t>(), upper.get<uint32_t>());
             fill<uint32_t>(tensor, distribution_u32);
             break;
         }
         case DataType::S32:
         {
-            std::uniform_int_distribution<int32_t> distribution_s32(_lower.get<int32_t>(), _upper.get<int32_t>());
+            std::uniform_int_distribution<int32_t> distribution_s32(lower.get<int32_t>(), upper.get<int32_t>());
             fill<int32_t>(tensor, distribution_s32);
             break;
         }
         case DataType::U64:
         {
-            std::uniform_int_distribution<uint64_t> distribution_u64(_lower.get<uint64_t>(), _upper.get<uint64_t>());
+            std::uniform_int_distribution<uint64_t> distribution_u64(lower.get<uint64_t>(), upper.get<uint64_t>());
             fill<uint64_t>(tensor, distribution_u64);
             break;
         }
         case DataType::S64:
         {
-            std::uniform_int_distribution<int64_t> distribution_s64(_lower.get<int64_t>(), _upper.get<int64_t>());
+            std::uniform_int_distribution<int64_t> distribution_s64(lower.get<int64_t>(), upper.get<int64_t>());
             fill<int64_t>(tensor, distribution_s64);
             break;
         }
         case DataType::F16:
         {
-            std::uniform_real_distribution<float> distribution_f16(_lower.get<float>(), _upper.get<float>());
-            fill<float>(tensor, distribution_f16);
+            std::uniform_real_distribution<float> distribution_f16(lower.get<float>(), upper.get<float>());
+            fill<half>(tensor, distribution_f16);
             break;
         }
         case DataType::F32:
         {
-            std::uniform_real_distribution<float> distribution_f32(_lower.get<float>(), _upper.get<float>());
+            std::uniform_real_distribution<float> distribution_f32(lower.get<float>(), upper.get<float>());
             fill<float>(tensor, distribution_f32);
             break;
         }
         case DataType::F64:
         {
-            std::uniform_real_distribution<double> distribution_f64(_lower.get<double>(), _upper.get<double>());
+            std::uniform_real_distribution<double> distribution_f64(lower.get<double>(), upper.get<double>());
             fill<double>(tensor, distribution_f64);
             break;
         }
@@ -332,53 +618,12 @@ NumPyBinLoader::NumPyBinLoader(std::string filename)
 
 bool NumPyBinLoader::access_tensor(ITensor &tensor)
 {
-    const TensorShape          tensor_shape = tensor.info()->tensor_shape();
-    std::vector<unsigned long> shape;
+    const TensorShape tensor_shape = tensor.info()->tensor_shape();
 
     // Open file
     std::ifstream stream(_filename, std::ios::in | std::ios::binary);
     ARM_COMPUTE_ERROR_ON_MSG(!stream.good(), "Failed to load binary data");
-    std::string header = npy::read_header(stream);
-
-    // Parse header
-    bool        fortran_order = false;
-    std::string typestr;
-    npy::parse_header(header, typestr, fortran_order, shape);
-
-    // Check if the typestring matches the given one
-    std::string expect_typestr = arm_compute::utils::get_typestring(tensor.info()->data_type());
-    ARM_COMPUTE_ERROR_ON_MSG(typestr != expect_typestr, "Typestrings mismatch");
-
-    // Reverse vector in case of non fortran order
-    if(!fortran_order)
-    {
-        std::reverse(shape.begin(), shape.end());
-    }
-
-    // Correct dimensions (Needs to match TensorShape dimension corrections)
-    if(shape.size() != tensor_shape.num_dimensions())
-    {
-        for(int i = static_cast<int>(shape.size()) - 1; i > 0; --i)
-        {
-            if(shape[i] == 1)
-            {
-                shape.pop_back();
-            }
-            else
-            {
-                break;
-            }
-        }
-    }
-
-    // Validate tensor ranks
-    ARM_COMPUTE_ERROR_ON_MSG(shape.size() != tensor_shape.num_dimensions(), "Tensor ranks mismatch");
-
-    // Validate shapes
-    for(size_t i = 0; i < shape.size(); ++i)
-    {
-        ARM_COMPUTE_ERROR_ON_MSG(tensor_shape[i] != shape[i], "Tensor dimensions mismatch");
-    }
+    validate_npy_header(npy::read_header(stream), *tensor.info());
 
     // Read data
     if(tensor.info()->padding().empty() && (dynamic_cast<SubTensor *>(&tensor) == nullptr))
@@ -399,3 +644,36 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     }
     return true;
 }
+
+PackedNumPyLoader::PackedNumPyLoader(std::shared_ptr<utils::PackedWeightsFile> file, std::string name)
+    : _file(std::move(file)), _name(std::move(name))
+{
+}
+
+bool PackedNumPyLoader::import_tensor(ITensor &tensor)
+{
+    auto cpu_tensor = dynamic_cast<arm_compute::Tensor *>(&tensor);
+    if(cpu_tensor == nullptr || !tensor.info()->padding().empty())
+    {
+        return false;
+    }
+
+    const std::pair<uint8_t *, size_t> npy  = _file->entry(_name);
+    uint8_t                           *data = validate_npy_data(npy.first, npy.second, *tensor.info());
+
+    // The imported memory keeps the mapping alive
+    const std::shared_ptr<uint8_t> memory(_file, data);
+    return bool(cpu_tensor->allocator()->import_memory(Memory(memory)));
+}
+
+bool PackedNumPyLoader::access_tensor(ITensor &tensor)
+{
+    const std::pair<uint8_t *, size_t> npy  = _file->entry(_name);
+    const uint8_t                     *data = validate_npy_data(npy.first, npy.second, *tensor.info());
+
+    CopyRowsToTensorKernel copy;
+    copy.configure(data, &tensor);
+    NEScheduler::get().schedule(&copy, Window::DimX);
+
+    return true;
+}
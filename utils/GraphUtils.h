@@ -28,10 +28,15 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEImagePreprocess.h"
+#include "utils/Utils.h"
 
 #include <array>
+#include <map>
+#include <memory>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace arm_compute
@@ -135,6 +140,51 @@ private:
     std::unique_ptr<IPreprocessor> _preprocessor;
 };
 
+/** Image pre-processing accessor class
+ *
+ * Fills the input tensor of a graph from an image owned by the application (e.g. the buffer of a camera frame updated
+ * between two runs of the graph) using @ref NEImagePreprocess: colour conversion, resizing and normalisation are done
+ * in a single multi-threaded pass instead of @ref NEColorConvert, @ref NEScale and an @ref IPreprocessor.
+ *
+ * @note @ref CaffePreproccessor corresponds to @p std_dev = {1, 1, 1} and @ref TFPreproccessor to @p mean = @p std_dev = {127.5, 127.5, 127.5}.
+ */
+class ImagePreprocessAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] image   Source image. Formats supported: RGB888/RGBA8888.
+     * @param[in] mean    (Optional) Mean of each channel, in RGB order
+     * @param[in] std_dev (Optional) Standard deviation of each channel, in RGB order
+     * @param[in] bgr     (Optional) Fill the first plane with blue channel (default = true)
+     */
+    ImagePreprocessAccessor(const IImage *image, std::array<float, 3> mean = std::array<float, 3> { { 0, 0, 0 } },
+                            std::array<float, 3> std_dev = std::array<float, 3> { { 1, 1, 1 } }, bool bgr = true);
+    /** Constructor
+     *
+     * @param[in] image   Source image. Formats supported: NV12/NV21.
+     * @param[in] mean    (Optional) Mean of each channel, in RGB order
+     * @param[in] std_dev (Optional) Standard deviation of each channel, in RGB order
+     * @param[in] bgr     (Optional) Fill the first plane with blue channel (default = true)
+     */
+    ImagePreprocessAccessor(const IMultiImage *image, std::array<float, 3> mean = std::array<float, 3> { { 0, 0, 0 } },
+                            std::array<float, 3> std_dev = std::array<float, 3> { { 1, 1, 1 } }, bool bgr = true);
+    /** Allow instances of this class to be move constructed */
+    ImagePreprocessAccessor(ImagePreprocessAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    const IImage                      *_image;
+    const IMultiImage                 *_multi_image;
+    const std::array<float, 3>         _mean;
+    const std::array<float, 3>         _std_dev;
+    const bool                         _bgr;
+    const ITensor                     *_tensor;
+    std::unique_ptr<NEImagePreprocess> _preprocess;
+};
+
 /** Result accessor class */
 class TopNPredictionsAccessor final : public graph::ITensorAccessor
 {
@@ -176,6 +226,14 @@ public:
      * @param[in] seed  (Optional) Seed used to initialise the random number generator.
      */
     RandomAccessor(PixelValue lower, PixelValue upper, const std::random_device::result_type seed = 0);
+    /** Constructor
+     *
+     * @note The bounds are chosen according to the data type of the accessed tensor:
+     *       [-1, 1] for floating point types, the full range for 8 bit types and [-100, 100] (or [0, 100]) for wider integer types.
+     *
+     * @param[in] seed (Optional) Seed used to initialise the random number generator.
+     */
+    explicit RandomAccessor(const std::random_device::result_type seed = 0);
     /** Allows instances to move constructed */
     RandomAccessor(RandomAccessor &&) = default;
 
@@ -188,6 +246,7 @@ private:
     PixelValue                      _lower;
     PixelValue                      _upper;
     std::random_device::result_type _seed;
+    bool                            _default_range;
 };
 
 /** Numpy Binary loader class*/
@@ -209,6 +268,32 @@ private:
     const std::string _filename;
 };
 
+/** Numpy Binary loader class reading from a packed weights file
+ *
+ * Unpadded NEON tensors are backed directly by the mapping, without any copy.
+ * Other tensors are allocated and filled with a multi-threaded row by row copy.
+ */
+class PackedNumPyLoader final : public graph::ITensorAccessor
+{
+public:
+    /** Default Constructor
+     *
+     * @param[in] file Packed weights file
+     * @param[in] name Name of the entry to load
+     */
+    PackedNumPyLoader(std::shared_ptr<utils::PackedWeightsFile> file, std::string name);
+    /** Allows instances to move constructed */
+    PackedNumPyLoader(PackedNumPyLoader &&) = default;
+
+    // Inherited methods overriden:
+    bool import_tensor(ITensor &tensor) override;
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::shared_ptr<utils::PackedWeightsFile> _file;
+    const std::string                         _name;
+};
+
 /** Generates appropriate random accessor
  *
  * @param[in] lower Lower random values bound
@@ -224,7 +309,9 @@ inline std::unique_ptr<graph::ITensorAccessor> get_random_accessor(PixelValue lo
 
 /** Generates appropriate weights accessor according to the specified path
  *
- * @note If path is empty will generate a DummyAccessor else will generate a NumPyBinLoader
+ * @note If path is empty will generate a RandomAccessor using the default range of the tensor's data type.
+ *       If path points inside a packed weights file (e.g. "model.aclpack/cnn_data/") will generate a PackedNumPyLoader
+ *       else will generate a NumPyBinLoader
  *
  * @param[in] path      Path to the data files
  * @param[in] data_file Relative path to the data files from path
@@ -235,11 +322,23 @@ inline std::unique_ptr<graph::ITensorAccessor> get_weights_accessor(const std::s
 {
     if(path.empty())
     {
-        return arm_compute::support::cpp14::make_unique<DummyAccessor>();
+        return arm_compute::support::cpp14::make_unique<RandomAccessor>();
+    }
+
+    const std::string full_path = path + data_file;
+    const std::string extension(".aclpack");
+    const size_t      pack_end  = full_path.find(extension);
+
+    if(pack_end != std::string::npos)
+    {
+        // Entries are named after their path relative to the packed directory
+        const size_t name_begin = full_path.find_first_not_of('/', pack_end + extension.size());
+        const auto   file       = utils::PackedWeightsFile::open(full_path.substr(0, pack_end + extension.size()));
+        return arm_compute::support::cpp14::make_unique<PackedNumPyLoader>(file, name_begin == std::string::npos ? std::string() : full_path.substr(name_begin));
     }
     else
     {
-        return arm_compute::support::cpp14::make_unique<NumPyBinLoader>(path + data_file);
+        return arm_compute::support::cpp14::make_unique<NumPyBinLoader>(full_path);
     }
 }
 
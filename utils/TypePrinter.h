@@ -576,6 +576,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const InterpolationPolicy
         case InterpolationPolicy::AREA:
             os << "AREA";
             break;
+        case InterpolationPolicy::BICUBIC:
+            os << "BICUBIC";
+            break;
         default:
             ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
     }
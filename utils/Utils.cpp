@@ -28,6 +28,14 @@
 #include <iomanip>
 #include <string>
 
+#ifndef BARE_METAL
+#include <fcntl.h>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* BARE_METAL */
+
 namespace arm_compute
 {
 namespace utils
@@ -192,6 +200,146 @@ std::tuple<std::vector<unsigned long>, bool, std::string> parse_npy_header(std::
     return std::make_tuple(shape, fortran_order, typestr);
 }
 
+#ifndef BARE_METAL
+namespace
+{
+/* Read a value from a packed weights file, raising an error if it lies past the end of the file
+ *
+ * @param[in]     data     Beginning of the file
+ * @param[in]     size     Size of the file in bytes
+ * @param[in,out] pos      Position of the value, advanced past it
+ * @param[in]     filename Name of the file, used in the error message
+ *
+ * @return The value read
+ */
+template <typename T>
+T read_packed_value(const uint8_t *data, size_t size, size_t &pos, const std::string &filename)
+{
+    if(pos > size || size - pos < sizeof(T))
+    {
+        ARM_COMPUTE_ERROR("Truncated packed weights file %s", filename.c_str());
+    }
+
+    T value{};
+    std::memcpy(&value, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+} // namespace
+
+std::shared_ptr<PackedWeightsFile> PackedWeightsFile::open(const std::string &filename)
+{
+    static std::mutex                                              mutex;
+    static std::map<std::string, std::weak_ptr<PackedWeightsFile>> files;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::shared_ptr<PackedWeightsFile> file = files[filename].lock();
+    if(file == nullptr)
+    {
+        file            = std::make_shared<PackedWeightsFile>(filename);
+        files[filename] = file;
+    }
+    return file;
+}
+
+PackedWeightsFile::PackedWeightsFile(const std::string &filename)
+    : _data(nullptr), _size(0), _entries()
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        ARM_COMPUTE_ERROR("Failed to open packed weights file %s", filename.c_str());
+    }
+
+    struct stat file_stat;
+    if(fstat(fd, &file_stat) != 0)
+    {
+        ::close(fd);
+        ARM_COMPUTE_ERROR("Failed to stat packed weights file %s", filename.c_str());
+    }
+    _size = static_cast<size_t>(file_stat.st_size);
+
+    // Private writable mapping: tensors backed by it can be modified in place without touching the file
+    void *data = (_size != 0) ? mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    if(data == MAP_FAILED)
+    {
+        ARM_COMPUTE_ERROR("Failed to map packed weights file %s", filename.c_str());
+    }
+    _data = static_cast<uint8_t *>(data);
+
+    // The destructor won't be called if the index is invalid
+    try
+    {
+        read_index(filename);
+    }
+    catch(...)
+    {
+        munmap(_data, _size);
+        throw;
+    }
+}
+
+PackedWeightsFile::~PackedWeightsFile()
+{
+    if(_data != nullptr)
+    {
+        munmap(_data, _size);
+    }
+}
+
+std::pair<uint8_t *, size_t> PackedWeightsFile::entry(const std::string &name) const
+{
+    const auto it = _entries.find(name);
+    if(it == _entries.end())
+    {
+        ARM_COMPUTE_ERROR("Entry %s not found in packed weights file", name.c_str());
+    }
+    return std::make_pair(_data + it->second.first, it->second.second);
+}
+
+void PackedWeightsFile::read_index(const std::string &filename)
+{
+    // Header: magic string, version, number of entries
+    const char magic[8] = { 'A', 'C', 'L', 'P', 'A', 'C', 'K', '\0' };
+    if(_size < sizeof(magic) || std::memcmp(_data, magic, sizeof(magic)) != 0)
+    {
+        ARM_COMPUTE_ERROR("Not a packed weights file: %s", filename.c_str());
+    }
+
+    size_t         pos         = sizeof(magic);
+    const uint32_t version     = read_packed_value<uint32_t>(_data, _size, pos, filename);
+    const uint32_t num_entries = read_packed_value<uint32_t>(_data, _size, pos, filename);
+    if(version != 1)
+    {
+        ARM_COMPUTE_ERROR("Unsupported packed weights file version %u", version);
+    }
+
+    // Index: for each entry, name length, name, offset and size of the .npy data
+    for(uint32_t i = 0; i < num_entries; ++i)
+    {
+        const uint32_t name_length = read_packed_value<uint32_t>(_data, _size, pos, filename);
+        if(_size - pos < name_length)
+        {
+            ARM_COMPUTE_ERROR("Truncated packed weights file %s", filename.c_str());
+        }
+        const std::string name(reinterpret_cast<const char *>(_data + pos), name_length);
+        pos += name_length;
+
+        const uint64_t offset = read_packed_value<uint64_t>(_data, _size, pos, filename);
+        const uint64_t size   = read_packed_value<uint64_t>(_data, _size, pos, filename);
+
+        // Written so that it can't overflow
+        if(offset > _size || size > _size - offset)
+        {
+            ARM_COMPUTE_ERROR("Entry %s of packed weights file %s is out of bounds", name.c_str(), filename.c_str());
+        }
+        _entries[name] = std::make_pair(static_cast<size_t>(offset), static_cast<size_t>(size));
+    }
+}
+#endif /* BARE_METAL */
+
 /** This function returns the amount of memory free reading from /proc/meminfo
  *
  * @return The free memory in kB
@@ -46,9 +46,12 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <random>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace arm_compute
@@ -78,11 +81,39 @@ public:
  */
 int run_example(int argc, char **argv, Example &example);
 
+/** Function creating a new instance of an example */
+using ExampleFactory = std::unique_ptr<Example> (*)();
+
+/** Run an example as a benchmark
+ *
+ * @note Implemented by the benchmark_examples runner (tests/benchmark_examples/RunExample.cpp), which
+ *       creates a new instance of the example for each configuration it measures.
+ *
+ * @param[in] argc    Number of command line arguments
+ * @param[in] argv    Command line arguments
+ * @param[in] factory Function creating a new instance of the example to run
+ */
+int run_example(int argc, char **argv, ExampleFactory factory);
+
+/** Create a new instance of an example
+ *
+ * @return The new example
+ */
+template <typename T>
+std::unique_ptr<Example> create_example()
+{
+    return arm_compute::support::cpp14::make_unique<T>();
+}
+
 template <typename T>
 int run_example(int argc, char **argv)
 {
+#ifdef BENCHMARK_EXAMPLES
+    return run_example(argc, argv, &create_example<T>);
+#else  /* BENCHMARK_EXAMPLES */
     T example;
     return run_example(argc, argv, example);
+#endif /* BENCHMARK_EXAMPLES */
 }
 
 /** Draw a RGB rectangular window for the detected object
@@ -895,6 +926,65 @@ void init_sgemm_output(T &dst, T &src0, T &src1, arm_compute::DataType dt)
 {
     dst.allocator()->init(TensorInfo(TensorShape(src1.info()->dimension(0), src0.info()->dimension(1)), 1, dt));
 }
+#ifndef BARE_METAL
+/** Private copy-on-write mapping of a packed weights file
+ *
+ * A packed weights file (see scripts/pack_npy_weights.py) concatenates unmodified .npy files at 64-byte aligned offsets,
+ * preceded by an index of their names. The whole file is memory-mapped once and shared by all the loaders reading from it.
+ *
+ * The mapping is readable and writable but private (MAP_PRIVATE): tensors importing an entry can be modified in place,
+ * the modified pages are copied and the file itself is never written. Writes are visible to the other tensors importing
+ * the same entry from this mapping.
+ *
+ * The file layout is:
+ * - Header: "ACLPACK\0", version (uint32_t, 1), number of entries (uint32_t).
+ * - Index: for each entry, length of its name (uint32_t), name, offset and size of the .npy data (uint64_t each).
+ * - The .npy data of the entries.
+ *
+ * All the values are little-endian. An error is raised if the index or any entry lies outside of the file.
+ */
+class PackedWeightsFile final
+{
+public:
+    /** Returns the mapping of a packed weights file, mapping it if no loader currently holds it
+     *
+     * @param[in] filename Packed weights file name
+     *
+     * @return The shared mapping of the file
+     */
+    static std::shared_ptr<PackedWeightsFile> open(const std::string &filename);
+    /** Constructor: maps the file and reads its index
+     *
+     * @param[in] filename Packed weights file name
+     */
+    PackedWeightsFile(const std::string &filename);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    PackedWeightsFile(const PackedWeightsFile &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    PackedWeightsFile &operator=(const PackedWeightsFile &) = delete;
+    /** Destructor: unmaps the file */
+    ~PackedWeightsFile();
+    /** Looks up an entry
+     *
+     * @param[in] name Name of the entry. Path of the original .npy file relative to the packed directory.
+     *
+     * @return Pointer to the beginning of the .npy data of the entry and its size in bytes
+     */
+    std::pair<uint8_t *, size_t> entry(const std::string &name) const;
+
+private:
+    /** Reads the header and the index of the mapped file
+     *
+     * @param[in] filename Packed weights file name, used in the error messages
+     */
+    void read_index(const std::string &filename);
+
+    uint8_t                                         *_data;    /**< Beginning of the mapping */
+    size_t                                           _size;    /**< Size of the mapping in bytes */
+    std::map<std::string, std::pair<size_t, size_t>> _entries; /**< Offset and size of each entry */
+};
+#endif /* BARE_METAL */
+
 /** This function returns the amount of memory free reading from /proc/meminfo
  *
  * @return The free memory in kB